@@ -571,6 +571,10 @@ SOURCE=.\src\base\cmd\cmdStarter.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\cmd\cmdTrace.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\cmd\cmdUtils.c
 # End Source File
 # End Group
@@ -4526,6 +4530,10 @@ SOURCE=.\src\map\if\ifMap.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\if\ifMapMt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\if\ifMatch2.c
 # End Source File
 # Begin Source File
@@ -5982,6 +5990,10 @@ SOURCE=.\src\aig\gia\giaClp.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaCnfFast.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaCof.c
 # End Source File
 # Begin Source File
@@ -6022,6 +6034,10 @@ SOURCE=.\src\aig\gia\giaCut.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaCutMerge.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaDecs.c
 # End Source File
 # Begin Source File
@@ -6110,6 +6126,10 @@ SOURCE=.\src\aig\gia\giaHash.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaHashMt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaIf.c
 # End Source File
 # Begin Source File
@@ -6258,6 +6278,10 @@ SOURCE=.\src\aig\gia\giaRrr.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaRwr.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSat3.c
 # End Source File
 # Begin Source File
@@ -6326,6 +6350,10 @@ SOURCE=.\src\aig\gia\giaSimBase.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimMt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -6697,6 +6725,10 @@ SOURCE=.\src\proof\cec\cecCorrIncr.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecCorrPart.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecInt.h
 # End Source File
 # Begin Source File
@@ -6713,6 +6745,10 @@ SOURCE=.\src\proof\cec\cecPat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecProof.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecProve.c
 # End Source File
 # Begin Source File
@@ -7082,6 +7118,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -7098,6 +7138,10 @@ SOURCE=.\src\proof\pdr\pdrTsim3.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrTsim4.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrUtil.c
 # End Source File
 # End Group
@@ -0,0 +1,89 @@
+#!/usr/bin/env bash
+# Benchmark harness for the core synthesis and verification flows.
+#
+# A deterministic set of AIGs is generated with the built-in generators
+# (&genadder, &gensorter, &genmux, gen -m), and a fixed set of recipes is
+# applied to them.  Each (design, command) pair runs in a fresh abc process
+# and produces one JSON record with the wall time of the command (as
+# measured by abc's "time"), the peak RSS of the process, the size of the
+# resulting AIG or mapping, and the verification status, if any.
+#
+# Usage:  ABC=./abc ./bench/abc_bench.sh [output.json]
+#
+# The results go to stdout if no output file is given.  Peak RSS is read
+# from /proc and is reported as null on systems without it.
+
+set -eu
+
+ABC=${ABC:-./abc}
+OUT=${1:-/dev/stdout}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+run_abc() {
+    "$ABC" -q "$1" 2>&1 | sed 's/\x1b\[[0-9;]*m//g'
+}
+
+# Generates the designs.  The adders are built twice, as ripple-carry and
+# Sklansky adders, to get combinational and sequential miters whose sides
+# are structurally different.  The sequential designs are accumulators,
+# whose carry-in is the primary input and the sums are fed back through
+# the flops.  BMC on the accumulator miter is hard for SAT after a few
+# frames, so it runs on a narrower one with a fixed frame count.
+generate() {
+    run_abc "&genadder -N 512 -s; &w $TMP/adder.aig;
+             &gensorter -K 8; &w $TMP/sorter.aig;
+             &genmux -K 12 444; &w $TMP/mux.aig;
+             gen -N 24 -m $TMP/mult.blif; read $TMP/mult.blif; strash; &get; &w $TMP/mult.aig;
+             &genadder -N 512; &w $TMP/adder_rc.aig;
+             &r $TMP/adder.aig; &miter $TMP/adder_rc.aig; &w $TMP/adder_miter.aig;
+             &genadder -N 128 -c; &setregnum -N 128; &w $TMP/acc_rc.aig;
+             &genadder -N 128 -c -s; &setregnum -N 128; &miter -s $TMP/acc_rc.aig; &w $TMP/acc_miter.aig;
+             &genadder -N 16 -c; &setregnum -N 16; &w $TMP/acc_rc.aig;
+             &genadder -N 16 -c -s; &setregnum -N 16; &miter -s $TMP/acc_rc.aig; &w $TMP/acc16_miter.aig" > "$TMP/gen.log"
+}
+
+# Prints the value following "<key> =" in the last line containing it.
+field() {
+    local value
+    value=$(grep -o "$1 *= *[0-9.]*" "$2" | tail -1 | sed 's/.*= *//')
+    echo "${value:-null}"
+}
+
+NRECORDS=0
+
+# Runs one command on one design and prints its JSON record.
+bench() {
+    local design=$1 command=$2 stats=$3
+    local log="$TMP/run.log"
+    local wall rss ands levels luts status
+    run_abc "&r $TMP/$design.aig; &put; time; $command; time; $stats; !grep VmHWM /proc/\$PPID/status" > "$log"
+    wall=$(grep -o "elapse: *[0-9.]*" "$log" | tail -1 | sed 's/.*: *//')
+    rss=$(grep -o "VmHWM:[[:space:]]*[0-9]*" "$log" | sed 's/.*:[[:space:]]*//')
+    ands=$(field "and" "$log")
+    levels=$(field "lev" "$log")
+    luts=$(field "lut" "$log")
+    status=$(grep -o -m1 -E "Networks are (equivalent|NOT EQUIVALENT|UNDECIDED)|Property proved|Output [0-9]+ of miter .* was asserted|No output asserted in [0-9]+ frames" "$log" || true)
+    [ $NRECORDS -gt 0 ] && printf ',\n'
+    NRECORDS=$((NRECORDS + 1))
+    printf '    { "design": "%s", "command": "%s", "wall_sec": %s, "peak_rss_kb": %s, "ands": %s, "levels": %s, "luts": %s, "status": %s }' \
+        "$design" "$command" "${wall:-null}" "${rss:-null}" "$ands" "$levels" "$luts" \
+        "$( [ -n "$status" ] && printf '"%s"' "$status" || printf 'null' )"
+}
+
+generate
+
+{
+    printf '{\n  "abc": "%s",\n  "benchmarks": [\n' "$(run_abc "version" | head -1)"
+    for design in adder sorter mux mult; do
+        bench $design "&dc2"     "&ps"
+        bench $design "&if -K 6" "&ps"
+        bench $design "&mf"      "&ps"
+    done
+    bench adder_miter "&fraig -x" "&ps"
+    bench adder_miter "&cec -m"   ""
+    bench acc_miter   "&scorr"    "&ps"
+    bench acc_miter   "pdr"       ""
+    bench acc16_miter "bmc3 -F 4" ""
+    printf '\n  ]\n}\n'
+} > "$OUT"
@@ -42,8 +42,17 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// with wide objects (compiled with ABC_USE_WIDE_GIA), the fanin diffs take
+// 31 bits and the number of objects is limited only by literals being 'int'
+#ifdef ABC_USE_WIDE_GIA
+#define GIA_NONE 0x7FFFFFFF
+#define GIA_VOID 0x7FFFFFFF
+#define GIA_OBJ_MAX (1 << 30)
+#else
 #define GIA_NONE 0x1FFFFFFF
 #define GIA_VOID 0x0FFFFFFF
+#define GIA_OBJ_MAX (1 << 29)
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -53,11 +62,16 @@ typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
+typedef struct Gia_HashMt_t_         Gia_HashMt_t;
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
 {
+#ifdef ABC_USE_WIDE_GIA
+    unsigned       iRepr   : 31;  // representative node
+#else
     unsigned       iRepr   : 28;  // representative node
+#endif
     unsigned       fProved :  1;  // marks the proved equivalence
     unsigned       fFailed :  1;  // marks the failed equivalence
     unsigned       fColorA :  1;  // marks cone of A
@@ -76,6 +90,17 @@ struct Gia_Plc_t_
 typedef struct Gia_Obj_t_ Gia_Obj_t;
 struct Gia_Obj_t_
 {
+#ifdef ABC_USE_WIDE_GIA
+    unsigned       iDiff0 :  31;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+    unsigned       iDiff1 :  31;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+
+    unsigned       fMark0 :   1;  // first user-controlled mark
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fMark1 :   1;  // second user-controlled mark
+    unsigned       fPhase :   1;  // value under 000 pattern
+#else
     unsigned       iDiff0 :  29;  // the diff of the first fanin
     unsigned       fCompl0:   1;  // the complemented attribute
     unsigned       fMark0 :   1;  // first user-controlled mark
@@ -85,6 +110,7 @@ struct Gia_Obj_t_
     unsigned       fCompl1:   1;  // the complemented attribute
     unsigned       fMark1 :   1;  // second user-controlled mark
     unsigned       fPhase :   1;  // value under 000 pattern
+#endif
 
     unsigned       Value;         // application-specific value
 };
@@ -104,6 +130,8 @@ struct Gia_Man_t_
     int            nObjsAlloc;    // number of allocated objects
     Gia_Obj_t *    pObjs;         // the array of objects
     unsigned *     pMuxes;        // control signals of MUXes
+    int            fObjsMapped;   // object array is in the reserved address space
+    int            fMuxesMapped;  // MUX array is in the reserved address space
     int            nXors;         // the number of XORs
     int            nMuxes;        // the number of MUXes 
     int            nBufs;         // the number of buffers
@@ -393,6 +421,7 @@ struct Jf_Par_t_
     float *        pTimesArr;
     float *        pTimesReq;
     char *         ZFile;
+    Vec_Mem_t *    vTtMem;          // truth tables kept across mapping runs
 };
 
 static inline unsigned     Gia_ObjCutSign( unsigned ObjId )       { return (1 << (ObjId & 31));                                 }
@@ -680,25 +709,15 @@ static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    {
 
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
+extern void Gia_ManGrowObjs( Gia_Man_t * p, int nObjNew );
+
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
-        assert( p->nObjs < nObjNew );
-        if ( p->fVerbose )
-            printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
-        assert( p->nObjsAlloc > 0 );
-        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
-        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
-        if ( p->pMuxes )
-        {
-            p->pMuxes = ABC_REALLOC( unsigned, p->pMuxes, nObjNew );
-            memset( p->pMuxes + p->nObjsAlloc, 0, sizeof(unsigned) * (nObjNew - p->nObjsAlloc) );
-        }
-        p->nObjsAlloc = nObjNew;
+        if ( p->nObjs == GIA_OBJ_MAX )
+            printf( "Hard limit on the number of nodes (%d) is reached. Quitting...\n", GIA_OBJ_MAX ), exit(1);
+        Gia_ManGrowObjs( p, p->nObjsAlloc < GIA_OBJ_MAX / 2 ? 2 * p->nObjsAlloc : GIA_OBJ_MAX );
     }
     if ( Vec_IntSize(&p->vHTable) ) Vec_IntPush( &p->vHash, 0 );
     return Gia_ManObj( p, p->nObjs++ );
@@ -1277,7 +1296,11 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+extern int                 Gia_FileIsGzipped( char * pFileName );
+extern char *              Gia_FileMap( char * pFileName, int * pnFileSize );
+extern void                Gia_FileUnmap( char * pContents, int nFileSize );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadGz( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
@@ -1316,6 +1339,9 @@ extern void                Cbs_ManSetConflictNum( Cbs_Man_t * p, int Num );
 extern Vec_Int_t *         Cbs_ReadModel( Cbs_Man_t * p );
 /*=== giaCTas.c ============================================================*/
 extern Vec_Int_t *         Tas_ManSolveMiterNc( Gia_Man_t * pGia, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
+/*=== giaCnfFast.c =========================================================*/
+extern void *              Gia_ManCnfFast( Gia_Man_t * p, int nOutputs, int fAddOrCla, int nProcs, int fVerbose );
+extern void                Gia_ManCnfFastDump( Gia_Man_t * p, char * pFileName, int fAddOrCla, int nProcs, int fVerbose );
 /*=== giaCof.c =============================================================*/
 extern void                Gia_ManPrintFanio( Gia_Man_t * pGia, int nNodes );
 extern Gia_Man_t *         Gia_ManDupCof( Gia_Man_t * p, int iVar );
@@ -1518,6 +1544,14 @@ extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashDualMiter( Gia_Man_t * p, Vec_Int_t * vOuts );
+/*=== giaHashMt.c ===========================================================*/
+extern Gia_HashMt_t *      Gia_ManHashMtStart( Gia_Man_t * p, int nObjsMax );
+extern int                 Gia_ManHashMtStop( Gia_HashMt_t * pHash );
+extern int                 Gia_ManHashMtAnd( Gia_HashMt_t * pHash, int iLit0, int iLit1 );
+extern Gia_Man_t *         Gia_ManHashMtNormalize( Gia_Man_t * p );
+extern Gia_Man_t *         Gia_ManRehashMt( Gia_Man_t * p, int nThreads, int fVerbose );
+/*=== giaRwr.c ==========================================================*/
+extern Gia_Man_t *         Gia_ManRewritePar( Gia_Man_t * p, int nRegionMax, int nProcs, int fUseZeros, int fVerbose );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintOutputLutStats( Gia_Man_t * p );
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
@@ -1586,6 +1620,8 @@ extern void                Gia_MmStepStop( Gia_MmStep_t * p, int fVerbose );
 extern char *              Gia_MmStepEntryFetch( Gia_MmStep_t * p, int nBytes );
 extern void                Gia_MmStepEntryRecycle( Gia_MmStep_t * p, char * pEntry, int nBytes );
 extern int                 Gia_MmStepReadMemUsage( Gia_MmStep_t * p );
+extern void                Gia_ManSetObjsMapMin( int nObjsMin );
+extern void                Gia_ManFreeObjs( Gia_Man_t * p );
 /*=== giaMf.c ===========================================================*/
 extern void                Mf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
@@ -1657,6 +1693,9 @@ extern Vec_Ptr_t *         Gia_ManArray2Sim( Vec_Wec_t * vRes );
 extern void                Gia_ManPtrWrdDumpBin( char * pFileName, Vec_Ptr_t * p, int fVerbose );
 extern Vec_Ptr_t *         Gia_ManPtrWrdReadBin( char * pFileName, int fVerbose );
 extern Vec_Str_t *         Gia_ManComputeRange( Gia_Man_t * p );
+/*=== giaSimMt.c ===========================================================*/
+extern Vec_Wrd_t *         Gia_ManSimPatSimMt( Gia_Man_t * p, Vec_Wrd_t * vSimsPi, int nThreads );
+extern void                Gia_ManSimPatSimMtInt( Gia_Man_t * p, word * pSims, int nWords, int nThreads );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -21,9 +21,17 @@
 
 #include "gia.h"
 #include "misc/tim/tim.h"
+#include "misc/zlib/zlib.h"
 #include "base/main/main.h"
 #include "map/if/if.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -32,6 +40,19 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_AIGER_GZ_CHUNK (1 << 20)   // the size of the decompression buffer
+
+// streaming reader of the gzipped AIGER file
+typedef struct Gia_AigerGz_t_ Gia_AigerGz_t;
+struct Gia_AigerGz_t_
+{
+    gzFile          pFile;             // the compressed file
+    unsigned char * pBuffer;           // decompressed chunk
+    int             nSize;             // the number of bytes in the chunk
+    int             iPos;              // the current position in the chunk
+    int             fError;            // reading past the end or zlib error
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -163,21 +184,178 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Streaming reader of the gzipped AIGER file.]
+
+  Description [Decompresses the file in fixed-size chunks, so that 
+  the AND section is decoded directly into the AIG without keeping 
+  the complete decompressed file in memory.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_AigerGz_t * Gia_AigerGzStart( char * pFileName )
+{
+    Gia_AigerGz_t * p;
+    gzFile pFile = gzopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    p = ABC_CALLOC( Gia_AigerGz_t, 1 );
+    p->pFile   = pFile;
+    p->pBuffer = ABC_ALLOC( unsigned char, GIA_AIGER_GZ_CHUNK );
+    return p;
+}
+static void Gia_AigerGzStop( Gia_AigerGz_t * p )
+{
+    gzclose( p->pFile );
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+}
+static int Gia_AigerGzRefill( Gia_AigerGz_t * p )
+{
+    assert( p->iPos == p->nSize );
+    p->iPos  = 0;
+    p->nSize = gzread( p->pFile, p->pBuffer, GIA_AIGER_GZ_CHUNK );
+    if ( p->nSize > 0 )
+        return 1;
+    if ( p->nSize < 0 )
+        p->fError = 1;
+    p->nSize = 0;
+    return 0;
+}
+static inline int Gia_AigerGzReadChar( Gia_AigerGz_t * p )
+{
+    if ( p->iPos == p->nSize && !Gia_AigerGzRefill(p) )
+        return -1;
+    return p->pBuffer[p->iPos++];
+}
+static inline unsigned Gia_AigerGzReadUnsigned( Gia_AigerGz_t * p )
+{
+    unsigned x = 0, i = 0;
+    int ch;
+    // the encoding of a 32-bit number takes at most 5 bytes
+    if ( p->iPos + 5 <= p->nSize )
+    {
+        unsigned char * pPos = p->pBuffer + p->iPos;
+        x = Gia_AigerReadUnsigned( &pPos );
+        p->iPos = pPos - p->pBuffer;
+        return x;
+    }
+    while ( (ch = Gia_AigerGzReadChar(p)) != -1 && (ch & 0x80) )
+        x |= (ch & 0x7f) << (7 * i++);
+    if ( ch == -1 )
+    {
+        p->fError = 1;
+        return 0;
+    }
+    return x | (ch << (7 * i));
+}
+// copies one line (including the new-line character) into the buffer
+static int Gia_AigerGzCopyLine( Gia_AigerGz_t * p, Vec_Str_t * vStr )
+{
+    int ch;
+    while ( (ch = Gia_AigerGzReadChar(p)) != -1 )
+    {
+        Vec_StrPush( vStr, (char)ch );
+        if ( ch == '\n' )
+            return 1;
+    }
+    return 0;
+}
+// copies one variable-length encoded number into the buffer
+static int Gia_AigerGzCopyUnsigned( Gia_AigerGz_t * p, Vec_Str_t * vStr )
+{
+    int ch;
+    while ( (ch = Gia_AigerGzReadChar(p)) != -1 )
+    {
+        Vec_StrPush( vStr, (char)ch );
+        if ( !(ch & 0x80) )
+            return 1;
+    }
+    return 0;
+}
+// copies the remaining part of the file into the buffer
+static Vec_Str_t * Gia_AigerGzReadRest( Gia_AigerGz_t * p )
+{
+    Vec_Str_t * vStr = Vec_StrAlloc( 1000 );
+    do {
+        Vec_StrPushBuffer( vStr, (char *)p->pBuffer + p->iPos, p->nSize - p->iPos );
+        p->iPos = p->nSize;
+    } while ( Gia_AigerGzRefill(p) );
+    // zero-terminate without changing the size
+    Vec_StrPush( vStr, 0 );
+    Vec_StrShrink( vStr, Vec_StrSize(vStr) - 1 );
+    return vStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the header and the output section of the gzipped file.]
+
+  Description [Returns the buffer containing the header line followed 
+  by the latch/output literals, while the stream is positioned at the 
+  beginning of the AND section.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Str_t * Gia_AigerGzReadPrefix( Gia_AigerGz_t * p )
+{
+    Vec_Str_t * vStr = Vec_StrAlloc( 1000 );
+    int nNums[9] = {0}, nOutputs, i, k;
+    char * pCur;
+    if ( !Gia_AigerGzCopyLine(p, vStr) || Vec_StrSize(vStr) < 4 )
+    {
+        Vec_StrFree( vStr );
+        return NULL;
+    }
+    Vec_StrPush( vStr, 0 );
+    // read the parameters (M I L O A + B C J F)
+    pCur = Vec_StrArray(vStr) + 3;
+    for ( k = 0; k < 9; k++ )
+    {
+        while ( *pCur == ' ' ) pCur++;
+        if ( *pCur < '0' || *pCur > '9' )
+            break;
+        nNums[k] = atoi( pCur );
+        while ( *pCur >= '0' && *pCur <= '9' ) pCur++;
+    }
+    Vec_StrPop( vStr );
+    nOutputs = nNums[2] + nNums[3] + nNums[5] + nNums[6] + nNums[7] + nNums[8];
+    for ( i = 0; i < nOutputs; i++ )
+        if ( !(Vec_StrEntry(vStr, 3) == ' ' ? Gia_AigerGzCopyLine(p, vStr) : Gia_AigerGzCopyUnsigned(p, vStr)) )
+            break;
+    if ( i < nOutputs )
+    {
+        Vec_StrFree( vStr );
+        return NULL;
+    }
+    return vStr;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [If the stream is given, the buffer contains only the header 
+  and the latch/output literals, while the AND section and the remaining
+  part of the file are read from the stream.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+static Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, int nFileSize, Gia_AigerGz_t * pGz, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
+    Vec_Str_t * vRest = NULL;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
     int iObj, iNode0, iNode1, fHieOnly = 0;
@@ -290,8 +468,18 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     for ( i = 0; i < nAnds; i++ )
     {
         uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pGz )
+        {
+            uLit1 = uLit  - Gia_AigerGzReadUnsigned( pGz );
+            uLit0 = uLit1 - Gia_AigerGzReadUnsigned( pGz );
+            if ( pGz->fError || uLit0 >= uLit )
+                break;
+        }
+        else
+        {
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -308,6 +496,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    if ( pGz && i < nAnds )
+    {
+        fprintf( stdout, "The AND section of the compressed file is corrupted.\n" );
+        Vec_IntFree( vNodes );
+        Vec_IntFreeP( &vLits );
+        Gia_ManStop( pNew );
+        return NULL;
+    }
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -375,6 +571,15 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     // create the latches
     Gia_ManSetRegNum( pNew, nLatches );
 
+    // the symbols and extensions are parsed in a separate buffer
+    if ( pGz )
+    {
+        vRest     = Gia_AigerGzReadRest( pGz );
+        pContents = Vec_StrArray( vRest );
+        nFileSize = Vec_StrSize( vRest );
+        pSymbols  = (unsigned char *)pContents;
+    }
+
     // read signal names if they are of the special type
     pCur = pSymbols;
     if ( pCur < (unsigned char *)pContents + nFileSize && *pCur != 'c' )
@@ -954,6 +1159,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
     // skipping the comments
     Vec_IntFree( vNodes );
+    Vec_StrFreeP( &vRest );
 
     // update polarity of the additional outputs
     if ( nBad || nConstr || nJust || nFair )
@@ -1191,6 +1397,112 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
   SeeAlso     []
 
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, nFileSize, NULL, fGiaSimple, fSkipStrash, fCheck );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG from the gzipped AIGER file.]
+
+  Description [The file is decompressed in chunks. Only the header, the
+  latch/output literals and the symbol/extension sections are buffered,
+  while the AND section is decoded directly into the AIG.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_FileIsGzipped( char * pFileName )
+{
+    int nLength = strlen(pFileName);
+    return nLength > 3 && !strcmp( pFileName + nLength - 3, ".gz" );
+}
+Gia_Man_t * Gia_AigerReadGz( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    Gia_Man_t * pNew = NULL;
+    Gia_AigerGz_t * p;
+    Vec_Str_t * vPrefix;
+    if ( (p = Gia_AigerGzStart( pFileName )) == NULL )
+    {
+        printf( "Gia_AigerReadGz(): Cannot open file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    vPrefix = Gia_AigerGzReadPrefix( p );
+    if ( vPrefix == NULL )
+        printf( "Gia_AigerReadGz(): The header of file \"%s\" is corrupted.\n", pFileName );
+    else
+    {
+        Vec_StrPush( vPrefix, 0 );
+        pNew = Gia_AigerReadFromMemoryInt( Vec_StrArray(vPrefix), Vec_StrSize(vPrefix)-1, p, fGiaSimple, fSkipStrash, fCheck );
+        Vec_StrFree( vPrefix );
+    }
+    Gia_AigerGzStop( p );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the uncompressed file into memory.]
+
+  Description [Returns NULL if memory mapping is not available, in which
+  case the file should be read into a buffer. The mapping is private, 
+  so the parser can modify it without changing the file. The file size 
+  should not be a multiple of the page size, which guarantees that the
+  mapped contents are followed by a zero byte.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileMap( char * pFileName, int * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size == 0 || Stat.st_size >= 0x7FFFFFFF || Stat.st_size % sysconf(_SC_PAGESIZE) == 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (int)Stat.st_size;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+void Gia_FileUnmap( char * pContents, int nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nFileSize );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [Gzipped files are decoded in the streaming mode. Other
+  files are memory-mapped when possible.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
 {
@@ -1200,20 +1512,33 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     int nFileSize;
     int RetValue;
 
-    // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    if ( Gia_FileIsGzipped( pFileName ) )
+        pNew = Gia_AigerReadGz( pFileName, fGiaSimple, fSkipStrash, fCheck );
+    else if ( (pContents = Gia_FileMap( pFileName, &nFileSize )) )
+    {
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        Gia_FileUnmap( pContents, nFileSize );
+    }
+    else
+    {
+        // read the file into the buffer
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
         pName = Gia_FileNameGeneric( pFileName );
+        if ( Gia_FileIsGzipped( pFileName ) && strrchr( pName, '.' ) )
+            *strrchr( pName, '.' ) = 0;
         pNew->pName = Abc_UtilStrsav( pName );
         ABC_FREE( pName );
 
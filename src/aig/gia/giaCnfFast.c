@@ -0,0 +1,601 @@
+/**CFile****************************************************************
+
+  FileName    [giaCnfFast.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Fast CNF generation working directly on the GIA.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaCnfFast.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+#include "bool/kit/kit.h"
+#include "sat/cnf/cnf.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_CNF_THR_MAX 64
+
+// The marking is the same as in Cnf_DeriveFastMark() and the clauses are
+// the same as in Cnf_DeriveFastClauses(), except that the GIA is used
+// without converting it into an AIG.  The clauses of the roots are derived
+// independently, so the roots are split into chunks processed by different
+// threads, each of them writing into its own buffer.  The buffers are then
+// concatenated in the order of the chunks, giving the same CNF as the one
+// produced by one thread.
+
+typedef struct Gia_CnfChunk_t_ Gia_CnfChunk_t;
+struct Gia_CnfChunk_t_
+{
+    Gia_Man_t *     p;          // the AIG (read-only, except the traversal data)
+    int *           pVarNums;   // the CNF variable for each object (read-only)
+    Vec_Int_t *     vRoots;     // the roots, for which the clauses are derived
+    int             iBeg;       // the first root of this chunk
+    int             iEnd;       // the last root of this chunk plus one
+    int *           pStamps;    // the traversal stamps of the objects
+    int *           pIndex;     // the object indexes in the cut
+    int             nStamp;     // the current traversal stamp
+    Vec_Int_t *     vLeaves;    // the leaves of the cut
+    Vec_Int_t *     vNodes;     // the nodes of the cut
+    Vec_Int_t *     vCover;     // the ISOP cover
+    Vec_Int_t *     vLits;      // the literals of the clauses
+    Vec_Int_t *     vClas;      // the beginnings of the clauses in vLits
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Detects multi-input gate rooted at this node.]
+
+  Description [The leaves are collected as literals.  If fStopCompl is 1,
+  the collection stops at the complemented edges.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCnfCollectLeaves_rec( Gia_Man_t * p, int iRoot, int iLit, Vec_Int_t * vSuper, int fStopCompl )
+{
+    int iObj = Abc_Lit2Var(iLit);
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    if ( iObj != iRoot && (pObj->fMark0 || (fStopCompl && Abc_LitIsCompl(iLit))) )
+    {
+        Vec_IntPushUnique( vSuper, fStopCompl ? iLit : Abc_LitRegular(iLit) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    if ( fStopCompl )
+    {
+        Gia_ManCnfCollectLeaves_rec( p, iRoot, Gia_ObjFaninLit0(pObj, iObj), vSuper, 1 );
+        Gia_ManCnfCollectLeaves_rec( p, iRoot, Gia_ObjFaninLit1(pObj, iObj), vSuper, 1 );
+    }
+    else
+    {
+        Gia_ManCnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(Gia_ObjFaninId0(pObj, iObj), 0), vSuper, 0 );
+        Gia_ManCnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(Gia_ObjFaninId1(pObj, iObj), 0), vSuper, 0 );
+    }
+}
+void Gia_ManCnfCollectLeaves( Gia_Man_t * p, int iRoot, Vec_Int_t * vSuper, int fStopCompl )
+{
+    Vec_IntClear( vSuper );
+    Gia_ManCnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(iRoot, 0), vSuper, fStopCompl );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects nodes inside the cone.]
+
+  Description [Uses the traversal stamps of the chunk, rather than the
+  traversal IDs of the manager, so that the chunks could be processed
+  concurrently.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCnfCollectVolume_rec( Gia_CnfChunk_t * c, int iObj )
+{
+    Gia_Obj_t * pObj;
+    if ( c->pStamps[iObj] == c->nStamp )
+        return;
+    c->pStamps[iObj] = c->nStamp;
+    pObj = Gia_ManObj( c->p, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_ManCnfCollectVolume_rec( c, Gia_ObjFaninId0(pObj, iObj) );
+    Gia_ManCnfCollectVolume_rec( c, Gia_ObjFaninId1(pObj, iObj) );
+    Vec_IntPush( c->vNodes, iObj );
+}
+void Gia_ManCnfCollectVolume( Gia_CnfChunk_t * c, int iRoot )
+{
+    int i, iLeaf;
+    c->nStamp++;
+    Vec_IntForEachEntry( c->vLeaves, iLeaf, i )
+        c->pStamps[Abc_Lit2Var(iLeaf)] = c->nStamp;
+    Vec_IntClear( c->vNodes );
+    Gia_ManCnfCollectVolume_rec( c, iRoot );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the truth table of the cut.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Gia_ManCnfCutTruth( Gia_CnfChunk_t * c )
+{
+    word Sims[256], Mask[2] = { 0, ~(word)0 };
+    Gia_Obj_t * pObj;
+    int i, iObj, nLeaves = Vec_IntSize(c->vLeaves);
+    assert( nLeaves <= 6 && Vec_IntSize(c->vNodes) > 0 );
+    assert( nLeaves + Vec_IntSize(c->vNodes) <= 256 );
+    Vec_IntForEachEntry( c->vLeaves, iObj, i )
+    {
+        c->pIndex[Abc_Lit2Var(iObj)] = i;
+        Sims[i] = s_Truths6[i];
+    }
+    Vec_IntForEachEntry( c->vNodes, iObj, i )
+    {
+        pObj = Gia_ManObj( c->p, iObj );
+        c->pIndex[iObj] = nLeaves + i;
+        Sims[nLeaves + i] = (Sims[c->pIndex[Gia_ObjFaninId0(pObj, iObj)]] ^ Mask[Gia_ObjFaninC0(pObj)]) &
+                            (Sims[c->pIndex[Gia_ObjFaninId1(pObj, iObj)]] ^ Mask[Gia_ObjFaninC1(pObj)]);
+    }
+    return Sims[nLeaves + Vec_IntSize(c->vNodes) - 1];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the clauses of one root.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManCnfObjLit( Gia_CnfChunk_t * c, int iObj, int fCompl )
+{
+    int iSatVar = c->pVarNums[iObj];
+    assert( iSatVar > 0 );
+    return iSatVar + iSatVar + fCompl;
+}
+static inline void Gia_ManCnfStartClause( Gia_CnfChunk_t * c, int Lit )
+{
+    Vec_IntPush( c->vClas, Vec_IntSize(c->vLits) );
+    Vec_IntPush( c->vLits, Lit );
+}
+void Gia_ManCnfAddCover( Gia_CnfChunk_t * c, int OutLit, word Truth )
+{
+    int i, k, Cube, RetValue;
+    RetValue = Kit_TruthIsop( (unsigned *)&Truth, Vec_IntSize(c->vLeaves), c->vCover, 0 );
+    assert( RetValue >= 0 );
+    Vec_IntForEachEntry( c->vCover, Cube, i )
+    {
+        Gia_ManCnfStartClause( c, OutLit );
+        for ( k = 0; k < Vec_IntSize(c->vLeaves); k++, Cube >>= 2 )
+        {
+            if ( (Cube & 3) == 0 )
+                continue;
+            assert( (Cube & 3) != 3 );
+            Vec_IntPush( c->vLits, Gia_ManCnfObjLit(c, Abc_Lit2Var(Vec_IntEntry(c->vLeaves, k)), (Cube&3)!=1) );
+        }
+    }
+}
+void Gia_ManCnfComputeClauses( Gia_CnfChunk_t * c, int iRoot )
+{
+    Gia_Obj_t * pObj;
+    int k, iObj, iLeaf, OutLit = Gia_ManCnfObjLit( c, iRoot, 0 );
+    word Truth;
+    assert( Gia_ManObj(c->p, iRoot)->fMark0 );
+    // detect cone
+    Gia_ManCnfCollectLeaves( c->p, iRoot, c->vLeaves, 0 );
+    Gia_ManCnfCollectVolume( c, iRoot );
+    assert( iRoot == Vec_IntEntryLast(c->vNodes) );
+    // check if this is an AND-gate
+    Vec_IntForEachEntry( c->vNodes, iObj, k )
+    {
+        pObj = Gia_ManObj( c->p, iObj );
+        if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFanin0(pObj)->fMark0 )
+            break;
+        if ( Gia_ObjFaninC1(pObj) && !Gia_ObjFanin1(pObj)->fMark0 )
+            break;
+    }
+    if ( k == Vec_IntSize(c->vNodes) )
+    {
+        Gia_ManCnfCollectLeaves( c->p, iRoot, c->vLeaves, 1 );
+        // write big clause
+        Gia_ManCnfStartClause( c, OutLit );
+        Vec_IntForEachEntry( c->vLeaves, iLeaf, k )
+            Vec_IntPush( c->vLits, Gia_ManCnfObjLit(c, Abc_Lit2Var(iLeaf), !Abc_LitIsCompl(iLeaf)) );
+        // write small clauses
+        Vec_IntForEachEntry( c->vLeaves, iLeaf, k )
+        {
+            Gia_ManCnfStartClause( c, OutLit ^ 1 );
+            Vec_IntPush( c->vLits, Gia_ManCnfObjLit(c, Abc_Lit2Var(iLeaf), Abc_LitIsCompl(iLeaf)) );
+        }
+        return;
+    }
+    assert( Vec_IntSize(c->vLeaves) <= 6 );
+    Truth = Gia_ManCnfCutTruth( c );
+    if ( Truth == 0 || Truth == ~(word)0 )
+    {
+        Gia_ManCnfStartClause( c, (Truth == 0) ? (OutLit ^ 1) : OutLit );
+        return;
+    }
+    Gia_ManCnfAddCover( c, OutLit,      Truth );
+    Gia_ManCnfAddCover( c, OutLit ^ 1, ~Truth );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the clauses of the roots in one chunk.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManCnfChunkDerive( void * pArg )
+{
+    Gia_CnfChunk_t * c = (Gia_CnfChunk_t *)pArg;
+    int i;
+    c->pStamps  = ABC_CALLOC( int, Gia_ManObjNum(c->p) );
+    c->pIndex   = ABC_ALLOC( int, Gia_ManObjNum(c->p) );
+    c->vLeaves  = Vec_IntAlloc( 100 );
+    c->vNodes   = Vec_IntAlloc( 100 );
+    c->vCover   = Vec_IntAlloc( 1 << 8 );
+    c->vLits    = Vec_IntAlloc( 8 * (c->iEnd - c->iBeg) + 16 );
+    c->vClas    = Vec_IntAlloc( 3 * (c->iEnd - c->iBeg) + 16 );
+    for ( i = c->iBeg; i < c->iEnd; i++ )
+        Gia_ManCnfComputeClauses( c, Vec_IntEntry(c->vRoots, i) );
+    ABC_FREE( c->pStamps );
+    ABC_FREE( c->pIndex );
+    Vec_IntFree( c->vLeaves );
+    Vec_IntFree( c->vNodes );
+    Vec_IntFree( c->vCover );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the roots of the cuts.]
+
+  Description [Follows Cnf_DeriveFastMark().  The roots are marked with
+  fMark0.  Assumes that the references are computed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCnfFastMark( Gia_Man_t * p )
+{
+    Vec_Int_t * vSupps, * vLeaves;
+    Gia_Obj_t * pObj, * pTemp, * pObj0, * pObj1;
+    int i, k, nFans, iLeaf;
+    vLeaves = Vec_IntAlloc( 100 );
+    vSupps  = Vec_IntStart( Gia_ManObjNum(p) );
+    // mark the constant, CIs and CO drivers
+    Gia_ManConst0(p)->fMark0 = 1;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->fMark0 = 1;
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ObjFanin0(pObj)->fMark0 = 1;
+    // mark MUX/XOR nodes
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        assert( !pObj->fMark1 );
+        if ( !Gia_ObjIsMuxType(pObj) )
+            continue;
+        pObj0 = Gia_ObjFanin0(pObj);
+        if ( pObj0->fMark1 || Gia_ObjRefNum(p, pObj0) > 1 )
+            continue;
+        pObj1 = Gia_ObjFanin1(pObj);
+        if ( pObj1->fMark1 || Gia_ObjRefNum(p, pObj1) > 1 )
+            continue;
+        // mark nodes
+        pObj->fMark1  = 1;
+        pObj0->fMark1 = 1;
+        pObj1->fMark1 = 1;
+        // mark inputs and outputs
+        pObj->fMark0 = 1;
+        Gia_ObjFanin0(pObj0)->fMark0 = 1;
+        Gia_ObjFanin1(pObj0)->fMark0 = 1;
+        Gia_ObjFanin0(pObj1)->fMark0 = 1;
+        Gia_ObjFanin1(pObj1)->fMark0 = 1;
+    }
+    // mark nodes with multiple fanouts and pointed to by complemented edges
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( Gia_ObjRefNum(p, pObj) > 1 )
+            pObj->fMark0 = 1;
+        if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFanin0(pObj)->fMark1 )
+            Gia_ObjFanin0(pObj)->fMark0 = 1;
+        if ( Gia_ObjFaninC1(pObj) && !Gia_ObjFanin1(pObj)->fMark1 )
+            Gia_ObjFanin1(pObj)->fMark0 = 1;
+    }
+    // compute supergate size for internal marked nodes
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( !pObj->fMark0 )
+            continue;
+        if ( pObj->fMark1 )
+        {
+            if ( !Gia_ObjIsMuxType(pObj) )
+                continue;
+            Gia_ObjRecognizeMux( pObj, &pObj1, &pObj0 );
+            pObj0 = Gia_Regular(pObj0);
+            pObj1 = Gia_Regular(pObj1);
+            assert( pObj0->fMark0 );
+            assert( pObj1->fMark0 );
+            nFans = 1 + (pObj0 == pObj1);
+            if ( !pObj0->fMark1 && !Gia_ObjIsCi(pObj0) && Gia_ObjRefNum(p, pObj0) == nFans && Vec_IntEntry(vSupps, Gia_ObjId(p, pObj0)) < 3 )
+            {
+                pObj0->fMark0 = 0;
+                continue;
+            }
+            if ( !pObj1->fMark1 && !Gia_ObjIsCi(pObj1) && Gia_ObjRefNum(p, pObj1) == nFans && Vec_IntEntry(vSupps, Gia_ObjId(p, pObj1)) < 3 )
+            {
+                pObj1->fMark0 = 0;
+                continue;
+            }
+            continue;
+        }
+        Gia_ManCnfCollectLeaves( p, i, vLeaves, 1 );
+        Vec_IntWriteEntry( vSupps, i, Vec_IntSize(vLeaves) );
+        if ( Vec_IntSize(vLeaves) >= 6 )
+            continue;
+        Vec_IntForEachEntry( vLeaves, iLeaf, k )
+        {
+            pTemp = Gia_ManObj( p, Abc_Lit2Var(iLeaf) );
+            assert( pTemp->fMark0 );
+            if ( pTemp->fMark1 || !Gia_ObjIsAnd(pTemp) || Gia_ObjRefNum(p, pTemp) > 1 )
+                continue;
+            assert( Vec_IntEntry(vSupps, Abc_Lit2Var(iLeaf)) > 0 );
+            if ( Vec_IntSize(vLeaves) - 1 + Vec_IntEntry(vSupps, Abc_Lit2Var(iLeaf)) > 6 )
+                continue;
+            pTemp->fMark0 = 0;
+            Vec_IntWriteEntry( vSupps, i, 6 );
+            break;
+        }
+    }
+    Gia_ManForEachObj( p, pObj, i )
+        pObj->fMark1 = 0;
+    Vec_IntFree( vLeaves );
+    Vec_IntFree( vSupps );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the clauses of all chunks.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCnfDeriveChunks( Gia_CnfChunk_t * pChunks, int nChunks )
+{
+    Util_Task_t * pTasks[GIA_CNF_THR_MAX];
+    int i;
+    assert( nChunks >= 1 && nChunks <= GIA_CNF_THR_MAX );
+    if ( nChunks == 1 )
+    {
+        Gia_ManCnfChunkDerive( pChunks );
+        return;
+    }
+    // the calling thread helps with the chunks while waiting
+    Util_PoolReserve( nChunks - 1 );
+    for ( i = 0; i < nChunks; i++ )
+        pTasks[i] = Util_TaskSubmit( Gia_ManCnfChunkDerive, (void *)(pChunks + i), 0 );
+    for ( i = 0; i < nChunks; i++ )
+    {
+        Util_TaskWait( pTasks[i] );
+        Util_TaskFree( pTasks[i] );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Fast CNF computation for the GIA.]
+
+  Description [Produces the same CNF as Cnf_DeriveFast() for the AIG
+  derived by Gia_ManToAigSimple(), without deriving this AIG.  The CNF
+  variables are mapped using the object IDs of the GIA.  The literals of
+  all clauses are stored in one array (pCnf->pClauses[0]), which can be
+  passed to the solvers clause by clause without copying.  If fAddOrCla
+  is 1, the clause asserting that one of the outputs is true is added.
+  The clauses are derived by nProcs threads, if pthreads are available.
+  Similar to Cnf_DeriveFast(), which is only used by "write_cnf -f",
+  this generator is only used for writing the CNF ("&write_cnf -f").
+  The SAT-based engines load the clauses of the nodes incrementally or
+  use the smaller CNF computed by Mf_ManGenerateCnf().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_ManCnfFast( Gia_Man_t * p, int nOutputs, int fAddOrCla, int nProcs, int fVerbose )
+{
+    Gia_CnfChunk_t Chunks[GIA_CNF_THR_MAX];
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vRoots;
+    Gia_Obj_t * pObj;
+    int * pVarNums, * pLits;
+    int i, k, nVars, nLits, nClas, OutLit, DriLit;
+    abctime clk = Abc_Clock();
+    assert( Gia_ManBufNum(p) == 0 && !Gia_ManHasChoices(p) && p->pMuxes == NULL );
+    assert( !fAddOrCla || (Gia_ManRegNum(p) == 0 && nOutputs == Gia_ManCoNum(p)) );
+    // mark the roots
+    Gia_ManCleanMark01( p );
+    ABC_FREE( p->pRefs );
+    Gia_ManCreateRefs( p );
+    Gia_ManCnfFastMark( p );
+    ABC_FREE( p->pRefs );
+    // assign variables for the outputs
+    pVarNums = ABC_FALLOC( int, Gia_ManObjNum(p) );
+    nVars = 1;
+    if ( nOutputs )
+    {
+        if ( Gia_ManRegNum(p) == 0 )
+        {
+            assert( nOutputs == Gia_ManCoNum(p) );
+            Gia_ManForEachCo( p, pObj, i )
+                pVarNums[Gia_ObjId(p, pObj)] = nVars++;
+        }
+        else
+        {
+            assert( nOutputs == Gia_ManRegNum(p) );
+            Gia_ManForEachRi( p, pObj, i )
+                pVarNums[Gia_ObjId(p, pObj)] = nVars++;
+        }
+    }
+    // assign variables to the internal nodes
+    vRoots = Vec_IntAlloc( Gia_ManAndNum(p) );
+    Gia_ManForEachAndReverse( p, pObj, i )
+        if ( pObj->fMark0 )
+        {
+            pVarNums[i] = nVars++;
+            Vec_IntPush( vRoots, i );
+        }
+    // assign variables to the CIs and constant node
+    Gia_ManForEachCi( p, pObj, i )
+        pVarNums[Gia_ObjId(p, pObj)] = nVars++;
+    pVarNums[0] = nVars++;
+    // derive the clauses of the roots
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(Abc_MinInt(nProcs, GIA_CNF_THR_MAX), Vec_IntSize(vRoots) / 1000) );
+    memset( Chunks, 0, sizeof(Gia_CnfChunk_t) * nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Chunks[i].p        = p;
+        Chunks[i].pVarNums = pVarNums;
+        Chunks[i].vRoots   = vRoots;
+        Chunks[i].iBeg     = (int)((word)Vec_IntSize(vRoots) * i / nProcs);
+        Chunks[i].iEnd     = (int)((word)Vec_IntSize(vRoots) * (i+1) / nProcs);
+    }
+    Gia_ManCnfDeriveChunks( Chunks, nProcs );
+    Gia_ManCleanMark0( p );
+    // allocate the CNF
+    nLits = 1 + 5 * Gia_ManCoNum(p);
+    nClas = 2 + 2 * Gia_ManCoNum(p);
+    for ( i = 0; i < nProcs; i++ )
+    {
+        nLits += Vec_IntSize( Chunks[i].vLits );
+        nClas += Vec_IntSize( Chunks[i].vClas );
+    }
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->nVars     = nVars;
+    pCnf->pClauses  = ABC_ALLOC( int *, nClas + 1 );
+    pCnf->pClauses[0] = pLits = ABC_ALLOC( int, nLits );
+    pCnf->pVarNums  = pVarNums;
+    // copy the clauses of the roots
+    for ( i = 0; i < nProcs; i++ )
+    {
+        for ( k = 0; k < Vec_IntSize(Chunks[i].vClas); k++ )
+            pCnf->pClauses[pCnf->nClauses++] = pLits + pCnf->nLiterals + Vec_IntEntry(Chunks[i].vClas, k);
+        memcpy( pLits + pCnf->nLiterals, Vec_IntArray(Chunks[i].vLits), sizeof(int) * Vec_IntSize(Chunks[i].vLits) );
+        pCnf->nLiterals += Vec_IntSize( Chunks[i].vLits );
+        Vec_IntFree( Chunks[i].vLits );
+        Vec_IntFree( Chunks[i].vClas );
+    }
+    // create clauses for the outputs
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        DriLit = Abc_Var2Lit( pVarNums[Gia_ObjFaninId0p(p, pObj)], Gia_ObjFaninC0(pObj) );
+        if ( i < Gia_ManCoNum(p) - nOutputs )
+        {
+            pCnf->pClauses[pCnf->nClauses++] = pLits + pCnf->nLiterals;
+            pLits[pCnf->nLiterals++] = DriLit;
+        }
+        else
+        {
+            OutLit = Abc_Var2Lit( pVarNums[Gia_ObjId(p, pObj)], 0 );
+            // first clause
+            pCnf->pClauses[pCnf->nClauses++] = pLits + pCnf->nLiterals;
+            pLits[pCnf->nLiterals++] = OutLit;
+            pLits[pCnf->nLiterals++] = DriLit ^ 1;
+            // second clause
+            pCnf->pClauses[pCnf->nClauses++] = pLits + pCnf->nLiterals;
+            pLits[pCnf->nLiterals++] = OutLit ^ 1;
+            pLits[pCnf->nLiterals++] = DriLit;
+        }
+    }
+    // write the constant literal
+    pCnf->pClauses[pCnf->nClauses++] = pLits + pCnf->nLiterals;
+    pLits[pCnf->nLiterals++] = Abc_Var2Lit( pVarNums[0], 1 );
+    // write the output clause
+    if ( fAddOrCla )
+    {
+        pCnf->pClauses[pCnf->nClauses++] = pLits + pCnf->nLiterals;
+        Gia_ManForEachCo( p, pObj, i )
+            pLits[pCnf->nLiterals++] = Abc_Var2Lit( pVarNums[Gia_ObjId(p, pObj)], 0 );
+    }
+    assert( pCnf->nClauses <= nClas && pCnf->nLiterals <= nLits );
+    pCnf->pClauses[pCnf->nClauses] = pLits + pCnf->nLiterals;
+    if ( fVerbose )
+    {
+        printf( "Fast CNF: Roots = %d. Threads = %d.  ", Vec_IntSize(vRoots), nProcs );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_IntFree( vRoots );
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the CNF derived by the fast generator into a file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCnfFastDump( Gia_Man_t * p, char * pFileName, int fAddOrCla, int nProcs, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Gia_ManCnfFast( p, Gia_ManCoNum(p), fAddOrCla, nProcs, fVerbose );
+    Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
+    printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    Cnf_DataFree( pCnf );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,187 @@
+/**CFile****************************************************************
+
+  FileName    [giaCutMerge.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Merging and filtering of cuts with ordered leaves.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaCutMerge.h,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__aig__gia__giaCutMerge_h
+#define ABC__aig__gia__giaCutMerge_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+ABC_NAMESPACE_HEADER_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// These procedures are shared by the priority-cut mappers (&mf, &nf, &jf).
+// A cut is given by its leaves (object IDs sorted in increasing order) and
+// their number. The signature of a cut has one bit per leaf (leaf ID mod 64)
+// and is used to reject pairs of cuts before merging their leaves.
+
+// counts the number of ones in the signature
+static inline int Gia_CutMrgBitCount( word i )
+{
+    i = i - ((i >> 1) & ABC_CONST(0x5555555555555555));
+    i = (i & ABC_CONST(0x3333333333333333)) + ((i >> 2) & ABC_CONST(0x3333333333333333));
+    i = ((i + (i >> 4)) & ABC_CONST(0x0F0F0F0F0F0F0F0F));
+    return (i*(ABC_CONST(0x0101010101010101)))>>56;
+}
+// computes the signature of the leaves
+static inline word Gia_CutMrgSign( int * pLeaves, int nLeaves )
+{
+    word Sign = 0; int i;
+    for ( i = 0; i < nLeaves; i++ )
+        Sign |= ((word)1) << (pLeaves[i] & 0x3F);
+    return Sign;
+}
+// returns 1 if the merged cut is known to have more than nLutSize leaves;
+// the bit count is skipped when the sizes alone show that the cut fits
+static inline int Gia_CutMrgFilter( word Sign, int nSizeSum, int nLutSize )
+{
+    return nSizeSum > nLutSize && Gia_CutMrgBitCount(Sign) > nLutSize;
+}
+
+// merges two cuts; returns the number of leaves or -1 if there are too many
+static inline int Gia_CutMrgOrder( int * pC0, int nSize0, int * pC1, int nSize1, int * pC, int nLutSize )
+{
+    int i, k, c;
+    // the case of the largest cut sizes
+    if ( nSize0 == nLutSize && nSize1 == nLutSize )
+    {
+        for ( i = 0; i < nSize0; i++ )
+        {
+            if ( pC0[i] != pC1[i] )  return -1;
+            pC[i] = pC0[i];
+        }
+        return nLutSize;
+    }
+    // compare two cuts with different numbers
+    i = k = c = 0;
+    if ( nSize0 == 0 ) goto FlushCut1;
+    if ( nSize1 == 0 ) goto FlushCut0;
+    while ( 1 )
+    {
+        if ( c == nLutSize ) return -1;
+        if ( pC0[i] < pC1[k] )
+        {
+            pC[c++] = pC0[i++];
+            if ( i >= nSize0 ) goto FlushCut1;
+        }
+        else if ( pC0[i] > pC1[k] )
+        {
+            pC[c++] = pC1[k++];
+            if ( k >= nSize1 ) goto FlushCut0;
+        }
+        else
+        {
+            pC[c++] = pC0[i++]; k++;
+            if ( i >= nSize0 ) goto FlushCut1;
+            if ( k >= nSize1 ) goto FlushCut0;
+        }
+    }
+
+FlushCut0:
+    if ( c + nSize0 > nLutSize + i ) return -1;
+    while ( i < nSize0 )
+        pC[c++] = pC0[i++];
+    return c;
+
+FlushCut1:
+    if ( c + nSize1 > nLutSize + k ) return -1;
+    while ( k < nSize1 )
+        pC[c++] = pC1[k++];
+    return c;
+}
+// merges three cuts; returns the number of leaves or -1 if there are too many
+static inline int Gia_CutMrgOrder3( int * pC0, int nSize0, int * pC1, int nSize1, int * pC2, int nSize2, int * pC, int nLutSize )
+{
+    int x0, i0 = 0;
+    int x1, i1 = 0;
+    int x2, i2 = 0;
+    int xMin, c = 0;
+    while ( 1 )
+    {
+        x0 = (i0 == nSize0) ? ABC_INFINITY : pC0[i0];
+        x1 = (i1 == nSize1) ? ABC_INFINITY : pC1[i1];
+        x2 = (i2 == nSize2) ? ABC_INFINITY : pC2[i2];
+        xMin = Abc_MinInt( Abc_MinInt(x0, x1), x2 );
+        if ( xMin == ABC_INFINITY ) break;
+        if ( c == nLutSize ) return -1;
+        pC[c++] = xMin;
+        if (x0 == xMin) i0++;
+        if (x1 == xMin) i1++;
+        if (x2 == xMin) i2++;
+    }
+    return c;
+}
+// returns 1 if the leaves of the cut (pCut) are contained in those of the base (pBase);
+// the caller is expected to check the sizes and signatures first
+static inline int Gia_CutMrgIsContained( int * pBase, int nSizeB, int * pCut, int nSizeC )
+{
+    int i, k;
+    if ( nSizeB == nSizeC )
+    {
+        for ( i = 0; i < nSizeB; i++ )
+            if ( pBase[i] != pCut[i] )
+                return 0;
+        return 1;
+    }
+    assert( nSizeB > nSizeC );
+    if ( nSizeC == 0 )
+        return 1;
+    for ( i = k = 0; i < nSizeB; i++ )
+    {
+        if ( pBase[i] > pCut[k] )
+            return 0;
+        if ( pBase[i] == pCut[k] )
+        {
+            if ( ++k == nSizeC )
+                return 1;
+        }
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,470 @@
+/**CFile****************************************************************
+
+  FileName    [giaHashMt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent structural hashing.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaHashMt.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#elif !defined(_WIN32)
+#include <stdatomic.h>
+#else
+// MSVC doesn't have stdatomic.h, use Interlocked functions instead
+#include <windows.h>
+#define atomic_int volatile LONG
+#define atomic_store_explicit(obj, val, order) InterlockedExchange((LONG*)obj, val)
+#define atomic_load_explicit(obj, order) (*(volatile LONG*)obj)
+#define atomic_fetch_add(obj, val) InterlockedExchangeAdd((LONG*)obj, val)
+#define atomic_compare_exchange_strong(obj, expected, desired) \
+    (InterlockedCompareExchange((LONG*)obj, desired, *expected) == *expected ? \
+     (*expected = desired, 1) : (*expected = *(volatile LONG*)obj, 0))
+#define memory_order_relaxed 0
+#define memory_order_acquire 0
+#define memory_order_release 0
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_HASH_MT_EMPTY  0         // the table entry is empty
+#define GIA_HASH_MT_BUSY  -1         // the object is being created
+#define GIA_HASH_MT_DEAD  -2         // the object could not be created
+#define GIA_HASH_MT_MAX   (1 << 29)  // the largest number of objects
+
+// concurrent structural hashing table
+struct Gia_HashMt_t_
+{
+    Gia_Man_t *     pGia;        // the AIG manager
+    int             nObjsMax;    // the number of preallocated objects
+    int             nTableMask;  // the table size minus one
+    atomic_int *    pTable;      // open-addressing table of object IDs
+    atomic_int      nObjs;       // the number of claimed objects
+    atomic_int      fOverflow;   // the preallocated storage is exhausted
+};
+
+// data of one worker duplicating a range of combinational outputs
+typedef struct Gia_RehashMt_t_ Gia_RehashMt_t;
+struct Gia_RehashMt_t_
+{
+    Gia_Man_t *     p;           // the original AIG
+    Gia_HashMt_t *  pHash;       // the shared table
+    atomic_int *    pCopies;     // shared copies of the original objects
+    int             iCoStart;    // the first output
+    int             iCoStop;     // the last output plus one
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the place where this node is stored (or should be stored).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashMtOne( int iLit0, int iLit1, int TableMask )
+{
+    unsigned Key = 0;
+    Key += Abc_Lit2Var(iLit0) * 7937;
+    Key += Abc_Lit2Var(iLit1) * 2971;
+    Key += Abc_LitIsCompl(iLit0) * 911;
+    Key += Abc_LitIsCompl(iLit1) * 353;
+    Key ^= Key >> 15;
+    Key *= 0x2c1b3c6d;
+    Key ^= Key >> 12;
+    return (int)(Key & TableMask);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the concurrent hash table.]
+
+  Description [Preallocates the storage for nObjsMax objects, so that the
+  object array is never reallocated while the workers are adding nodes.
+  The AIG should not have the serial hash table, MUXes or fanouts.
+  The table is kept at most half full and has at most 2^30 entries,
+  so the number of objects is limited to GIA_HASH_MT_MAX.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_HashMt_t * Gia_ManHashMtStart( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_HashMt_t * pHash;
+    Gia_Obj_t * pObj;
+    int i, nTableSize = 1;
+    assert( Vec_IntSize(&p->vHTable) == 0 );
+    assert( p->pMuxes == NULL && p->pFanData == NULL );
+    assert( !p->fSweeper && !p->fBuiltInSim && p->vSuppWords == NULL );
+    nObjsMax = Abc_MaxInt( nObjsMax, Gia_ManObjNum(p) );
+    assert( nObjsMax <= GIA_OBJ_MAX && nObjsMax <= GIA_HASH_MT_MAX );
+    if ( p->nObjsAlloc < nObjsMax )
+        Gia_ManGrowObjs( p, nObjsMax );
+    while ( nTableSize / 2 < nObjsMax )
+        nTableSize <<= 1;
+    pHash = ABC_CALLOC( Gia_HashMt_t, 1 );
+    pHash->pGia       = p;
+    pHash->nObjsMax   = nObjsMax;
+    pHash->nTableMask = nTableSize - 1;
+    pHash->pTable     = (atomic_int *)ABC_CALLOC( int, nTableSize );
+    atomic_store_explicit( &pHash->nObjs, Gia_ManObjNum(p), memory_order_relaxed );
+    atomic_store_explicit( &pHash->fOverflow, 0, memory_order_relaxed );
+    // add the nodes already present in the AIG
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        int Key = Gia_ManHashMtOne( Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), pHash->nTableMask );
+        while ( atomic_load_explicit(&pHash->pTable[Key], memory_order_relaxed) != GIA_HASH_MT_EMPTY )
+            Key = (Key + 1) & pHash->nTableMask;
+        atomic_store_explicit( &pHash->pTable[Key], i, memory_order_relaxed );
+    }
+    return pHash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the concurrent hash table.]
+
+  Description [Returns 0 if some of the nodes could not be created
+  because the preallocated storage was exhausted. In this case, the
+  AIG is incomplete and should be discarded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashMtStop( Gia_HashMt_t * pHash )
+{
+    int fOverflow = atomic_load_explicit( &pHash->fOverflow, memory_order_acquire );
+    pHash->pGia->nObjs = Abc_MinInt( atomic_load_explicit(&pHash->nObjs, memory_order_acquire), pHash->nObjsMax );
+    ABC_FREE( pHash->pTable );
+    ABC_FREE( pHash );
+    return !fOverflow;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or creates the AND node.]
+
+  Description [Can be called concurrently from several threads. The new
+  node is created by claiming the empty table entry using CAS, appending
+  the object to the preallocated storage, and publishing its ID. Other
+  threads probing the same entry wait until the ID is published.
+  Returns -1 if the preallocated storage is exhausted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashMtAnd( Gia_HashMt_t * pHash, int iLit0, int iLit1 )
+{
+    Gia_Man_t * p = pHash->pGia;
+    int Key, iThis, iObj;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    for ( Key = Gia_ManHashMtOne( iLit0, iLit1, pHash->nTableMask ); ; Key = (Key + 1) & pHash->nTableMask )
+    {
+        iThis = atomic_load_explicit( &pHash->pTable[Key], memory_order_acquire );
+        if ( iThis == GIA_HASH_MT_EMPTY )
+        {
+            int Expected = GIA_HASH_MT_EMPTY;
+            if ( atomic_compare_exchange_strong( &pHash->pTable[Key], &Expected, GIA_HASH_MT_BUSY ) )
+            {
+                Gia_Obj_t * pObj;
+                iObj = atomic_fetch_add( &pHash->nObjs, 1 );
+                if ( iObj >= pHash->nObjsMax )
+                {
+                    atomic_store_explicit( &pHash->fOverflow, 1, memory_order_release );
+                    atomic_store_explicit( &pHash->pTable[Key], GIA_HASH_MT_DEAD, memory_order_release );
+                    return -1;
+                }
+                pObj = p->pObjs + iObj; // p->nObjs is updated when the table is stopped
+                pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(iLit0));
+                pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+                pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(iLit1));
+                pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+                atomic_store_explicit( &pHash->pTable[Key], iObj, memory_order_release );
+                return Abc_Var2Lit( iObj, 0 );
+            }
+            iThis = Expected;
+        }
+        while ( iThis == GIA_HASH_MT_BUSY )
+            iThis = atomic_load_explicit( &pHash->pTable[Key], memory_order_acquire );
+        if ( iThis == GIA_HASH_MT_DEAD )
+            continue;
+        if ( Gia_ObjFaninLit0(p->pObjs + iThis, iThis) == iLit0 && Gia_ObjFaninLit1(p->pObjs + iThis, iThis) == iLit1 )
+            return Abc_Var2Lit( iThis, 0 );
+    }
+    assert( 0 );
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deterministically renumbers the AIG.]
+
+  Description [The order of nodes created concurrently depends on thread
+  scheduling. This procedure computes order-independent structural keys
+  of the nodes and performs DFS from the COs, visiting the fanins in the
+  order of their keys. As a result, the AIG is renumbered identically
+  irrespective of the number of threads and their interleaving. Dangling
+  nodes are removed. The DFS uses an explicit stack, so that deep AIGs
+  do not overflow the stack of the calling thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_ManHashMtKeyMix( word Key )
+{
+    Key ^= Key >> 33;
+    Key *= ABC_CONST(0xff51afd7ed558ccd);
+    Key ^= Key >> 33;
+    Key *= ABC_CONST(0xc4ceb9fe1a85ec53);
+    Key ^= Key >> 33;
+    return Key;
+}
+static inline word Gia_ManHashMtKeyLit( word * pKeys, int iLit )
+{
+    return Abc_LitIsCompl(iLit) ? Gia_ManHashMtKeyMix(~pKeys[Abc_Lit2Var(iLit)]) : pKeys[Abc_Lit2Var(iLit)];
+}
+void Gia_ManHashMtNormalizeCone( Gia_Man_t * pNew, Gia_Man_t * p, word * pKeys, Vec_Int_t * vStack, int iRoot )
+{
+    Gia_Obj_t * pObj;
+    int iObj, iFirst, iSecond;
+    Vec_IntClear( vStack );
+    Vec_IntPush( vStack, iRoot );
+    while ( Vec_IntSize(vStack) > 0 )
+    {
+        iObj = Vec_IntEntryLast( vStack );
+        pObj = Gia_ManObj( p, iObj );
+        if ( ~pObj->Value )
+        {
+            Vec_IntPop( vStack );
+            continue;
+        }
+        assert( Gia_ObjIsAnd(pObj) );
+        iFirst  = Gia_ObjFaninId0( pObj, iObj );
+        iSecond = Gia_ObjFaninId1( pObj, iObj );
+        if ( Gia_ManHashMtKeyLit(pKeys, Gia_ObjFaninLit0(pObj, iObj)) > Gia_ManHashMtKeyLit(pKeys, Gia_ObjFaninLit1(pObj, iObj)) )
+            iFirst ^= iSecond, iSecond ^= iFirst, iFirst ^= iSecond;
+        if ( !~Gia_ManObj(p, iFirst)->Value )
+        {
+            Vec_IntPush( vStack, iFirst );
+            continue;
+        }
+        if ( !~Gia_ManObj(p, iSecond)->Value )
+        {
+            Vec_IntPush( vStack, iSecond );
+            continue;
+        }
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        Vec_IntPop( vStack );
+    }
+}
+Gia_Man_t * Gia_ManHashMtNormalize( Gia_Man_t * p )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vStack;
+    word * pKeys = ABC_ALLOC( word, Gia_ManObjNum(p) );
+    int i;
+    // compute the structural keys
+    pKeys[0] = Gia_ManHashMtKeyMix( 1 );
+    Gia_ManForEachCi( p, pObj, i )
+        pKeys[Gia_ObjId(p, pObj)] = Gia_ManHashMtKeyMix( (word)(i + 2) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        word Key0 = Gia_ManHashMtKeyLit( pKeys, Gia_ObjFaninLit0(pObj, i) );
+        word Key1 = Gia_ManHashMtKeyLit( pKeys, Gia_ObjFaninLit1(pObj, i) );
+        if ( Key0 > Key1 )
+            Key0 ^= Key1, Key1 ^= Key0, Key0 ^= Key1;
+        pKeys[i] = Gia_ManHashMtKeyMix( Key0 * ABC_CONST(0x9E3779B97F4A7C15) + Key1 );
+    }
+    // duplicate in the DFS order
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashAlloc( pNew );
+    vStack = Vec_IntAlloc( 1000 );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManHashMtNormalizeCone( pNew, p, pKeys, vStack, Gia_ObjFaninId0p(p, pObj) );
+    Vec_IntFree( vStack );
+    Gia_ManHashStop( pNew );
+    Gia_ManForEachCo( p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    ABC_FREE( pKeys );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs concurrent structural hashing.]
+
+  Description [The outputs are divided into groups, whose logic cones
+  are duplicated by several threads into the same AIG. The copies of
+  the shared logic are also shared among the threads. The cones are
+  traversed using an explicit stack rather than recursion, because the
+  worker threads have small stacks and the AIG may be deep. The number
+  of threads (nThreads) does not include the calling thread, which only
+  waits for the workers, so two threads give two concurrent workers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManRehashMtCone( Gia_RehashMt_t * p, Vec_Int_t * vStack, int iRoot )
+{
+    Gia_Obj_t * pObj;
+    int iObj, iFan0, iFan1, iLit0, iLit1, iLit;
+    Vec_IntClear( vStack );
+    Vec_IntPush( vStack, iRoot );
+    while ( Vec_IntSize(vStack) > 0 )
+    {
+        iObj = Vec_IntEntryLast( vStack );
+        if ( atomic_load_explicit(&p->pCopies[iObj], memory_order_relaxed) >= 0 )
+        {
+            Vec_IntPop( vStack );
+            continue;
+        }
+        pObj  = Gia_ManObj( p->p, iObj );
+        assert( Gia_ObjIsAnd(pObj) );
+        iFan0 = Gia_ObjFaninId0( pObj, iObj );
+        iFan1 = Gia_ObjFaninId1( pObj, iObj );
+        iLit0 = atomic_load_explicit( &p->pCopies[iFan0], memory_order_relaxed );
+        if ( iLit0 < 0 )
+        {
+            Vec_IntPush( vStack, iFan0 );
+            continue;
+        }
+        iLit1 = atomic_load_explicit( &p->pCopies[iFan1], memory_order_relaxed );
+        if ( iLit1 < 0 )
+        {
+            Vec_IntPush( vStack, iFan1 );
+            continue;
+        }
+        iLit = Gia_ManHashMtAnd( p->pHash, Abc_LitNotCond(iLit0, Gia_ObjFaninC0(pObj)), Abc_LitNotCond(iLit1, Gia_ObjFaninC1(pObj)) );
+        if ( iLit == -1 )
+            return -1;
+        atomic_store_explicit( &p->pCopies[iObj], iLit, memory_order_relaxed );
+        Vec_IntPop( vStack );
+    }
+    return atomic_load_explicit( &p->pCopies[iRoot], memory_order_relaxed );
+}
+int Gia_ManRehashMtWorker( void * pArg )
+{
+    Gia_RehashMt_t * p = (Gia_RehashMt_t *)pArg;
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    int i;
+    for ( i = p->iCoStart; i < p->iCoStop; i++ )
+        if ( Gia_ManRehashMtCone( p, vStack, Gia_ObjFaninId0p(p->p, Gia_ManCo(p->p, i)) ) == -1 )
+            break;
+    Vec_IntFree( vStack );
+    return 1;
+}
+Gia_Man_t * Gia_ManRehashMt( Gia_Man_t * p, int nThreads, int fVerbose )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Gia_HashMt_t * pHash;
+    Gia_RehashMt_t * pData;
+    Gia_Obj_t * pObj;
+    Vec_Ptr_t * vData;
+    atomic_int * pCopies;
+    int i, nParts, nPartSize, RetValue;
+    abctime clk = Abc_Clock();
+    if ( p->pMuxes || Gia_ManBufNum(p) || Gia_ManObjNum(p) > GIA_HASH_MT_MAX )
+        return Gia_ManRehash( p, 0 );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    // map constant and CIs
+    pCopies = (atomic_int *)ABC_FALLOC( int, Gia_ManObjNum(p) );
+    atomic_store_explicit( &pCopies[0], 0, memory_order_relaxed );
+    Gia_ManForEachCi( p, pObj, i )
+        atomic_store_explicit( &pCopies[Gia_ObjId(p, pObj)], Gia_ManAppendCi(pNew), memory_order_relaxed );
+    // divide the outputs into groups, several groups per thread to balance the load
+    nParts    = Abc_MinInt( 4 * Abc_MaxInt(nThreads, 1), Abc_MaxInt(Gia_ManCoNum(p), 1) );
+    nPartSize = Abc_MaxInt( 1, (Gia_ManCoNum(p) + nParts - 1) / nParts );
+    pData = ABC_CALLOC( Gia_RehashMt_t, nParts );
+    vData = Vec_PtrAlloc( nParts );
+    pHash = Gia_ManHashMtStart( pNew, Gia_ManObjNum(p) );
+    for ( i = 0; i < nParts; i++ )
+    {
+        pData[i].p        = p;
+        pData[i].pHash    = pHash;
+        pData[i].pCopies  = pCopies;
+        pData[i].iCoStart = Abc_MinInt( i * nPartSize, Gia_ManCoNum(p) );
+        pData[i].iCoStop  = Abc_MinInt( (i + 1) * nPartSize, Gia_ManCoNum(p) );
+        Vec_PtrPush( vData, pData + i );
+    }
+    Util_ProcessThreads( Gia_ManRehashMtWorker, vData, nThreads + 1, 0, fVerbose );
+    RetValue = Gia_ManHashMtStop( pHash );
+    assert( RetValue ); // rehashing cannot increase the number of nodes
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Abc_LitNotCond(atomic_load_explicit(&pCopies[Gia_ObjFaninId0p(p, pObj)], memory_order_relaxed), Gia_ObjFaninC0(pObj)) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    Vec_PtrFree( vData );
+    ABC_FREE( pData );
+    ABC_FREE( pCopies );
+    if ( fVerbose )
+    {
+        printf( "Concurrent strashing with %d threads created %d nodes.  ", nThreads, Gia_ManAndNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // renumber the nodes independently of the thread interleaving
+    pNew = Gia_ManHashMtNormalize( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -22,6 +22,7 @@
 #include "misc/vec/vecSet.h"
 #include "misc/vec/vecMem.h"
 #include "misc/extra/extra.h"
+#include "giaCutMerge.h"
 #include "bool/kit/kit.h"
 #include "misc/util/utilTruth.h"
 #include "opt/dau/dau.h"
@@ -477,13 +478,6 @@ static inline int Jf_CountBits32( unsigned i )
     i = ((i + (i >> 4)) & 0x0F0F0F0F);
     return (i*(0x01010101))>>24;
 }
-static inline int Jf_CountBits( word i )
-{
-    i = i - ((i >> 1) & 0x5555555555555555);
-    i = (i & 0x3333333333333333) + ((i >> 2) & 0x3333333333333333);
-    i = ((i + (i >> 4)) & 0x0F0F0F0F0F0F0F0F);
-    return (i*(0x0101010101010101))>>56;
-}
 static inline unsigned Jf_CutGetSign32( int * pCut )
 {
     unsigned Sign = 0; int i; 
@@ -553,86 +547,14 @@ static inline float Jf_CutFlow( Jf_Man_t * p, int * pCut )
 ***********************************************************************/
 static inline int Jf_CutIsContainedOrder( int * pBase, int * pCut ) // check if pCut is contained pBase
 {
-    int nSizeB = Jf_CutSize(pBase);
-    int nSizeC = Jf_CutSize(pCut);
-    int i, k;
-    if ( nSizeB == nSizeC )
-    {
-        for ( i = 1; i <= nSizeB; i++ )
-            if ( pBase[i] != pCut[i] )
-                return 0;
-        return 1;
-    }
-    assert( nSizeB > nSizeC ); 
-    for ( i = k = 1; i <= nSizeB; i++ )
-    {
-        if ( pBase[i] > pCut[k] )
-            return 0;
-        if ( pBase[i] == pCut[k] )
-        {
-            if ( k++ == nSizeC )
-                return 1;
-        }
-    }
-    return 0;
+    return Gia_CutMrgIsContained( pBase + 1, Jf_CutSize(pBase), pCut + 1, Jf_CutSize(pCut) );
 }
 static inline int Jf_CutMergeOrder( int * pCut0, int * pCut1, int * pCut, int LutSize )
 { 
-    int nSize0 = Jf_CutSize(pCut0);
-    int nSize1 = Jf_CutSize(pCut1);
-    int * pC0 = pCut0 + 1;
-    int * pC1 = pCut1 + 1;
-    int * pC = pCut + 1;
-    int i, k, c, s;
-    // the case of the largest cut sizes
-    if ( nSize0 == LutSize && nSize1 == LutSize )
-    {
-        for ( i = 0; i < nSize0; i++ )
-        {
-            if ( pC0[i] != pC1[i] )
-                return 0;
-            pC[i] = pC0[i];
-        }
-        pCut[0] = LutSize;
-        return 1;
-    }
-    // compare two cuts with different numbers
-    i = k = c = s = 0;
-    if ( nSize0 == 0 ) goto FlushCut1;
-    if ( nSize1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == LutSize ) return 0;
-        if ( pC0[i] < pC1[k] )
-        {
-            pC[c++] = pC0[i++];
-            if ( i >= nSize0 ) goto FlushCut1;
-        }
-        else if ( pC0[i] > pC1[k] )
-        {
-            pC[c++] = pC1[k++];
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC[c++] = pC0[i++]; k++;
-            if ( i >= nSize0 ) goto FlushCut1;
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSize0 > LutSize + i ) return 0;
-    while ( i < nSize0 )
-        pC[c++] = pC0[i++];
-    pCut[0] = c;
-    return 1;
-
-FlushCut1:
-    if ( c + nSize1 > LutSize + k ) return 0;
-    while ( k < nSize1 )
-        pC[c++] = pC1[k++];
-    pCut[0] = c;
+    int nSize = Gia_CutMrgOrder( pCut0 + 1, Jf_CutSize(pCut0), pCut1 + 1, Jf_CutSize(pCut1), pCut + 1, LutSize );
+    if ( nSize == -1 )
+        return 0;
+    pCut[0] = nSize;
     return 1;
 }
 
@@ -1151,7 +1073,7 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
     Jf_ObjForEachCut( pCuts0, pCut0, i )
     Jf_ObjForEachCut( pCuts1, pCut1, k )
     {
-        if ( Jf_CountBits(Sign0[i] | Sign1[k]) > LutSize )
+        if ( Gia_CutMrgFilter(Sign0[i] | Sign1[k], Jf_CutSize(pCut0) + Jf_CutSize(pCut1), LutSize) )
             continue;
         p->CutCount[1]++;        
         if ( !p->pPars->fCutMin )
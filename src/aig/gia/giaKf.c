@@ -27,16 +27,6 @@
 #include <unistd.h>
 #endif
 
-#ifdef ABC_USE_PTHREADS
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#endif
-
-#endif
-
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -961,36 +951,19 @@ typedef struct Kf_ThData_t_
 {
     Kf_Set_t *  pSett;
     int         Id;
-    int         Status;
     abctime     clkUsed;
 } Kf_ThData_t;
-void * Kf_WorkerThread( void * pArg )
+int Kf_WorkerTask( void * pArg )
 {
     Kf_ThData_t * pThData = (Kf_ThData_t *)pArg;
     Kf_Man_t * pMan = pThData->pSett->pMan;
     int fAreaOnly = pThData->pSett->pMan->pPars->fAreaOnly;
     int fCutMin = pThData->pSett->pMan->pPars->fCutMin;
-    volatile int * pPlace = &pThData->Status;
-    abctime clk;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        assert( pThData->Id >= 0 );
-        clk = Abc_Clock();
-        Kf_SetMergeOrder( pThData->pSett, Kf_ObjCuts0(pMan, pThData->Id), Kf_ObjCuts1(pMan, pThData->Id), fAreaOnly, fCutMin );
-        pThData->clkUsed += Abc_Clock() - clk;
-        pThData->Status = 0;
-//        printf( "Finished object %d\n", pThData->Id );
-    }
-    assert( 0 );
-    return NULL;
+    abctime clk = Abc_Clock();
+    assert( pThData->Id >= 0 );
+    Kf_SetMergeOrder( pThData->pSett, Kf_ObjCuts0(pMan, pThData->Id), Kf_ObjCuts1(pMan, pThData->Id), fAreaOnly, fCutMin );
+    pThData->clkUsed += Abc_Clock() - clk;
+    return 0;
 }
 Vec_Int_t * Kf_ManCreateFaninCounts( Gia_Man_t * p )  
 {
@@ -1009,14 +982,15 @@ Vec_Int_t * Kf_ManCreateFaninCounts( Gia_Man_t * p )
 }
 void Kf_ManComputeCuts( Kf_Man_t * p )
 {
-    pthread_t WorkerThread[PAR_THR_MAX];
+    Util_Task_t * pTasks[PAR_THR_MAX];
     Kf_ThData_t ThData[PAR_THR_MAX];
     Vec_Int_t * vStack, * vFanins;
     Gia_Obj_t * pObj;
     int nProcs = p->pPars->nProcNum;
-    int i, k, iFan, status, nCountFanins, fRunning;
+    int i, k, iFan, nCountFanins, fRunning, fDispatched;
     abctime clk, clkUsed = 0;
     assert( nProcs <= PAR_THR_MAX );
+    Util_PoolReserve( nProcs );
     // start fanins
     vFanins = Kf_ManCreateFaninCounts( p->pGia );
     Gia_ManStaticFanoutStart( p->pGia );
@@ -1025,24 +999,28 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
     Gia_ManForEachObjReverse( p->pGia, pObj, k )
         if ( Gia_ObjIsAnd(pObj) && Vec_IntEntry(vFanins, k) == 0 )
             Vec_IntPush( vStack, k );
-    // start the threads
+    // prepare the task slots
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].pSett = p->pSett + i;
         ThData[i].Id = -1;
-        ThData[i].Status = 0;
         ThData[i].clkUsed = 0;
-        status = pthread_create( WorkerThread + i, NULL, Kf_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        pTasks[i] = NULL;
     }
     nCountFanins = Vec_IntSum(vFanins);
     fRunning = 1;
     while ( nCountFanins > 0 || Vec_IntSize(vStack) > 0 || fRunning )
     {
+        fDispatched = 0;
         for ( i = 0; i < nProcs; i++ )
         {
-            if ( ThData[i].Status )
+            if ( pTasks[i] && !Util_TaskIsDone(pTasks[i]) )
                 continue;
-            assert( ThData[i].Status == 0 );
+            if ( pTasks[i] )
+            {
+                Util_TaskFree( pTasks[i] );
+                pTasks[i] = NULL;
+            }
             if ( ThData[i].Id >= 0 )
             {
                 int iObj = ThData[i].Id;
@@ -1074,14 +1052,18 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
             if ( Vec_IntSize(vStack) > 0 )
             {
                 ThData[i].Id = Vec_IntPop( vStack );
-                ThData[i].Status = 1;
+                pTasks[i] = Util_TaskSubmit( Kf_WorkerTask, (void *)(ThData + i), 0 );
+                fDispatched = 1;
                 //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
             }
         }
         fRunning = 0;
         for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].Status == 1 || (ThData[i].Status == 0 && ThData[i].Id >= 0) )
+            if ( pTasks[i] )
                 fRunning = 1;
+        // block until some slot frees up instead of spinning
+        if ( fRunning && !fDispatched )
+            Util_TaskWaitAny( pTasks, nProcs );
 //        printf( "fRunning %d\n", fRunning );
     }
     Vec_IntForEachEntry( vFanins, iFan, k )
@@ -1091,13 +1073,6 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
             Gia_ObjPrint( p->pGia, Gia_ManObj(p->pGia, k) );
         }
     assert( Vec_IntSum(vFanins) == 0 );
-    // stop the threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        assert( ThData[i].Status == 0 );
-        ThData[i].Id = -1;
-        ThData[i].Status = 1;
-    }
     Gia_ManStaticFanoutStop( p->pGia );
     Vec_IntFree( vStack );
     Vec_IntFree( vFanins );
@@ -175,8 +175,7 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pSibls );
     ABC_FREE( p->pRefs );
     ABC_FREE( p->pLutRefs );
-    ABC_FREE( p->pMuxes );
-    ABC_FREE( p->pObjs );
+    Gia_ManFreeObjs( p );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
     ABC_FREE( p );
@@ -20,6 +20,11 @@
 
 #include "gia.h"
 
+#if !defined(_WIN32) && !defined(__wasm)
+#include <sys/mman.h>
+#define GIA_USE_MMAP
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +32,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the number of objects, after which object storage is moved into the reserved address space (0 disables)
+static int s_nObjsMapMin = (1 << 22);
+
 struct Gia_MmFixed_t_
 {
     // information about individual entries
@@ -591,6 +599,149 @@ int Gia_MmStepReadMemUsage( Gia_MmStep_t * p )
     return nMemTotal;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reserves and releases the address space.]
+
+  Description [The address space is reserved without committing swap
+  space (MAP_NORESERVE). The physical pages are allocated and zeroed by
+  the OS when they are touched for the first time. Transparent huge pages
+  are requested to reduce the TLB pressure when traversing large AIGs.
+  Returns NULL if the address space cannot be reserved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_MmMapReserve( size_t nBytes )
+{
+#ifdef GIA_USE_MMAP
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+    void * pMem;
+    if ( sizeof(void *) < 8 )
+        return NULL;
+    pMem = mmap( NULL, nBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+    if ( pMem == MAP_FAILED )
+        return NULL;
+#ifdef MADV_HUGEPAGE
+    madvise( pMem, nBytes, MADV_HUGEPAGE );
+#endif
+    return pMem;
+#else
+    return NULL;
+#endif
+}
+static void Gia_MmMapRelease( void * pMem, size_t nBytes )
+{
+#ifdef GIA_USE_MMAP
+    munmap( pMem, nBytes );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the size, after which object storage is reserved.]
+
+  Description [When an AIG grows beyond this number of objects, its object
+  array (and the array of MUX controls, if present) are moved once into
+  the address space reserved for GIA_OBJ_MAX objects. After that, growing
+  the AIG does not copy the objects, the peak memory is the size of the
+  AIG rather than three times its size, and the pointers to the objects
+  remain valid. Zero disables the reservation.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSetObjsMapMin( int nObjsMin )
+{
+    s_nObjsMapMin = nObjsMin;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extends object storage of the AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManGrowObjs( Gia_Man_t * p, int nObjNew )
+{
+    assert( p->nObjsAlloc > 0 );
+    assert( p->nObjsAlloc < nObjNew && nObjNew <= GIA_OBJ_MAX );
+    if ( p->fVerbose )
+        printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
+    if ( !p->fObjsMapped && s_nObjsMapMin > 0 && nObjNew >= s_nObjsMapMin )
+    {
+        Gia_Obj_t * pObjs = (Gia_Obj_t *)Gia_MmMapReserve( sizeof(Gia_Obj_t) * (size_t)GIA_OBJ_MAX );
+        if ( pObjs )
+        {
+            memcpy( pObjs, p->pObjs, sizeof(Gia_Obj_t) * p->nObjsAlloc );
+            ABC_FREE( p->pObjs );
+            p->pObjs = pObjs;
+            p->fObjsMapped = 1;
+        }
+    }
+    if ( p->pMuxes && !p->fMuxesMapped && p->fObjsMapped )
+    {
+        unsigned * pMuxes = (unsigned *)Gia_MmMapReserve( sizeof(unsigned) * (size_t)GIA_OBJ_MAX );
+        if ( pMuxes )
+        {
+            memcpy( pMuxes, p->pMuxes, sizeof(unsigned) * p->nObjsAlloc );
+            ABC_FREE( p->pMuxes );
+            p->pMuxes = pMuxes;
+            p->fMuxesMapped = 1;
+        }
+    }
+    // the reserved pages are zeroed by the OS when they are touched
+    if ( !p->fObjsMapped )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
+        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
+    }
+    if ( p->pMuxes && !p->fMuxesMapped )
+    {
+        p->pMuxes = ABC_REALLOC( unsigned, p->pMuxes, nObjNew );
+        memset( p->pMuxes + p->nObjsAlloc, 0, sizeof(unsigned) * (nObjNew - p->nObjsAlloc) );
+    }
+    p->nObjsAlloc = nObjNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deallocates object storage of the AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManFreeObjs( Gia_Man_t * p )
+{
+    if ( p->fMuxesMapped )
+        Gia_MmMapRelease( p->pMuxes, sizeof(unsigned) * (size_t)GIA_OBJ_MAX ), p->pMuxes = NULL;
+    else
+        ABC_FREE( p->pMuxes );
+    if ( p->fObjsMapped )
+        Gia_MmMapRelease( p->pObjs, sizeof(Gia_Obj_t) * (size_t)GIA_OBJ_MAX ), p->pObjs = NULL;
+    else
+        ABC_FREE( p->pObjs );
+    p->fObjsMapped = p->fMuxesMapped = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
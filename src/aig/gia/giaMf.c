@@ -22,6 +22,7 @@
 #include "misc/vec/vecMem.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
+#include "giaCutMerge.h"
 #include "sat/cnf/cnf.h"
 #include "opt/dau/dau.h"
 #include "bool/kit/kit.h"
@@ -76,6 +77,9 @@ struct Mf_Man_t_
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
+    int             fTtStore;       // truth tables are taken from pPars->vTtMem
+    int             nTtMemBeg;      // the number of truth tables before this run
+    double          MemTtBeg;       // the memory of truth tables before this run
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
@@ -662,20 +666,6 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Mf_CutCountBits( word i )
-{
-    i = i - ((i >> 1) & 0x5555555555555555);
-    i = (i & 0x3333333333333333) + ((i >> 2) & 0x3333333333333333);
-    i = ((i + (i >> 4)) & 0x0F0F0F0F0F0F0F0F);
-    return (i*(0x0101010101010101))>>56;
-}
-static inline word Mf_CutGetSign( int * pLeaves, int nLeaves )
-{
-    word Sign = 0; int i; 
-    for ( i = 0; i < nLeaves; i++ )
-        Sign |= ((word)1) << (pLeaves[i] & 0x3F);
-    return Sign;
-}
 static inline int Mf_CutCreateUnit( Mf_Cut_t * p, int i )
 {
     p->Delay      = 0;
@@ -719,7 +709,7 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
             pMfCut->Flow    = 0;
             pMfCut->iFunc   = Mf_CutFunc( pCut );
             pMfCut->nLeaves = Mf_CutSize( pCut );
-            pMfCut->Sign    = Mf_CutGetSign( pCut+1, Mf_CutSize(pCut) );
+            pMfCut->Sign    = Gia_CutMrgSign( pCut+1, Mf_CutSize(pCut) );
             memcpy( pMfCut->pLeaves, pCut+1, sizeof(int) * Mf_CutSize(pCut) );
             pMfCut++;
         }
@@ -799,7 +789,7 @@ static inline int Mf_SetCheckArray( Mf_Cut_t ** ppCuts, int nCuts )
     {
         pCut0 = ppCuts[i];
         assert( pCut0->nLeaves <= MF_LEAF_MAX );
-        assert( pCut0->Sign == Mf_CutGetSign(pCut0->pLeaves, pCut0->nLeaves) );
+        assert( pCut0->Sign == Gia_CutMrgSign(pCut0->pLeaves, pCut0->nLeaves) );
         // check duplicates
         for ( m = 0; m < (int)pCut0->nLeaves; m++ )
         for ( n = m + 1; n < (int)pCut0->nLeaves; n++ )
@@ -832,116 +822,27 @@ static inline int Mf_SetCheckArray( Mf_Cut_t ** ppCuts, int nCuts )
 ***********************************************************************/
 static inline int Mf_CutMergeOrder( Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, Mf_Cut_t * pCut, int nLutSize )
 { 
-    int nSize0   = pCut0->nLeaves;
-    int nSize1   = pCut1->nLeaves;
-    int i, * pC0 = pCut0->pLeaves;
-    int k, * pC1 = pCut1->pLeaves;
-    int c, * pC  = pCut->pLeaves;
-    // the case of the largest cut sizes
-    if ( nSize0 == nLutSize && nSize1 == nLutSize )
-    {
-        for ( i = 0; i < nSize0; i++ )
-        {
-            if ( pC0[i] != pC1[i] )  return 0;
-            pC[i] = pC0[i];
-        }
-        pCut->nLeaves = nLutSize;
-        pCut->iFunc = MF_NO_FUNC;
-        pCut->Sign = pCut0->Sign | pCut1->Sign;
-        return 1;
-    }
-    // compare two cuts with different numbers
-    i = k = c = 0;
-    if ( nSize0 == 0 ) goto FlushCut1;
-    if ( nSize1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == nLutSize ) return 0;
-        if ( pC0[i] < pC1[k] )
-        {
-            pC[c++] = pC0[i++];
-            if ( i >= nSize0 ) goto FlushCut1;
-        }
-        else if ( pC0[i] > pC1[k] )
-        {
-            pC[c++] = pC1[k++];
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC[c++] = pC0[i++]; k++;
-            if ( i >= nSize0 ) goto FlushCut1;
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSize0 > nLutSize + i ) return 0;
-    while ( i < nSize0 )
-        pC[c++] = pC0[i++];
-    pCut->nLeaves = c;
-    pCut->iFunc = MF_NO_FUNC;
-    pCut->Sign = pCut0->Sign | pCut1->Sign;
-    return 1;
-
-FlushCut1:
-    if ( c + nSize1 > nLutSize + k ) return 0;
-    while ( k < nSize1 )
-        pC[c++] = pC1[k++];
-    pCut->nLeaves = c;
+    int nSize = Gia_CutMrgOrder( pCut0->pLeaves, pCut0->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, nLutSize );
+    if ( nSize == -1 )
+        return 0;
+    pCut->nLeaves = nSize;
     pCut->iFunc = MF_NO_FUNC;
     pCut->Sign = pCut0->Sign | pCut1->Sign;
     return 1;
 }
 static inline int Mf_CutMergeOrderMux( Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, Mf_Cut_t * pCut2, Mf_Cut_t * pCut, int nLutSize )
 { 
-    int x0, i0 = 0, nSize0 = pCut0->nLeaves, * pC0 = pCut0->pLeaves;
-    int x1, i1 = 0, nSize1 = pCut1->nLeaves, * pC1 = pCut1->pLeaves;
-    int x2, i2 = 0, nSize2 = pCut2->nLeaves, * pC2 = pCut2->pLeaves;
-    int xMin, c = 0, * pC  = pCut->pLeaves;
-    while ( 1 )
-    {
-        x0 = (i0 == nSize0) ? ABC_INFINITY : pC0[i0];
-        x1 = (i1 == nSize1) ? ABC_INFINITY : pC1[i1];
-        x2 = (i2 == nSize2) ? ABC_INFINITY : pC2[i2];
-        xMin = Abc_MinInt( Abc_MinInt(x0, x1), x2 );
-        if ( xMin == ABC_INFINITY ) break;
-        if ( c == nLutSize ) return 0;
-        pC[c++] = xMin;
-        if (x0 == xMin) i0++;
-        if (x1 == xMin) i1++;
-        if (x2 == xMin) i2++;
-    }
-    pCut->nLeaves = c;
+    int nSize = Gia_CutMrgOrder3( pCut0->pLeaves, pCut0->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut2->pLeaves, pCut2->nLeaves, pCut->pLeaves, nLutSize );
+    if ( nSize == -1 )
+        return 0;
+    pCut->nLeaves = nSize;
     pCut->iFunc = MF_NO_FUNC;
     pCut->Sign = pCut0->Sign | pCut1->Sign | pCut2->Sign;
     return 1;
 }
 static inline int Mf_SetCutIsContainedOrder( Mf_Cut_t * pBase, Mf_Cut_t * pCut ) // check if pCut is contained in pBase
 {
-    int i, nSizeB = pBase->nLeaves;
-    int k, nSizeC = pCut->nLeaves;
-    if ( nSizeB == nSizeC )
-    {
-        for ( i = 0; i < nSizeB; i++ )
-            if ( pBase->pLeaves[i] != pCut->pLeaves[i] )
-                return 0;
-        return 1;
-    }
-    assert( nSizeB > nSizeC ); 
-    if ( nSizeC == 0 )
-        return 1;
-    for ( i = k = 0; i < nSizeB; i++ )
-    {
-        if ( pBase->pLeaves[i] > pCut->pLeaves[k] )
-            return 0;
-        if ( pBase->pLeaves[i] == pCut->pLeaves[k] )
-        {
-            if ( ++k == nSizeC )
-                return 1;
-        }
-    }
-    return 0;
+    return Gia_CutMrgIsContained( pBase->pLeaves, pBase->nLeaves, pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Mf_SetLastCutIsContained( Mf_Cut_t ** pCuts, int nCuts )
 {
@@ -1066,7 +967,7 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         for ( pCut2 = pCuts2; pCut2 < pCut2Lim; pCut2++ )
         {
-            if ( Mf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
+            if ( Gia_CutMrgFilter(pCut0->Sign | pCut1->Sign | pCut2->Sign, (int)(pCut0->nLeaves + pCut1->nLeaves + pCut2->nLeaves), nLutSize) )
                 continue;
             p->CutCount[1]++; 
             if ( !Mf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
@@ -1075,7 +976,7 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
                 continue;
             p->CutCount[2]++;
             if ( p->pPars->fCutMin && Mf_CutComputeTruthMux(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
-                pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+                pCutsR[nCutsR]->Sign = Gia_CutMrgSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
             nCutsR = Mf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
@@ -1087,7 +988,7 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         {
-            if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Mf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
+            if ( Gia_CutMrgFilter(pCut0->Sign | pCut1->Sign, (int)(pCut0->nLeaves + pCut1->nLeaves), nLutSize) )
                 continue;
             p->CutCount[1]++; 
             if ( !Mf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
@@ -1096,7 +997,7 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
                 continue;
             p->CutCount[2]++;
             if ( p->pPars->fCutMin && Mf_CutComputeTruth(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
-                pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+                pCutsR[nCutsR]->Sign = Gia_CutMrgSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
             nCutsR = Mf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
@@ -1393,7 +1294,11 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->clkStart  = Abc_Clock();
     p->pGia      = pGia;
     p->pPars     = pPars;
-    p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    // reuse the truth tables of the previous runs unless other data is indexed by their IDs
+    p->fTtStore  = pPars->fCutMin && pPars->vTtMem && !pPars->fGenCnf && !pPars->fGenLit;
+    p->vTtMem    = p->fTtStore ? pPars->vTtMem : pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    p->nTtMemBeg = p->fTtStore ? Vec_MemEntryNum( p->vTtMem ) : 0;
+    p->MemTtBeg  = p->fTtStore ? Vec_MemMemory( p->vTtMem ) : 0;
     p->pLfObjs   = ABC_CALLOC( Mf_Obj_t, Gia_ManObjNum(pGia) );
     p->iCur      = 2;
     Vec_PtrGrow( &p->vPages, 256 );
@@ -1414,9 +1319,9 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
 void Mf_ManFree( Mf_Man_t * p )
 {
     assert( !p->pPars->fGenCnf || !p->pPars->fGenLit || Vec_IntSize(&p->vCnfSizes) == Vec_MemEntryNum(p->vTtMem) );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && !p->fTtStore )
         Vec_MemHashFree( p->vTtMem );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && !p->fTtStore )
         Vec_MemFree( p->vTtMem );
     Vec_PtrFreeData( &p->vPages );
     ABC_FREE( p->vCnfSizes.pArray );
@@ -1499,7 +1404,7 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(Mf_Obj_t) * Gia_ManObjNum(p->pGia) / (1<<20);
     float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
-    float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
+    float MemTt    = p->vTtMem ? (Vec_MemMemory(p->vTtMem) - p->MemTtBeg) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
         p->CutCount[0] = 1;
@@ -1523,7 +1428,7 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
         for ( i = 0; i <= p->pPars->nLutSize; i++ )
             printf( "%d = %d  ", i, p->nCutCounts[i] );
         if ( p->vTtMem )
-            printf( "TT = %d (%.2f %%)  ", Vec_MemEntryNum(p->vTtMem), 100.0 * Vec_MemEntryNum(p->vTtMem) / p->CutCount[2] );
+            printf( "TT = %d (%.2f %%)  ", Vec_MemEntryNum(p->vTtMem) - p->nTtMemBeg, 100.0 * (Vec_MemEntryNum(p->vTtMem) - p->nTtMemBeg) / p->CutCount[2] );
         Abc_PrintTime( 1, "Time",    Abc_Clock() - p->clkStart );
     }
     fflush( stdout );
@@ -1837,10 +1742,10 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
     }
     Mf_ManPrintInit( p );
     Mf_ManComputeCuts( p );
-    for ( p->Iter = 1; p->Iter < p->pPars->nRounds; p->Iter++ )
+    for ( p->Iter = 1; p->Iter < p->pPars->nRounds && !Util_TaskStop(); p->Iter++ )
         Mf_ManComputeMapping( p );
     p->fUseEla = 1;
-    for ( ; p->Iter < p->pPars->nRounds + pPars->nRoundsEla; p->Iter++ )
+    for ( ; p->Iter < p->pPars->nRounds + pPars->nRoundsEla && !Util_TaskStop(); p->Iter++ )
         Mf_ManComputeMapping( p );
     //Mf_ManOptimization( p );
     if ( pPars->fVeryVerbose && pPars->fCutMin )
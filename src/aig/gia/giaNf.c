@@ -24,6 +24,7 @@
 #include "map/mio/mio.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
+#include "giaCutMerge.h"
 #include "base/main/main.h"
 #include "misc/vec/vecMem.h"
 #include "misc/vec/vecWec.h"
@@ -504,20 +505,6 @@ static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Nf_CutCountBits( word i )
-{
-    i = i - ((i >> 1) & 0x5555555555555555);
-    i = (i & 0x3333333333333333) + ((i >> 2) & 0x3333333333333333);
-    i = ((i + (i >> 4)) & 0x0F0F0F0F0F0F0F0F);
-    return (i*(0x0101010101010101))>>56;
-}
-static inline word Nf_CutGetSign( int * pLeaves, int nLeaves )
-{
-    word Sign = 0; int i; 
-    for ( i = 0; i < nLeaves; i++ )
-        Sign |= ((word)1) << (pLeaves[i] & 0x3F);
-    return Sign;
-}
 static inline int Nf_CutCreateUnit( Nf_Cut_t * p, int i )
 {
     p->Delay      = 0;
@@ -555,7 +542,7 @@ static inline int Nf_ManPrepareCuts( Nf_Cut_t * pCuts, Nf_Man_t * p, int iObj, i
             pMfCut->Flow    = 0;
             pMfCut->iFunc   = Nf_CutFunc( pCut );
             pMfCut->nLeaves = Nf_CutSize( pCut );
-            pMfCut->Sign    = Nf_CutGetSign( pCut+1, Nf_CutSize(pCut) );
+            pMfCut->Sign    = Gia_CutMrgSign( pCut+1, Nf_CutSize(pCut) );
             pMfCut->Useless = Nf_ObjCutUseless( p, Abc_Lit2Var(pMfCut->iFunc) );
             memcpy( pMfCut->pLeaves, pCut+1, sizeof(int) * Nf_CutSize(pCut) );
             pMfCut++;
@@ -640,7 +627,7 @@ static inline int Nf_SetCheckArray( Nf_Cut_t ** ppCuts, int nCuts )
     {
         pCut0 = ppCuts[i];
         assert( pCut0->nLeaves <= NF_LEAF_MAX );
-        assert( pCut0->Sign == Nf_CutGetSign(pCut0->pLeaves, pCut0->nLeaves) );
+        assert( pCut0->Sign == Gia_CutMrgSign(pCut0->pLeaves, pCut0->nLeaves) );
         // check duplicates
         for ( m = 0; m < (int)pCut0->nLeaves; m++ )
         for ( n = m + 1; n < (int)pCut0->nLeaves; n++ )
@@ -673,116 +660,27 @@ static inline int Nf_SetCheckArray( Nf_Cut_t ** ppCuts, int nCuts )
 ***********************************************************************/
 static inline int Nf_CutMergeOrder( Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, Nf_Cut_t * pCut, int nLutSize )
 { 
-    int nSize0   = pCut0->nLeaves;
-    int nSize1   = pCut1->nLeaves;
-    int i, * pC0 = pCut0->pLeaves;
-    int k, * pC1 = pCut1->pLeaves;
-    int c, * pC  = pCut->pLeaves;
-    // the case of the largest cut sizes
-    if ( nSize0 == nLutSize && nSize1 == nLutSize )
-    {
-        for ( i = 0; i < nSize0; i++ )
-        {
-            if ( pC0[i] != pC1[i] )  return 0;
-            pC[i] = pC0[i];
-        }
-        pCut->nLeaves = nLutSize;
-        pCut->iFunc = NF_NO_FUNC;
-        pCut->Sign = pCut0->Sign | pCut1->Sign;
-        return 1;
-    }
-    // compare two cuts with different numbers
-    i = k = c = 0;
-    if ( nSize0 == 0 ) goto FlushCut1;
-    if ( nSize1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == nLutSize ) return 0;
-        if ( pC0[i] < pC1[k] )
-        {
-            pC[c++] = pC0[i++];
-            if ( i >= nSize0 ) goto FlushCut1;
-        }
-        else if ( pC0[i] > pC1[k] )
-        {
-            pC[c++] = pC1[k++];
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC[c++] = pC0[i++]; k++;
-            if ( i >= nSize0 ) goto FlushCut1;
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSize0 > nLutSize + i ) return 0;
-    while ( i < nSize0 )
-        pC[c++] = pC0[i++];
-    pCut->nLeaves = c;
-    pCut->iFunc = NF_NO_FUNC;
-    pCut->Sign = pCut0->Sign | pCut1->Sign;
-    return 1;
-
-FlushCut1:
-    if ( c + nSize1 > nLutSize + k ) return 0;
-    while ( k < nSize1 )
-        pC[c++] = pC1[k++];
-    pCut->nLeaves = c;
+    int nSize = Gia_CutMrgOrder( pCut0->pLeaves, pCut0->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, nLutSize );
+    if ( nSize == -1 )
+        return 0;
+    pCut->nLeaves = nSize;
     pCut->iFunc = NF_NO_FUNC;
     pCut->Sign = pCut0->Sign | pCut1->Sign;
     return 1;
 }
 static inline int Nf_CutMergeOrderMux( Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, Nf_Cut_t * pCut2, Nf_Cut_t * pCut, int nLutSize )
 { 
-    int x0, i0 = 0, nSize0 = pCut0->nLeaves, * pC0 = pCut0->pLeaves;
-    int x1, i1 = 0, nSize1 = pCut1->nLeaves, * pC1 = pCut1->pLeaves;
-    int x2, i2 = 0, nSize2 = pCut2->nLeaves, * pC2 = pCut2->pLeaves;
-    int xMin, c = 0, * pC  = pCut->pLeaves;
-    while ( 1 )
-    {
-        x0 = (i0 == nSize0) ? ABC_INFINITY : pC0[i0];
-        x1 = (i1 == nSize1) ? ABC_INFINITY : pC1[i1];
-        x2 = (i2 == nSize2) ? ABC_INFINITY : pC2[i2];
-        xMin = Abc_MinInt( Abc_MinInt(x0, x1), x2 );
-        if ( xMin == ABC_INFINITY ) break;
-        if ( c == nLutSize ) return 0;
-        pC[c++] = xMin;
-        if (x0 == xMin) i0++;
-        if (x1 == xMin) i1++;
-        if (x2 == xMin) i2++;
-    }
-    pCut->nLeaves = c;
+    int nSize = Gia_CutMrgOrder3( pCut0->pLeaves, pCut0->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut2->pLeaves, pCut2->nLeaves, pCut->pLeaves, nLutSize );
+    if ( nSize == -1 )
+        return 0;
+    pCut->nLeaves = nSize;
     pCut->iFunc = NF_NO_FUNC;
     pCut->Sign = pCut0->Sign | pCut1->Sign | pCut2->Sign;
     return 1;
 }
 static inline int Nf_SetCutIsContainedOrder( Nf_Cut_t * pBase, Nf_Cut_t * pCut ) // check if pCut is contained in pBase
 {
-    int i, nSizeB = pBase->nLeaves;
-    int k, nSizeC = pCut->nLeaves;
-    if ( nSizeB == nSizeC )
-    {
-        for ( i = 0; i < nSizeB; i++ )
-            if ( pBase->pLeaves[i] != pCut->pLeaves[i] )
-                return 0;
-        return 1;
-    }
-    assert( nSizeB > nSizeC ); 
-    if ( nSizeC == 0 )
-        return 1;
-    for ( i = k = 0; i < nSizeB; i++ )
-    {
-        if ( pBase->pLeaves[i] > pCut->pLeaves[k] )
-            return 0;
-        if ( pBase->pLeaves[i] == pCut->pLeaves[k] )
-        {
-            if ( ++k == nSizeC )
-                return 1;
-        }
-    }
-    return 0;
+    return Gia_CutMrgIsContained( pBase->pLeaves, pBase->nLeaves, pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Nf_SetLastCutIsContained( Nf_Cut_t ** pCuts, int nCuts )
 {
@@ -904,7 +802,7 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         for ( pCut2 = pCuts2; pCut2 < pCut2Lim; pCut2++ )
         {
-            if ( Nf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
+            if ( Gia_CutMrgFilter(pCut0->Sign | pCut1->Sign | pCut2->Sign, (int)(pCut0->nLeaves + pCut1->nLeaves + pCut2->nLeaves), nLutSize) )
                 continue;
             p->CutCount[1]++; 
             if ( !Nf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
@@ -913,7 +811,7 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
                 continue;
             p->CutCount[2]++;
             if ( Nf_CutComputeTruthMux6(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
-                pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+                pCutsR[nCutsR]->Sign = Gia_CutMrgSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
             nCutsR = Nf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
@@ -925,7 +823,7 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         {
-            if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Nf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
+            if ( Gia_CutMrgFilter(pCut0->Sign | pCut1->Sign, (int)(pCut0->nLeaves + pCut1->nLeaves), nLutSize) )
                 continue;
             p->CutCount[1]++; 
             if ( !Nf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
@@ -934,7 +832,7 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
                 continue;
             p->CutCount[2]++;
             if ( Nf_CutComputeTruth6(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
-                pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
+                pCutsR[nCutsR]->Sign = Gia_CutMrgSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
             nCutsR = Nf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
@@ -2743,7 +2641,7 @@ Gia_Man_t * Nf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
 //            Nf_ObjPrepareCi( p, Id, Scl_Flt2Int(p->pGia->vInArrs ? Abc_MaxFloat(0.0, Vec_FltEntry(p->pGia->vInArrs, i)) : 0.0) );
             Nf_ObjPrepareCi( p, Id, Scl_Flt2Int(p->pGia->vInArrs ? Vec_FltEntry(p->pGia->vInArrs, i) : 0.0) );
     }
-    for ( p->Iter = 0; p->Iter < p->pPars->nRounds; p->Iter++ )
+    for ( p->Iter = 0; p->Iter < p->pPars->nRounds && (p->Iter == 0 || !Util_TaskStop()); p->Iter++ )
     {
         Nf_ManComputeMapping( p );
         Nf_ManSetMapRefs( p );
@@ -2751,7 +2649,7 @@ Gia_Man_t * Nf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
     }
 
     p->fUseEla = 1;
-    for ( ; p->Iter < p->pPars->nRounds + pPars->nRoundsEla; p->Iter++ )
+    for ( ; p->Iter < p->pPars->nRounds + pPars->nRoundsEla && !Util_TaskStop(); p->Iter++ )
     {
         Nf_ManComputeMappingEla( p );
         Nf_ManUpdateStats( p );
@@ -0,0 +1,169 @@
+/**CFile****************************************************************
+
+  FileName    [giaRwr.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Region-parallel DAG-aware rewriting.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaRwr.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "aig/gia/giaAig.h"
+#include "opt/dar/dar.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Gia_RwrData_t_ Gia_RwrData_t;
+struct Gia_RwrData_t_
+{
+    Gia_Man_t *     pIn;        // the region before rewriting
+    Gia_Man_t *     pOut;       // the region after rewriting
+    Dar_RwrPar_t *  pPars;      // rewriting parameters (shared, read-only)
+};
+
+extern Vec_Wec_t *  Gia_ManStochNodes( Gia_Man_t * p, int nMaxSize, int Seed );
+extern Vec_Wec_t *  Gia_ManStochInputs( Gia_Man_t * p, Vec_Wec_t * vAnds );
+extern Vec_Wec_t *  Gia_ManStochOutputs( Gia_Man_t * p, Vec_Wec_t * vAnds );
+extern Gia_Man_t *  Gia_ManDupDivideOne( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, Vec_Int_t * vLevels[2], int nLevels );
+extern Gia_Man_t *  Gia_ManDupStitch( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, Vec_Ptr_t * vAigs, int fHash );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites one region.]
+
+  Description [The region is converted into an AIG manager owned by
+  this thread and rewritten there. Since the region's outputs include
+  every node referenced outside of it, the replacements never change
+  the logic seen by the other regions. If rewriting did not help,
+  the region is returned unchanged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManRewriteRegion( Gia_Man_t * p, Dar_RwrPar_t * pPars )
+{
+    Gia_Man_t * pNew;
+    Aig_Man_t * pMan = Gia_ManToAigSimple( p );
+    Dar_ManRewrite( pMan, pPars );
+    Aig_ManCleanup( pMan );
+    pNew = Gia_ManFromAig( pMan );
+    Aig_ManStop( pMan );
+    if ( Gia_ManAndNum(pNew) > Gia_ManAndNum(p) )
+    {
+        Gia_ManStop( pNew );
+        pNew = Gia_ManDup( p );
+    }
+    return pNew;
+}
+int Gia_ManRewriteRegion1( void * p )
+{
+    Gia_RwrData_t * pData = (Gia_RwrData_t *)p;
+    assert( pData->pIn != NULL );
+    assert( pData->pOut == NULL );
+    pData->pOut = Gia_ManRewriteRegion( pData->pIn, pData->pPars );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs DAG-aware rewriting over non-overlapping regions.]
+
+  Description [The AND nodes are divided into regions of at most nRegionMax
+  nodes by collecting the TFI cones of the COs. The regions do not share
+  nodes, so the MFFCs of their internal nodes do not interact and the regions
+  can be rewritten concurrently. The rewritten regions are then stitched
+  together in the original order with structural hashing, which merges
+  the logic duplicated across the region boundaries. The regions depend only
+  on nRegionMax, so the result does not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManRewritePar( Gia_Man_t * p, int nRegionMax, int nProcs, int fUseZeros, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Dar_RwrPar_t Pars, * pPars = &Pars;
+    Gia_Man_t * pNew, * pGia;
+    Gia_RwrData_t * pData;
+    Vec_Wec_t * vAnds, * vIns, * vOuts;
+    Vec_Ptr_t * vAigs, * vData;
+    Vec_Int_t * vLevels[2] = {NULL};
+    int i;
+    assert( !Gia_ManHasMapping(p) );
+    if ( Gia_ManAndNum(p) == 0 )
+        return Gia_ManDup( p );
+    Dar_ManDefaultRwrParams( pPars );
+    pPars->fUseZeros = fUseZeros;
+    // prepare the library before the threads start reading it
+    Dar_LibPrepare( pPars->nSubgMax );
+    // divide the nodes into regions
+    vAnds = Gia_ManStochNodes( p, nRegionMax, 0 );
+    vIns  = Gia_ManStochInputs( p, vAnds );
+    vOuts = Gia_ManStochOutputs( p, vAnds );
+    vAigs = Vec_PtrAlloc( Vec_WecSize(vAnds) );
+    for ( i = 0; i < Vec_WecSize(vAnds); i++ )
+        Vec_PtrPush( vAigs, Gia_ManDupDivideOne(p, Vec_WecEntry(vIns, i), Vec_WecEntry(vAnds, i), Vec_WecEntry(vOuts, i), vLevels, 0) );
+    // rewrite the regions
+    pData = ABC_CALLOC( Gia_RwrData_t, Vec_PtrSize(vAigs) );
+    vData = Vec_PtrAlloc( Vec_PtrSize(vAigs) );
+    Vec_PtrForEachEntry( Gia_Man_t *, vAigs, pGia, i )
+    {
+        pData[i].pIn   = pGia;
+        pData[i].pPars = pPars;
+        Vec_PtrPush( vData, pData+i );
+    }
+    Util_ProcessThreads( Gia_ManRewriteRegion1, vData, Abc_MaxInt(nProcs, 1), 0, 0 );
+    Vec_PtrForEachEntry( Gia_Man_t *, vAigs, pGia, i )
+    {
+        if ( pData[i].pOut == NULL ) // keep the region if it was skipped
+            continue;
+        Gia_ManStop( pGia );
+        Vec_PtrWriteEntry( vAigs, i, pData[i].pOut );
+    }
+    // commit the results
+    pNew = Gia_ManDupStitch( p, vIns, vAnds, vOuts, vAigs, 1 );
+    if ( fVerbose )
+    {
+        printf( "Rewrote %d regions (up to %d nodes) using %d threads. Reduced %d to %d nodes.  ",
+            Vec_PtrSize(vAigs), nRegionMax, Abc_MaxInt(nProcs, 1), Gia_ManAndNum(p), Gia_ManAndNum(pNew) );
+        Abc_PrintTime( 0, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFreeFunc( vAigs, (void (*)(void *)) Gia_ManStop );
+    Vec_PtrFree( vData );
+    ABC_FREE( pData );
+    Vec_WecFree( vAnds );
+    Vec_WecFree( vIns );
+    Vec_WecFree( vOuts );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
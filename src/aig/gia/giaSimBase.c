@@ -124,29 +124,14 @@ static inline void Gia_ManSimPatSimNot( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
 }
 Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
-    Gia_Obj_t * pObj;
-    int i, nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
-    assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
-    Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
-    Gia_ManForEachCo( pGia, pObj, i )
-        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
-    return vSims;
+    return Gia_ManSimPatSimMt( pGia, pGia->vSimsPi, 1 );
 }
 Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts )
 {
     Gia_Obj_t * pObj;
     int i, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
     Vec_Wrd_t * vSimsCo = fOuts ? Vec_WrdStart( Gia_ManCoNum(pGia) * nWords ) : NULL;
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
-    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
-    Gia_ManSimPatAssignInputs( pGia, nWords, vSims, vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
-    Gia_ManForEachCo( pGia, pObj, i )
-        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    Vec_Wrd_t * vSims = Gia_ManSimPatSimMt( pGia, vSimsPi, 1 );
     if ( !fOuts )
         return vSims;
     Gia_ManForEachCo( pGia, pObj, i )
@@ -761,9 +746,9 @@ Gia_Man_t * Gia_ManSimPatGenMiter( Gia_Man_t * p, Vec_Wrd_t * vSims )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSimProfile( Gia_Man_t * pGia )
+void Gia_ManSimProfile( Gia_Man_t * pGia, int nThreads )
 {
-    Vec_Wrd_t * vSims = Gia_ManSimPatSim( pGia );
+    Vec_Wrd_t * vSims = Gia_ManSimPatSimMt( pGia, pGia->vSimsPi, nThreads );
     int nWords = Vec_WrdSize(vSims) / Gia_ManObjNum(pGia);
     int nC0s = 0, nC1s = 0, nUnique = Gia_ManSimPatHashPatterns( pGia, nWords, vSims, &nC0s, &nC1s );
     printf( "Simulating %d patterns leads to %d unique objects (%.2f %% out of %d). Const0 = %d. Const1 = %d.\n", 
@@ -2234,15 +2219,13 @@ void Gia_ManPatDistImprove( Gia_Man_t * p, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Gia_SimCollectRare( Gia_Man_t * p, Vec_Wrd_t * vPatterns, int RareLimit )
+Vec_Int_t * Gia_SimCollectRare( Gia_Man_t * p, Vec_Wrd_t * vPatterns, int RareLimit, int nThreads )
 {
     Vec_Int_t * vRareCounts = Vec_IntAlloc( 100 );  // (node, rare_count) pairs
     int Id, nWords = Vec_WrdSize(vPatterns) / Gia_ManCiNum(p), TotalBits = 64*nWords;
-    Vec_Wrd_t * vSims, * vTemp = p->vSimsPi;
+    Vec_Wrd_t * vSims;
     assert( Vec_WrdSize(vPatterns) % Gia_ManCiNum(p) == 0 );
-    p->vSimsPi = vPatterns;
-    vSims = Gia_ManSimPatSim( p );
-    p->vSimsPi = vTemp;
+    vSims = Gia_ManSimPatSimMt( p, vPatterns, nThreads );
     Gia_ManForEachAndId( p, Id )
     {
         word * pSim   = Vec_WrdEntryP( vSims, Id*nWords );
@@ -2320,50 +2303,44 @@ float Gia_ManPatGetQuo( Gia_Man_t * p, Vec_Int_t * vRareCounts, Vec_Wrd_t * vSim
     }
     return Quality;
 }
-float Gia_ManPatGetTotalQuo( Gia_Man_t * p, int RareLimit, Vec_Wrd_t * vPatterns, int nWords )
+float Gia_ManPatGetTotalQuo( Gia_Man_t * p, int RareLimit, Vec_Wrd_t * vPatterns, int nWords, int nThreads )
 {
     float Total = 0; int n;
-    Vec_Int_t * vRareCounts = Gia_SimCollectRare( p, vPatterns, RareLimit );
-    Vec_Wrd_t * vSims, * vTemp = p->vSimsPi;
-    p->vSimsPi = vPatterns;
-    vSims = Gia_ManSimPatSim( p );
-    p->vSimsPi = vTemp;
+    Vec_Int_t * vRareCounts = Gia_SimCollectRare( p, vPatterns, RareLimit, nThreads );
+    Vec_Wrd_t * vSims = Gia_ManSimPatSimMt( p, vPatterns, nThreads );
     for ( n = 0; n < 64*nWords; n++ )
         Total += Gia_ManPatGetQuo( p, vRareCounts, vSims, n, nWords );
     Vec_IntFree( vRareCounts );
     Vec_WrdFree( vSims );
     return Total;
 }
-float Gia_ManPatGetOneQuo( Gia_Man_t * p, int RareLimit, Vec_Wrd_t * vPatterns, int nWords, int n )
+float Gia_ManPatGetOneQuo( Gia_Man_t * p, int RareLimit, Vec_Wrd_t * vPatterns, int nWords, int n, int nThreads )
 {
     float Total = 0; 
-    Vec_Int_t * vRareCounts = Gia_SimCollectRare( p, vPatterns, RareLimit );
-    Vec_Wrd_t * vSims, * vTemp = p->vSimsPi;
-    p->vSimsPi = vPatterns;
-    vSims = Gia_ManSimPatSim( p );
-    p->vSimsPi = vTemp;
+    Vec_Int_t * vRareCounts = Gia_SimCollectRare( p, vPatterns, RareLimit, nThreads );
+    Vec_Wrd_t * vSims = Gia_ManSimPatSimMt( p, vPatterns, nThreads );
     Total += Gia_ManPatGetQuo( p, vRareCounts, vSims, n, nWords );
     Vec_IntFree( vRareCounts );
     Vec_WrdFree( vSims );
     return Total;
 }
-void Gia_ManPatRareImprove( Gia_Man_t * p, int RareLimit, int fVerbose )
+void Gia_ManPatRareImprove( Gia_Man_t * p, int RareLimit, int nThreads, int fVerbose )
 {
     abctime clk = Abc_Clock();
     float FinalTotal, InitTotal;
     int n, nRares = 0, nChanges = 0, nWords = Vec_WrdSize(p->vSimsPi) / Gia_ManCiNum(p);
     Vec_Wrd_t * vPatterns = p->vSimsPi; p->vSimsPi = NULL;
-    InitTotal = Gia_ManPatGetTotalQuo( p, RareLimit, vPatterns, nWords );
+    InitTotal = Gia_ManPatGetTotalQuo( p, RareLimit, vPatterns, nWords, nThreads );
     for ( n = 0; n < 64*nWords; n++ )
     {
         abctime clk = Abc_Clock();
-        Vec_Int_t * vRareCounts = Gia_SimCollectRare( p, vPatterns, RareLimit );
+        Vec_Int_t * vRareCounts = Gia_SimCollectRare( p, vPatterns, RareLimit, nThreads );
         Vec_Int_t * vPat        = Gia_ManPatCollectOne( p, vPatterns, n, nWords );
         Vec_Flt_t * vQuoIncs    = Gia_SimQualityImpact( p, vPat, vRareCounts );
         Vec_Int_t * vBest       = Gia_SimCollectBest( vQuoIncs );
         if ( fVerbose )
         {
-            float PatQuo = Gia_ManPatGetOneQuo( p, RareLimit, vPatterns, nWords, n );
+            float PatQuo = Gia_ManPatGetOneQuo( p, RareLimit, vPatterns, nWords, n, nThreads );
             printf( "Pat %5d : Rare = %4d  Cands = %3d  Value = %8.3f  Change = %8.3f  ", 
                 n, Vec_IntSize(vRareCounts)/2, vBest ? Vec_IntSize(vBest) : 0, 
                 PatQuo, vBest ? Vec_FltEntry(vQuoIncs, Vec_IntEntry(vBest,0)) : 0 );
@@ -2383,7 +2360,7 @@ void Gia_ManPatRareImprove( Gia_Man_t * p, int RareLimit, int fVerbose )
     }
     if ( fVerbose )
         printf( "\n" );
-    FinalTotal = Gia_ManPatGetTotalQuo( p, RareLimit, vPatterns, nWords );
+    FinalTotal = Gia_ManPatGetTotalQuo( p, RareLimit, vPatterns, nWords, nThreads );
     p->vSimsPi = vPatterns;
 
     printf( "Improved %d out of %d patterns using %d rare nodes: %.2f -> %.2f.  ", 
@@ -0,0 +1,278 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimMt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Multi-threaded cache-blocked word-level simulation.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaSimMt.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_SIM_LINE      8           // words in one cache line (also the width of AVX-512 register pair)
+#define GIA_SIM_CACHE     (1 << 19)   // the cache budget of one block of patterns (bytes)
+#define GIA_SIM_WINDOW    1024        // the number of recent objects whose info should stay in the cache
+#define GIA_SIM_PROC_MAX  64          // the max number of threads
+
+// the range of simulation words processed by one thread
+typedef struct Gia_SimMtData_t_ Gia_SimMtData_t;
+struct Gia_SimMtData_t_
+{
+    Gia_Man_t *    p;           // the AIG
+    word *         pSims;       // simulation info of all objects
+    int            nWords;      // the number of words per object
+    int            wStart;      // the first word
+    int            wStop;       // the last word plus one
+    int            nBlock;      // the number of words in one block
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Simulation kernels.]
+
+  Description [The loops have no dependencies and no branches, so that
+  the compiler can vectorize them using the available SIMD instructions
+  (SSE/AVX2/AVX-512/NEON). The full-line version has a constant trip count
+  and is unrolled completely.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManSimMtAndLine( word * pSim, word * pSim0, word * pSim1, word Diff0, word Diff1 )
+{
+    int w;
+    for ( w = 0; w < GIA_SIM_LINE; w++ )
+        pSim[w] = (pSim0[w] ^ Diff0) & (pSim1[w] ^ Diff1);
+}
+static inline void Gia_ManSimMtXorLine( word * pSim, word * pSim0, word * pSim1, word Diff )
+{
+    int w;
+    for ( w = 0; w < GIA_SIM_LINE; w++ )
+        pSim[w] = pSim0[w] ^ pSim1[w] ^ Diff;
+}
+static inline void Gia_ManSimMtMuxLine( word * pSim, word * pSimC, word * pSim1, word * pSim0, word DiffC, word Diff1, word Diff0 )
+{
+    int w;
+    for ( w = 0; w < GIA_SIM_LINE; w++ )
+        pSim[w] = ((pSimC[w] ^ DiffC) & (pSim1[w] ^ Diff1)) | (~(pSimC[w] ^ DiffC) & (pSim0[w] ^ Diff0));
+}
+static inline void Gia_ManSimMtAnd( word * pSim, word * pSim0, word * pSim1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pSim[w] = (pSim0[w] ^ Diff0) & (pSim1[w] ^ Diff1);
+}
+static inline void Gia_ManSimMtXor( word * pSim, word * pSim0, word * pSim1, word Diff, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pSim[w] = pSim0[w] ^ pSim1[w] ^ Diff;
+}
+static inline void Gia_ManSimMtMux( word * pSim, word * pSimC, word * pSim1, word * pSim0, word DiffC, word Diff1, word Diff0, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pSim[w] = ((pSimC[w] ^ DiffC) & (pSim1[w] ^ Diff1)) | (~(pSimC[w] ^ DiffC) & (pSim0[w] ^ Diff0));
+}
+static inline void Gia_ManSimMtCopy( word * pSim, word * pSim0, word Diff0, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pSim[w] = pSim0[w] ^ Diff0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the range of words.]
+
+  Description [The range is divided into blocks, whose simulation info
+  for all objects fits into the cache, and the AIG is simulated for one
+  block at a time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_ManSimMtDiff( int fCompl )
+{
+    return fCompl ? ~(word)0 : 0;
+}
+void Gia_ManSimMtRange( Gia_SimMtData_t * pData )
+{
+    Gia_Man_t * p = pData->p;
+    Gia_Obj_t * pObj;
+    word * pSims = pData->pSims;
+    size_t nWords = (size_t)pData->nWords;
+    int i, b, nBlock;
+    for ( b = pData->wStart; b < pData->wStop; b += pData->nBlock )
+    {
+        nBlock = Abc_MinInt( pData->nBlock, pData->wStop - b );
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            word * pSim  = pSims + nWords * i + b;
+            word * pSim0 = pSims + nWords * Gia_ObjFaninId0(pObj, i) + b;
+            word * pSim1 = pSims + nWords * Gia_ObjFaninId1(pObj, i) + b;
+            word Diff0 = Gia_ManSimMtDiff( Gia_ObjFaninC0(pObj) );
+            word Diff1 = Gia_ManSimMtDiff( Gia_ObjFaninC1(pObj) );
+            if ( Gia_ObjIsMuxId(p, i) )
+            {
+                word * pSimC = pSims + nWords * Gia_ObjFaninId2(p, i) + b;
+                word DiffC = Gia_ManSimMtDiff( Gia_ObjFaninC2(p, pObj) );
+                int k;
+                if ( nBlock % GIA_SIM_LINE == 0 )
+                    for ( k = 0; k < nBlock; k += GIA_SIM_LINE )
+                        Gia_ManSimMtMuxLine( pSim + k, pSimC + k, pSim1 + k, pSim0 + k, DiffC, Diff1, Diff0 );
+                else
+                    Gia_ManSimMtMux( pSim, pSimC, pSim1, pSim0, DiffC, Diff1, Diff0, nBlock );
+            }
+            else if ( Gia_ObjIsXor(pObj) )
+            {
+                int k;
+                if ( nBlock % GIA_SIM_LINE == 0 )
+                    for ( k = 0; k < nBlock; k += GIA_SIM_LINE )
+                        Gia_ManSimMtXorLine( pSim + k, pSim0 + k, pSim1 + k, Diff0 ^ Diff1 );
+                else
+                    Gia_ManSimMtXor( pSim, pSim0, pSim1, Diff0 ^ Diff1, nBlock );
+            }
+            else
+            {
+                int k;
+                if ( nBlock % GIA_SIM_LINE == 0 )
+                    for ( k = 0; k < nBlock; k += GIA_SIM_LINE )
+                        Gia_ManSimMtAndLine( pSim + k, pSim0 + k, pSim1 + k, Diff0, Diff1 );
+                else
+                    Gia_ManSimMtAnd( pSim, pSim0, pSim1, Diff0, Diff1, nBlock );
+            }
+        }
+        Gia_ManForEachCo( p, pObj, i )
+        {
+            int iObj = Gia_ObjId( p, pObj );
+            Gia_ManSimMtCopy( pSims + nWords * iObj + b, pSims + nWords * Gia_ObjFaninId0(pObj, iObj) + b, Gia_ManSimMtDiff(Gia_ObjFaninC0(pObj)), nBlock );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of words in one block.]
+
+  Description [The fanins of a node are usually close to it in the
+  topological order, so the block is chosen to keep the info of the last
+  GIA_SIM_WINDOW objects (or of all objects, if there are fewer of them)
+  in the cache budget. The words are then divided into blocks of equal
+  size, which are aligned at cache lines.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimMtBlockSize( Gia_Man_t * p, int nWords )
+{
+    int nWindow   = Abc_MinInt( Gia_ManObjNum(p), GIA_SIM_WINDOW );
+    int nLines    = (nWords + GIA_SIM_LINE - 1) / GIA_SIM_LINE;
+    int nLinesMax = Abc_MaxInt( 1, (int)(GIA_SIM_CACHE / (sizeof(word) * GIA_SIM_LINE * nWindow)) );
+    int nBlocks   = (nLines + nLinesMax - 1) / nLinesMax;
+    return Abc_MinInt( nWords, GIA_SIM_LINE * ((nLines + nBlocks - 1) / nBlocks) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs multi-threaded simulation.]
+
+  Description [Since the simulation patterns are independent, the words
+  are divided into contiguous ranges aligned at cache lines, which are
+  simulated by different threads without synchronization. The internal
+  procedure assumes that the CI info is already in place and uses the
+  same layout as Gia_ManSimPatSim(): nWords words per object, ordered
+  by object ID.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimMtTask( void * pArg )
+{
+    Gia_ManSimMtRange( (Gia_SimMtData_t *)pArg );
+    return 1;
+}
+void Gia_ManSimPatSimMtInt( Gia_Man_t * p, word * pSims, int nWords, int nThreads )
+{
+    Gia_SimMtData_t ThData[GIA_SIM_PROC_MAX];
+    Util_Task_t * pTasks[GIA_SIM_PROC_MAX];
+    int i, nLines, nBlock;
+    // divide the cache lines among the threads
+    nLines   = (nWords + GIA_SIM_LINE - 1) / GIA_SIM_LINE;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(Abc_MinInt(nThreads, GIA_SIM_PROC_MAX), nLines) );
+    nBlock   = Gia_ManSimMtBlockSize( p, nWords );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p      = p;
+        ThData[i].pSims  = pSims;
+        ThData[i].nWords = nWords;
+        ThData[i].wStart = Abc_MinInt( nWords, GIA_SIM_LINE * (int)((long long)nLines * i / nThreads) );
+        ThData[i].wStop  = Abc_MinInt( nWords, GIA_SIM_LINE * (int)((long long)nLines * (i+1) / nThreads) );
+        ThData[i].nBlock = nBlock;
+    }
+    if ( nThreads == 1 )
+    {
+        Gia_ManSimMtRange( ThData );
+        return;
+    }
+    // the calling thread simulates the first range
+    Util_PoolReserve( nThreads - 1 );
+    for ( i = 1; i < nThreads; i++ )
+        pTasks[i] = Util_TaskSubmit( Gia_ManSimMtTask, (void *)(ThData + i), 0 );
+    Gia_ManSimMtRange( ThData );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        Util_TaskWait( pTasks[i] );
+        Util_TaskFree( pTasks[i] );
+    }
+}
+Vec_Wrd_t * Gia_ManSimPatSimMt( Gia_Man_t * p, Vec_Wrd_t * vSimsPi, int nThreads )
+{
+    Vec_Wrd_t * vSims;
+    int i, Id, nWords;
+    assert( Gia_ManCiNum(p) > 0 );
+    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(p) == 0 );
+    nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(p);
+    vSims  = Vec_WrdStart( Gia_ManObjNum(p) * nWords );
+    Gia_ManForEachCiId( p, Id, i )
+        memcpy( Vec_WrdEntryP(vSims, Id*nWords), Vec_WrdEntryP(vSimsPi, i*nWords), sizeof(word)*nWords );
+    Gia_ManSimPatSimMtInt( p, Vec_WrdArray(vSims), nWords, nThreads );
+    return vSims;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
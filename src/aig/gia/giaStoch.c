@@ -193,8 +193,12 @@ Vec_Int_t * Gia_StochProcess( Vec_Ptr_t * vGias, char * pScript, int nProcs, int
     if ( fVerbose )
         printf( "Running concurrent synthesis with %d processes.\n", nProcs ), fflush(stdout);
     Util_ProcessThreads( Gia_StochProcess1, vData, nProcs, TimeSecs, fVerbose );
-    // replace old AIGs by new AIGs
+    // replace old AIGs by new AIGs (keep the old AIG if the entry was skipped)
     Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia, i ) {
+        if ( pData[i].pOut == NULL ) {
+            Vec_IntWriteEntry( vGains, i, 0 );
+            continue;
+        }
         Vec_IntWriteEntry( vGains, i, Gia_ManAndNum(pGia) - Gia_ManAndNum(pData[i].pOut) );
         Gia_ManStop( pGia );
         Vec_PtrWriteEntry( vGias, i, pData[i].pOut );
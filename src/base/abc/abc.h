@@ -650,6 +650,10 @@ extern ABC_DLL Vec_Ptr_t *        Abc_AigGetLevelizedOrder( Abc_Ntk_t * pNtk, in
 /*=== abcExact.c ==========================================================*/
 extern ABC_DLL int                Abc_ExactInputNum();
 extern ABC_DLL int                Abc_ExactIsRunning();
+extern ABC_DLL void               Abc_ExactStart( int nBTLimit, int fMakeAIG, int fVerbose, int fVeryVerbose, const char * pFilename, const char * pCacheName );
+extern ABC_DLL void               Abc_ExactStop( const char * pFilename );
+extern ABC_DLL void               Abc_ExactStats();
+extern ABC_DLL int                Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char * pPerm, int * Cost, int AigLevel );
 extern ABC_DLL Abc_Obj_t *        Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile, Abc_Obj_t ** pFanins, Abc_Ntk_t * pNtk );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrivalTimes, int nBTLimit, int nStartGates, int fVerbose );
 /*=== abcFanio.c ==========================================================*/
@@ -28,9 +28,19 @@
 #include "misc/util/utilTruth.h"
 #include "misc/vec/vecInt.h"
 #include "misc/vec/vecPtr.h"
+#include "opt/dau/dau.h"
 #include "proof/cec/cec.h"
 #include "sat/bsat/satSolver.h"
 
+#if !defined(_WIN32) && !defined(__wasm)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define SES_USE_CACHE_FILE
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -308,6 +318,37 @@ struct Ses_TruthEntry_t_
     Ses_TimesEntry_t * head;      /* pointer to head of sub list with arrival times */
 };
 
+// The persistent cache file starts with a header, which is followed by the
+// fixed-size records of the synthesized networks.  The file is shared by
+// several processes: each record is appended with one write() while holding
+// an exclusive lock, and the records appended by other processes are picked
+// up before the exact synthesis is run for a missing entry.  The entries are
+// keyed by the NPN canonical form of the function, hence one record serves
+// all functions of an NPN class.  Each record starts with a magic number and
+// its size, so that the reader can skip a record torn by a process that died
+// while appending it and find the next record.
+
+#define SES_DISK_HEADER      "abc_ses_cache_v2"
+#define SES_DISK_HEADER_SIZE 16
+#define SES_DISK_MAGIC       0x5e5cac4e
+#define SES_DISK_ENTRY_SIZE  256
+#define SES_DISK_SOL_MAX     (SES_DISK_ENTRY_SIZE - 88)
+#define SES_SOL_MAX          (3 + 4 * 127 + 2 + 8)
+
+typedef struct Ses_DiskEntry_t_ Ses_DiskEntry_t;
+struct Ses_DiskEntry_t_
+{
+    unsigned           uMagic;                  /* SES_DISK_MAGIC */
+    int                nEntrySize;              /* size of the record */
+    word               pTruth[4];               /* NPN canonical truth table */
+    int                nVars;                   /* number of variables */
+    int                fMakeAIG;                /* the network is an AIG */
+    int                pArrTimeProfile[8];      /* normalized arrival time profile */
+    unsigned           uChecksum;               /* checksum of the record */
+    int                nSolSize;                /* size of the network representation */
+    char               pSol[SES_DISK_SOL_MAX];  /* char array representation of optimum network */
+};
+
 #define SES_STORE_TABLE_SIZE 1024
 typedef struct Ses_Store_t_ Ses_Store_t;
 struct Ses_Store_t_
@@ -322,6 +363,13 @@ struct Ses_Store_t_
     sat_solver       * pSat;                           /* own SAT solver instance to reuse when calling exact algorithm */
     FILE             * pDebugEntries;                  /* debug unsynth. (rl) entries */
     char             * szDBName;                       /* if given, database is written every time a new entry is added */
+    char             * szCacheName;                    /* if given, the persistent cache file shared with other processes */
+    int                fdCache;                        /* descriptor of the persistent cache file (or -1) */
+    size_t             nCacheRead;                     /* the number of bytes of the cache file already read */
+    int                nCacheLoaded;                   /* number of entries loaded from the cache file */
+    int                nCacheStored;                   /* number of entries appended to the cache file */
+    int                nCacheBad;                      /* number of corrupted records in the cache file */
+    char               pSolBuffer[SES_SOL_MAX];        /* network in terms of the original inputs */
 
     /* statistics */
     unsigned long      nCutCount;                      /* number of cuts investigated */
@@ -388,6 +436,7 @@ static inline Ses_Store_t * Ses_StoreAlloc( int nBTLimit, int fMakeAIG, int fVer
     pStore->fMakeAIG           = fMakeAIG;
     pStore->fVerbose           = fVerbose;
     pStore->nBTLimit           = nBTLimit;
+    pStore->fdCache            = -1;
     memset( pStore->pEntries, 0, sizeof(pStore->pEntries) );
 
     pStore->pSat = sat_solver_new();
@@ -424,6 +473,11 @@ static inline void Ses_StoreClean( Ses_Store_t * pStore )
 
     sat_solver_delete( pStore->pSat );
 
+#ifdef SES_USE_CACHE_FILE
+    if ( pStore->fdCache != -1 )
+        close( pStore->fdCache );
+#endif
+    ABC_FREE( pStore->szCacheName );
     if ( pStore->szDBName )
         ABC_FREE( pStore->szDBName );
     ABC_FREE( pStore );
@@ -624,17 +678,14 @@ static void Ses_StoreWrite( Ses_Store_t * pStore, const char * pFilename, int fS
     fclose( pFile );
 }
 
-// pArrTimeProfile is normalized
+// pArrTimeProfile is normalized wrt. to the network
 // returns 1 if and only if a new TimesEntry has been created
-int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol, int fResLimit )
+static int Ses_StoreInsert( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol, int fResLimit )
 {
     int key, fAdded;
     Ses_TruthEntry_t * pTEntry;
     Ses_TimesEntry_t * pTiEntry;
 
-    if ( pSol )
-        Abc_ExactNormalizeArrivalTimesForNetwork( nVars, pArrTimeProfile, pSol );
-
     key = Ses_StoreTableHash( pTruth, nVars );
     pTEntry = pStore->pEntries[key];
 
@@ -689,6 +740,20 @@ int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pAr
         fAdded = 0;
     }
 
+    return fAdded;
+}
+
+// pArrTimeProfile is normalized
+// returns 1 if and only if a new TimesEntry has been created
+int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol, int fResLimit )
+{
+    int fAdded;
+
+    if ( pSol )
+        Abc_ExactNormalizeArrivalTimesForNetwork( nVars, pArrTimeProfile, pSol );
+
+    fAdded = Ses_StoreInsert( pStore, pTruth, nVars, pArrTimeProfile, pSol, fResLimit );
+
     /* statistics */
     if ( pSol )
     {
@@ -816,6 +881,10 @@ int Ses_StoreGetEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pAr
     return 1;
 }
 
+static void Ses_StoreEntryCanonicize( word * pTruth, int nVars, int * pArrTimeProfile, char ** ppSol );
+
+// the entries are canonicized, because the databases written before the store
+// was keyed by the NPN canonical form contain the original functions
 static void Ses_StoreRead( Ses_Store_t * pStore, const char * pFilename, int fSynthImp, int fSynthRL, int fUnsynthImp, int fUnsynthRL )
 {
     int i;
@@ -868,6 +937,7 @@ static void Ses_StoreRead( Ses_Store_t * pStore, const char * pFilename, int fSy
         if ( !fUnsynthImp && !pNetwork && !fResLimit ) continue;
         if ( !fUnsynthRL && !pNetwork && fResLimit )   continue;
 
+        Ses_StoreEntryCanonicize( pTruth, nVars, pArrTimeProfile, &pNetwork );
         Ses_StoreAddEntry( pStore, pTruth, nVars, pArrTimeProfile, pNetwork, fResLimit );
     }
 
@@ -876,6 +946,307 @@ static void Ses_StoreRead( Ses_Store_t * pStore, const char * pFilename, int fSy
     printf( "read %lu entries from file\n", (long)nEntries );
 }
 
+/***********************************************************************
+
+  Synopsis    [NPN canonical form of the store entries.]
+
+***********************************************************************/
+
+// computes the NPN canonical form of the function and permutes the arrival
+// times accordingly; the relation is f(x) = c(y) ^ (uPhase >> nVars), where
+// y[k] = x[pPerm[k]] ^ ((uPhase >> k) & 1)
+static unsigned Ses_StoreCanonicize( word * pTruth, int nVars, int * pArrTimeProfile, word * pTruthC, int * pArrTimeProfileC, char * pPerm )
+{
+    unsigned uPhase;
+    int k;
+    memset( pTruthC, 0, sizeof(word) * 4 );
+    Abc_TtCopy( pTruthC, pTruth, Abc_TtWordNum( nVars ), 0 );
+    if ( nVars < 6 )
+        pTruthC[0] = Abc_Tt6Stretch( pTruthC[0], nVars );
+    uPhase = Abc_TtCanonicize( pTruthC, nVars, pPerm );
+    for ( k = 0; k < nVars; ++k )
+        pArrTimeProfileC[k] = pArrTimeProfile[(int)pPerm[k]];
+    return uPhase;
+}
+
+// rewrites the network by replacing input i with literal pLits[i] of the new
+// inputs and complementing the output if fCompl is set; the gates whose
+// truth table becomes non-normal are complemented, and the complements are
+// propagated to their fanouts
+static void Ses_StoreRemapSol( char * pSol, char * pRes, int * pLits, int fCompl )
+{
+    int nVars = pSol[ABC_EXACT_SOL_NVARS], nGates = pSol[ABC_EXACT_SOL_NGATES];
+    int pObjLits[8 + 128];
+    int i, m, j, k, Lit0, Lit1, uTable, uTableNew, fGateCompl;
+    char * pIn = pSol + 3, * pOut = pRes + 3;
+
+    pRes[ABC_EXACT_SOL_NVARS]  = pSol[ABC_EXACT_SOL_NVARS];
+    pRes[ABC_EXACT_SOL_NFUNC]  = pSol[ABC_EXACT_SOL_NFUNC];
+    pRes[ABC_EXACT_SOL_NGATES] = pSol[ABC_EXACT_SOL_NGATES];
+    for ( i = 0; i < nVars; ++i )
+        pObjLits[i] = pLits[i];
+
+    for ( i = 0; i < nGates; ++i, pIn += 4, pOut += 4 )
+    {
+        assert( pIn[1] == 2 );
+        /* the gate function indexed by (value of j) * 2 + (value of k) */
+        uTable = pIn[0] << 1;
+        Lit0 = pObjLits[(int)pIn[2]];
+        Lit1 = pObjLits[(int)pIn[3]];
+        uTableNew = 0;
+        for ( m = 0; m < 4; ++m )
+            if ( (uTable >> (m ^ (Abc_LitIsCompl( Lit0 ) << 1) ^ Abc_LitIsCompl( Lit1 ))) & 1 )
+                uTableNew |= 1 << m;
+        fGateCompl = uTableNew & 1;
+        if ( fGateCompl )
+            uTableNew ^= 0xF;
+        j = Abc_Lit2Var( Lit0 );
+        k = Abc_Lit2Var( Lit1 );
+        assert( j != k );
+        if ( j > k )
+        {
+            ABC_SWAP( int, j, k );
+            uTableNew = (uTableNew & 9) | ((uTableNew & 2) << 1) | ((uTableNew & 4) >> 1);
+        }
+        pOut[0] = (char)(uTableNew >> 1);
+        pOut[1] = 2;
+        pOut[2] = (char)j;
+        pOut[3] = (char)k;
+        pObjLits[nVars + i] = Abc_Var2Lit( nVars + i, fGateCompl );
+    }
+
+    /* output literal, output delay, and pin-to-pin delays */
+    Lit0 = pObjLits[nVars + Abc_Lit2Var( pIn[0] )];
+    pOut[0] = (char)Abc_Var2Lit( Abc_Lit2Var( pIn[0] ), Abc_LitIsCompl( pIn[0] ) ^ Abc_LitIsCompl( Lit0 ) ^ fCompl );
+    pOut[1] = pIn[1];
+    for ( i = 0; i < nVars; ++i )
+        pOut[2 + Abc_Lit2Var( pLits[i] )] = pIn[2 + i];
+}
+
+// checks that the network implements the function
+static int Ses_StoreSolCheck( char * pSol, word * pTruth )
+{
+    word pTruthS[4] = {0}, pTtObjs[4 * 128], * pTruth0, * pTruth1, * pTt = NULL;
+    int nVars = pSol[ABC_EXACT_SOL_NVARS], nGates = pSol[ABC_EXACT_SOL_NGATES];
+    int i, w, f, j, k, nWords = Abc_TtWordNum( nVars );
+    char * p = pSol + 3;
+
+    Abc_TtCopy( pTruthS, pTruth, nWords, 0 );
+    if ( nVars < 6 )
+        pTruthS[0] = Abc_Tt6Stretch( pTruthS[0], nVars );
+    for ( i = 0; i < nGates; ++i, p += 4 )
+    {
+        f = p[0]; j = p[2]; k = p[3];
+        pTruth0 = j < nVars ? &s_Truths8[j << 2] : &pTtObjs[( j - nVars ) << 2];
+        pTruth1 = k < nVars ? &s_Truths8[k << 2] : &pTtObjs[( k - nVars ) << 2];
+        pTt = &pTtObjs[i << 2];
+        for ( w = 0; w < nWords; ++w )
+            pTt[w] = (((f & 1) ? ~pTruth0[w] &  pTruth1[w] : 0) |
+                      ((f & 2) ?  pTruth0[w] & ~pTruth1[w] : 0) |
+                      ((f & 4) ?  pTruth0[w] &  pTruth1[w] : 0));
+    }
+    if ( pTt == NULL || Abc_Lit2Var( p[0] ) != nGates - 1 )
+        return 0;
+    if ( Abc_LitIsCompl( p[0] ) )
+        Abc_TtNot( pTt, nWords );
+    return Abc_TtEqual( pTt, pTruthS, nWords );
+}
+
+// transforms the network found for the canonical form back to the original
+// function; the result is valid until the next call
+static char * Ses_StoreSolUncanonicize( Ses_Store_t * pStore, char * pSolC, word * pTruth, char * pPerm, unsigned uPhase )
+{
+    int k, pLits[8], nVars = pSolC[ABC_EXACT_SOL_NVARS];
+    assert( 3 + 4 * pSolC[ABC_EXACT_SOL_NGATES] + 2 + nVars <= SES_SOL_MAX );
+    for ( k = 0; k < nVars; ++k )
+        pLits[k] = Abc_Var2Lit( (int)pPerm[k], (uPhase >> k) & 1 );
+    Ses_StoreRemapSol( pSolC, pStore->pSolBuffer, pLits, (uPhase >> nVars) & 1 );
+    assert( Ses_StoreSolCheck( pStore->pSolBuffer, pTruth ) );
+    return pStore->pSolBuffer;
+}
+
+// replaces the entry by the entry of the NPN canonical form of its function
+static void Ses_StoreEntryCanonicize( word * pTruth, int nVars, int * pArrTimeProfile, char ** ppSol )
+{
+    word pTruthC[4];
+    int k, pArrTimeProfileC[8], pLits[8];
+    char pPerm[8], * pSolC;
+    unsigned uPhase;
+
+    uPhase = Ses_StoreCanonicize( pTruth, nVars, pArrTimeProfile, pTruthC, pArrTimeProfileC, pPerm );
+    memcpy( pTruth, pTruthC, sizeof(word) * 4 );
+    memcpy( pArrTimeProfile, pArrTimeProfileC, sizeof(int) * nVars );
+    if ( *ppSol == NULL )
+        return;
+
+    /* input x[pPerm[k]] of the network becomes y[k] ^ ((uPhase >> k) & 1) */
+    for ( k = 0; k < nVars; ++k )
+        pLits[(int)pPerm[k]] = Abc_Var2Lit( k, (uPhase >> k) & 1 );
+    pSolC = ABC_CALLOC( char, 3 + 4 * (*ppSol)[ABC_EXACT_SOL_NGATES] + 2 + nVars );
+    Ses_StoreRemapSol( *ppSol, pSolC, pLits, (uPhase >> nVars) & 1 );
+    assert( Ses_StoreSolCheck( pSolC, pTruth ) );
+    ABC_FREE( *ppSol );
+    *ppSol = pSolC;
+}
+
+/***********************************************************************
+
+  Synopsis    [Persistent cache file shared by several processes.]
+
+***********************************************************************/
+
+static unsigned Ses_StoreCacheChecksum( Ses_DiskEntry_t * pEntry )
+{
+    unsigned char * p = (unsigned char *)pEntry;
+    unsigned uChecksum = 2166136261u, uSaved = pEntry->uChecksum;
+    int i;
+    pEntry->uChecksum = 0;
+    for ( i = 0; i < (int)sizeof(Ses_DiskEntry_t); ++i )
+        uChecksum = (uChecksum ^ p[i]) * 16777619u;
+    pEntry->uChecksum = uSaved;
+    return uChecksum;
+}
+
+// copies the record at the given position and checks it; returns 0 if the
+// position is not the start of a valid record
+static int Ses_StoreCacheReadEntry( char * pData, Ses_DiskEntry_t * pEntry )
+{
+    unsigned uMagic;
+    memcpy( &uMagic, pData, sizeof(unsigned) );
+    if ( uMagic != SES_DISK_MAGIC )
+        return 0;
+    memcpy( pEntry, pData, sizeof(Ses_DiskEntry_t) );
+    return pEntry->nEntrySize == SES_DISK_ENTRY_SIZE && pEntry->uChecksum == Ses_StoreCacheChecksum( pEntry ) &&
+           pEntry->nVars >= 2 && pEntry->nVars <= 8 && pEntry->nSolSize <= SES_DISK_SOL_MAX &&
+           pEntry->nSolSize == 3 + 4 * pEntry->pSol[ABC_EXACT_SOL_NGATES] + 2 + pEntry->nVars;
+}
+
+// reads the records appended since the last call; returns the number of new entries
+static int Ses_StoreCacheSync( Ses_Store_t * pStore )
+{
+    int nLoaded = 0;
+#ifdef SES_USE_CACHE_FILE
+    Ses_DiskEntry_t Entry;
+    struct stat Stat;
+    size_t nSize, nStart, nOffset, nBadStart = 0;
+    int fSkipping = 0;
+    char * pData, * pSol;
+
+    if ( pStore->fdCache == -1 )
+        return 0;
+    flock( pStore->fdCache, LOCK_SH );
+    if ( fstat( pStore->fdCache, &Stat ) != 0 || (size_t)Stat.st_size < pStore->nCacheRead + SES_DISK_ENTRY_SIZE )
+    {
+        flock( pStore->fdCache, LOCK_UN );
+        return 0;
+    }
+    nSize  = (size_t)Stat.st_size;
+    nStart = pStore->nCacheRead & ~((size_t)sysconf( _SC_PAGESIZE ) - 1);
+    pData  = (char *)mmap( NULL, nSize - nStart, PROT_READ, MAP_SHARED, pStore->fdCache, (off_t)nStart );
+    flock( pStore->fdCache, LOCK_UN );
+    if ( pData == MAP_FAILED )
+        return 0;
+
+    nOffset = pStore->nCacheRead;
+    while ( nOffset + SES_DISK_ENTRY_SIZE <= nSize )
+    {
+        /* skip the bytes of a torn record until the next valid record is found */
+        if ( !Ses_StoreCacheReadEntry( pData + nOffset - nStart, &Entry ) )
+        {
+            if ( !fSkipping )
+                nBadStart = nOffset;
+            fSkipping = 1;
+            nOffset++;
+            continue;
+        }
+        if ( fSkipping )
+            pStore->nCacheBad++;
+        fSkipping = 0;
+        nOffset += SES_DISK_ENTRY_SIZE;
+        if ( Entry.fMakeAIG != pStore->fMakeAIG )
+            continue;
+        if ( Ses_StoreGetEntrySimple( pStore, Entry.pTruth, Entry.nVars, Entry.pArrTimeProfile, &pSol ) )
+            continue;
+        pSol = ABC_ALLOC( char, Entry.nSolSize );
+        memcpy( pSol, Entry.pSol, (size_t)Entry.nSolSize );
+        Ses_StoreInsert( pStore, Entry.pTruth, Entry.nVars, Entry.pArrTimeProfile, pSol, 0 );
+        pStore->nCacheLoaded++;
+        nLoaded++;
+    }
+    /* a torn record at the end is skipped once the next record is appended */
+    pStore->nCacheRead = fSkipping ? nBadStart : nOffset;
+    munmap( pData, nSize - nStart );
+#endif
+    return nLoaded;
+}
+
+// appends the synthesized network to the cache file
+static void Ses_StoreCacheAppend( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol )
+{
+#ifdef SES_USE_CACHE_FILE
+    Ses_DiskEntry_t Entry;
+    int nSolSize = 3 + 4 * pSol[ABC_EXACT_SOL_NGATES] + 2 + nVars;
+
+    if ( pStore->fdCache == -1 || nSolSize > SES_DISK_SOL_MAX )
+        return;
+    assert( sizeof(Ses_DiskEntry_t) == SES_DISK_ENTRY_SIZE );
+    memset( &Entry, 0, sizeof(Ses_DiskEntry_t) );
+    Entry.uMagic     = SES_DISK_MAGIC;
+    Entry.nEntrySize = SES_DISK_ENTRY_SIZE;
+    memcpy( Entry.pTruth, pTruth, sizeof(word) * Abc_TtWordNum( nVars ) );
+    Entry.nVars    = nVars;
+    Entry.fMakeAIG = pStore->fMakeAIG;
+    Ses_StoreTimesCopy( Entry.pArrTimeProfile, pArrTimeProfile, nVars );
+    Entry.nSolSize = nSolSize;
+    memcpy( Entry.pSol, pSol, (size_t)nSolSize );
+    Entry.uChecksum = Ses_StoreCacheChecksum( &Entry );
+
+    flock( pStore->fdCache, LOCK_EX );
+    if ( write( pStore->fdCache, &Entry, sizeof(Ses_DiskEntry_t) ) == sizeof(Ses_DiskEntry_t) )
+        pStore->nCacheStored++;
+    else
+        printf( "cannot append to the cache file \"%s\"\n", pStore->szCacheName );
+    flock( pStore->fdCache, LOCK_UN );
+#endif
+}
+
+// opens the cache file (creating it if needed) and reads its records
+static void Ses_StoreCacheOpen( Ses_Store_t * pStore, const char * pFilename )
+{
+#ifdef SES_USE_CACHE_FILE
+    char pHeader[SES_DISK_HEADER_SIZE];
+    struct stat Stat;
+    int fd, fValid = 0;
+
+    fd = open( pFilename, O_RDWR | O_CREAT | O_APPEND, 0666 );
+    if ( fd == -1 )
+    {
+        printf( "cannot open cache file \"%s\"\n", pFilename );
+        return;
+    }
+    flock( fd, LOCK_EX );
+    if ( fstat( fd, &Stat ) == 0 && Stat.st_size == 0 )
+        fValid = write( fd, SES_DISK_HEADER, SES_DISK_HEADER_SIZE ) == SES_DISK_HEADER_SIZE;
+    else
+        fValid = pread( fd, pHeader, SES_DISK_HEADER_SIZE, 0 ) == SES_DISK_HEADER_SIZE && !memcmp( pHeader, SES_DISK_HEADER, SES_DISK_HEADER_SIZE );
+    flock( fd, LOCK_UN );
+    if ( !fValid )
+    {
+        printf( "file \"%s\" is not a cache file\n", pFilename );
+        close( fd );
+        return;
+    }
+    pStore->fdCache     = fd;
+    pStore->szCacheName = Abc_UtilStrsav( (char *)pFilename );
+    pStore->nCacheRead  = SES_DISK_HEADER_SIZE;
+    Ses_StoreCacheSync( pStore );
+    if ( pStore->fVerbose )
+        printf( "read %d entries from cache file \"%s\"\n", pStore->nCacheLoaded, pFilename );
+#else
+    printf( "cache files are not supported on this platform\n" );
+#endif
+}
+
 // computes top decomposition of variables wrt. to AND and OR
 static inline void Ses_ManComputeTopDec( Ses_Man_t * pSes )
 {
@@ -1784,8 +2155,9 @@ static Abc_Ntk_t * Ses_ManExtractNtk( char const * pSol )
     p = pSol + 3;
     for ( i = 0; i < pSol[ABC_EXACT_SOL_NGATES]; ++i )
     {
-        pGateTruth[2] = '0' + ( *p & 1 );
-        pGateTruth[1] = '0' + ( ( *p >> 1 ) & 1 );
+        /* bit 0 is the value for (j,k) = (0,1) and bit 1 is the value for (j,k) = (1,0) */
+        pGateTruth[2] = '0' + ( ( *p >> 1 ) & 1 );
+        pGateTruth[1] = '0' + ( *p & 1 );
         pGateTruth[0] = '0' + ( ( *p >> 2 ) & 1 );
         ++p;
 
@@ -2613,7 +2985,7 @@ int Abc_ExactInputNum()
     return 8;
 }
 // start exact store manager
-void Abc_ExactStart( int nBTLimit, int fMakeAIG, int fVerbose, int fVeryVerbose, const char * pFilename )
+void Abc_ExactStart( int nBTLimit, int fMakeAIG, int fVerbose, int fVeryVerbose, const char * pFilename, const char * pCacheName )
 {
     if ( !s_pSesStore )
     {
@@ -2626,6 +2998,8 @@ void Abc_ExactStart( int nBTLimit, int fMakeAIG, int fVerbose, int fVeryVerbose,
             s_pSesStore->szDBName = ABC_CALLOC( char, strlen( pFilename ) + 1 );
             strcpy( s_pSesStore->szDBName, pFilename );
         }
+        if ( pCacheName )
+            Ses_StoreCacheOpen( s_pSesStore, pCacheName );
         if ( s_pSesStore->fVeryVerbose )
         {
             s_pSesStore->pDebugEntries = fopen( "bms.debug", "w" );
@@ -2644,6 +3018,7 @@ void Abc_ExactStop( const char * pFilename )
         if ( s_pSesStore->pDebugEntries )
             fclose( s_pSesStore->pDebugEntries );
         Ses_StoreClean( s_pSesStore );
+        s_pSesStore = NULL;
     }
     else
         printf( "BMS manager has not been started\n" );
@@ -2694,6 +3069,13 @@ void Abc_ExactStats()
     printf( "number of entries         : %d\n", s_pSesStore->nEntriesCount );
     printf( "number of valid entries   : %d\n", s_pSesStore->nValidEntriesCount );
     printf( "number of invalid entries : %d\n", s_pSesStore->nEntriesCount - s_pSesStore->nValidEntriesCount );
+    if ( s_pSesStore->szCacheName )
+    {
+        printf( "cache file                : %s\n", s_pSesStore->szCacheName );
+        printf( " - entries loaded         : %d\n", s_pSesStore->nCacheLoaded );
+        printf( " - entries stored         : %d\n", s_pSesStore->nCacheStored );
+        printf( " - corrupted records      : %d\n", s_pSesStore->nCacheBad );
+    }
     printf( "-------------------------------------------------------------------------------------------------------------------------------\n" );
     printf( "number of SAT calls       : %lu\n", s_pSesStore->nSatCalls );
     printf( "number of UNSAT calls     : %lu\n", s_pSesStore->nUnsatCalls );
@@ -2718,7 +3100,10 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
     int i, nMaxArrival, nDelta, l;
     Ses_Man_t * pSes = NULL;
     char * pSol = NULL, * pSol2 = NULL, * p;
-    int pNormalArrTime[8];
+    int pNormalArrTime[8], pCanonArrTime[8];
+    word pCanonTruth[4];
+    char pCanonPerm[8];
+    unsigned uCanonPhase;
     int Delay = ABC_INFINITY, nMaxDepth, fResLimit;
     abctime timeStart = Abc_Clock(), timeStartExact;
 
@@ -2758,10 +3143,13 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
         pNormalArrTime[l] = pArrTimeProfile[l];
 
     nDelta = Abc_NormalizeArrivalTimes( pNormalArrTime, nVars, &nMaxArrival );
+    uCanonPhase = Ses_StoreCanonicize( pTruth, nVars, pNormalArrTime, pCanonTruth, pCanonArrTime, pCanonPerm );
 
     *Cost = ABC_INFINITY;
 
-    if ( Ses_StoreGetEntry( s_pSesStore, pTruth, nVars, pNormalArrTime, &pSol ) )
+    /* look up the canonical form (the cache file is checked before running exact synthesis) */
+    if ( Ses_StoreGetEntry( s_pSesStore, pCanonTruth, nVars, pCanonArrTime, &pSol ) ||
+         (Ses_StoreCacheSync( s_pSesStore ) && Ses_StoreGetEntry( s_pSesStore, pCanonTruth, nVars, pCanonArrTime, &pSol )) )
     {
         s_pSesStore->nCacheHits++;
         s_pSesStore->pCacheHits[nVars]++;
@@ -2789,7 +3177,7 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
 
         timeStartExact = Abc_Clock();
 
-        pSes = Ses_ManAlloc( pTruth, nVars, 1 /* nSpecFunc */, nMaxDepth, pNormalArrTime, s_pSesStore->fMakeAIG, s_pSesStore->nBTLimit, s_pSesStore->fVerbose );
+        pSes = Ses_ManAlloc( pCanonTruth, nVars, 1 /* nSpecFunc */, nMaxDepth, pCanonArrTime, s_pSesStore->fMakeAIG, s_pSesStore->nBTLimit, s_pSesStore->fVerbose );
         pSes->fVeryVerbose = s_pSesStore->fVeryVerbose;
         pSes->pSat = s_pSesStore->pSat;
         pSes->nStartGates = nVars - 2;
@@ -2830,7 +3218,7 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
 
         /* log unsuccessful case for debugging */
         if ( s_pSesStore->pDebugEntries && pSes->fHitResLimit )
-            Ses_StorePrintDebugEntry( s_pSesStore, pTruth, nVars, pNormalArrTime, pSes->nMaxDepth, pSol, nVars - 2 );
+            Ses_StorePrintDebugEntry( s_pSesStore, pCanonTruth, nVars, pCanonArrTime, pSes->nMaxDepth, pSol, nVars - 2 );
 
         pSes->timeTotal = Abc_Clock() - timeStartExact;
 
@@ -2851,11 +3239,14 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
         Ses_ManCleanLight( pSes );
 
         /* store solution */
-        Ses_StoreAddEntry( s_pSesStore, pTruth, nVars, pNormalArrTime, pSol, fResLimit );
+        Ses_StoreAddEntry( s_pSesStore, pCanonTruth, nVars, pCanonArrTime, pSol, fResLimit );
+        if ( pSol && !fResLimit )
+            Ses_StoreCacheAppend( s_pSesStore, pCanonTruth, nVars, pCanonArrTime, pSol );
     }
 
     if ( pSol )
     {
+        pSol = Ses_StoreSolUncanonicize( s_pSesStore, pSol, pTruth, pCanonPerm, uCanonPhase );
         *Cost = pSol[ABC_EXACT_SOL_NGATES];
         p = pSol + 3 + 4 * pSol[ABC_EXACT_SOL_NGATES] + 1;
         Delay = *p++;
@@ -2895,7 +3286,10 @@ Abc_Obj_t * Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile,
 {
     char * pSol = NULL;
     int i, j, nMaxArrival;
-    int pNormalArrTime[8];
+    int pNormalArrTime[8], pCanonArrTime[8];
+    word pCanonTruth[4];
+    char pCanonPerm[8];
+    unsigned uCanonPhase;
     char const * p;
     Abc_Obj_t * pObj;
     Vec_Ptr_t * pGates;
@@ -2917,12 +3311,13 @@ Abc_Obj_t * Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile,
     for ( i = 0; i < nVars; ++i )
         pNormalArrTime[i] = pArrTimeProfile[i];
     Abc_NormalizeArrivalTimes( pNormalArrTime, nVars, &nMaxArrival );
-    assert( Ses_StoreGetEntry( s_pSesStore, pTruth, nVars, pNormalArrTime, &pSol ) );
-    if ( !pSol )
+    uCanonPhase = Ses_StoreCanonicize( pTruth, nVars, pNormalArrTime, pCanonTruth, pCanonArrTime, pCanonPerm );
+    if ( !Ses_StoreGetEntry( s_pSesStore, pCanonTruth, nVars, pCanonArrTime, &pSol ) || !pSol )
     {
         s_pSesStore->timeTotal += ( Abc_Clock() - timeStart );
         return NULL;
     }
+    pSol = Ses_StoreSolUncanonicize( s_pSesStore, pSol, pTruth, pCanonPerm, uCanonPhase );
 
     assert( pSol[ABC_EXACT_SOL_NVARS] == nVars );
     assert( pSol[ABC_EXACT_SOL_NFUNC] == 1 );
@@ -2942,8 +3337,9 @@ Abc_Obj_t * Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile,
     p = pSol + 3;
     for ( i = 0; i < pSol[ABC_EXACT_SOL_NGATES]; ++i )
     {
-        pGateTruth[2] = '0' + ( *p & 1 );
-        pGateTruth[1] = '0' + ( ( *p >> 1 ) & 1 );
+        /* bit 0 is the value for (j,k) = (0,1) and bit 1 is the value for (j,k) = (1,0) */
+        pGateTruth[2] = '0' + ( ( *p >> 1 ) & 1 );
+        pGateTruth[1] = '0' + ( *p & 1 );
         pGateTruth[0] = '0' + ( ( *p >> 2 ) & 1 );
         ++p;
 
@@ -2999,7 +3395,7 @@ void Abc_ExactStoreTest( int fVerbose )
     }
     Abc_NodeFreeNames( vNames );
 
-    Abc_ExactStart( 10000, 1, fVerbose, 0, NULL );
+    Abc_ExactStart( 10000, 1, fVerbose, 0, NULL, NULL );
 
     assert( !Abc_ExactBuildNode( pTruth, 4, pArrTimeProfile, pFanins, pNtk ) );
 
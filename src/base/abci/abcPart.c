@@ -1357,8 +1357,12 @@ Vec_Int_t * Abc_NtkStochProcess( Vec_Ptr_t * vWins, char * pScript, int nProcs,
         Vec_PtrPush( vData, pData+i );
     }
     Util_ProcessThreads( Abc_NtkStochProcess1, vData, nProcs, TimeSecs, fVerbose );
-    // replace old AIGs by new AIGs
+    // replace old AIGs by new AIGs (keep the old network if the entry was skipped)
     Vec_PtrForEachEntry( Abc_Ntk_t *, vWins, pNtk, i ) {
+        if ( pData[i].pOut == NULL ) {
+            Vec_IntWriteEntry( vGains, i, 0 );
+            continue;
+        }
         if ( Abc_NtkIsMappedLogic(pNtk) )
             Vec_IntWriteEntry( vGains, i, (int)(Abc_NtkGetMappedArea(pNtk) - Abc_NtkGetMappedArea(pData[i].pOut)) );
         else
@@ -365,8 +365,8 @@ int Abc_NtkRefactor( Abc_Ntk_t * pNtk, int nNodeSizeMax, int nMinSaved, int nCon
         // skip the nodes with many fanouts
         if ( Abc_ObjFanoutNum(pNode) > 1000 )
             continue;
-        // stop if all nodes have been tried once
-        if ( i >= nNodes )
+        // stop if all nodes have been tried once or the current task is cancelled
+        if ( i >= nNodes || ((i & 0xFF) == 0 && Util_TaskStop()) )
             break;
         // compute a reconvergence-driven cut
 clk = Abc_Clock();
@@ -111,8 +111,8 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
         Extra_ProgressBarUpdate( pProgress, i, NULL );
-        // stop if all nodes have been tried once
-        if ( i >= nNodes )
+        // stop if all nodes have been tried once or the current task is cancelled
+        if ( i >= nNodes || ((i & 0xFF) == 0 && Util_TaskStop()) )
             break;
         // skip persistant nodes
         if ( Abc_NodeIsPersistant(pNode) )
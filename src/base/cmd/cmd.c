@@ -38,6 +38,7 @@ ABC_NAMESPACE_IMPL_START
 
 static int CmdCommandTime          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandSleep         ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandProfile       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandEcho          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandQuit          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandAbcrc         ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -94,6 +95,7 @@ void Cmd_Init( Abc_Frame_t * pAbc )
 
     Cmd_CommandAdd( pAbc, "Basic", "time",          CmdCommandTime,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "sleep",         CmdCommandSleep,           0 );
+    Cmd_CommandAdd( pAbc, "Basic", "profile",       CmdCommandProfile,         0 );
     Cmd_CommandAdd( pAbc, "Basic", "echo",          CmdCommandEcho,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "quit",          CmdCommandQuit,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "abcrc",         CmdCommandAbcrc,           0 );
@@ -146,6 +148,7 @@ void Cmd_End( Abc_Frame_t * pAbc )
     st__generator * gen;
     char * pKey, * pValue;
     Cmd_HistoryWrite( pAbc, ABC_INFINITY );
+    Cmd_TraceStop( pAbc );
 
 //    st__free_table( pAbc->tCommands, (void (*)()) 0, CmdCommandFree );
 //    st__free_table( pAbc->tAliases,  (void (*)()) 0, CmdCommandAliasFree );
@@ -294,6 +297,53 @@ int CmdCommandSleep( Abc_Frame_t * pAbc, int argc, char **argv )
     fprintf( pAbc->Err, "\t<file_name> : (optional) waiting begins after the file is created\n" );    
     return 1;
 }
+
+/**Function********************************************************************
+
+  Synopsis    [Starts and stops recording the trace of the commands.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int CmdCommandProfile( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    int c;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( argc > globalUtilOptind + 1 )
+        goto usage;
+    if ( argc == globalUtilOptind + 1 )
+        Cmd_TraceStart( pAbc, argv[globalUtilOptind] );
+    else if ( Cmd_TraceIsStarted( pAbc ) )
+        Cmd_TraceStop( pAbc );
+    else
+        fprintf( pAbc->Err, "The command trace is not being recorded.\n" );
+    return 0;
+
+  usage:
+    fprintf( pAbc->Err, "usage: profile [-h] <file_name>\n" );
+    fprintf( pAbc->Err, "\t              starts recording the trace of the commands into the file\n" );
+    fprintf( pAbc->Err, "\t              (without the file name, stops recording and writes the file)\n" );
+    fprintf( pAbc->Err, "\t              the trace is written in Chrome trace event format (JSON)\n" );
+    fprintf( pAbc->Err, "\t              with wall and CPU time, peak RSS change and AIG size for\n" );
+    fprintf( pAbc->Err, "\t              each command, including those called from scripts and aliases\n" );
+    fprintf( pAbc->Err, "\t-h          : print the command usage\n" );
+    fprintf( pAbc->Err, "\t<file_name> : the output file (e.g. trace.json)\n" );
+    return 1;
+}
 /**Function********************************************************************
 
   Synopsis    []
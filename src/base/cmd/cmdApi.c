@@ -194,7 +194,8 @@ int Cmd_CommandExecute( Abc_Frame_t * pAbc, const char * sCommand )
 {
     int fStatus = 0, argc, loop;
     const char * sCommandNext;
-    char **argv;
+    char **argv, * pAlias;
+    Cmd_TraceSpan_t Span;
 
     if ( !pAbc->fAutoexac && !pAbc->fSource ) 
         Cmd_HistoryAddCommand(pAbc, sCommand);
@@ -205,9 +206,21 @@ int Cmd_CommandExecute( Abc_Frame_t * pAbc, const char * sCommand )
             break;
         sCommandNext = CmdSplitLine( pAbc, sCommandNext, &argc, &argv );
         loop = 0;
+        // when tracing, aliases are recorded as the parents of the commands they expand into
+        pAlias = NULL;
+        if ( Cmd_TraceIsStarted(pAbc) && argc > 0 && st__is_member( pAbc->tAliases, argv[0] ) )
+        {
+            pAlias = Abc_UtilStrsav( argv[0] );
+            Cmd_TraceSpanStart( pAbc, &Span );
+        }
         fStatus = CmdApplyAlias( pAbc, &argc, &argv, &loop );
         if ( fStatus == 0 ) 
             fStatus = CmdCommandDispatch( pAbc, &argc, &argv );
+        if ( pAlias )
+        {
+            Cmd_TraceSpanStop( pAbc, &Span, 1, &pAlias, fStatus );
+            ABC_FREE( pAlias );
+        }
         CmdFreeArgv( argc, argv );
     } 
     while ( fStatus == 0 && *sCommandNext != '\0' );
@@ -48,6 +48,19 @@ struct MvCommand
     int           fChange;     // set to 1 to mark that the network is changed
 };
 
+// the state of the process before the command (used for tracing)
+typedef struct Cmd_TraceSpan_t_ Cmd_TraceSpan_t;
+struct Cmd_TraceSpan_t_
+{
+    int           fStarted;    // the tracing was on when the command started
+    int           iTrace;      // the trace that was on when the command started
+    abctime       clkWall;     // the wall time
+    abctime       clkCpu;      // the CPU time
+    word          nRssKb;      // the peak resident set size
+    int           nGiaAnds;    // the number of AND nodes in the current GIA
+    int           nNtkNodes;   // the number of nodes in the current network
+};
+
 struct MvAlias
 {
     char *        sName;       // the alias name
@@ -68,6 +81,12 @@ extern void       CmdCommandAliasAdd( Abc_Frame_t * pAbc, char * sName, int argc
 extern void       CmdCommandAliasPrint( Abc_Frame_t * pAbc, Abc_Alias * pAlias );
 extern char *     CmdCommandAliasLookup( Abc_Frame_t * pAbc, char * sCommand );
 extern void       CmdCommandAliasFree( Abc_Alias * p );
+/*=== cmdTrace.c =======================================================*/
+extern int        Cmd_TraceIsStarted( Abc_Frame_t * pAbc );
+extern void       Cmd_TraceStart( Abc_Frame_t * pAbc, char * pFileName );
+extern void       Cmd_TraceStop( Abc_Frame_t * pAbc );
+extern void       Cmd_TraceSpanStart( Abc_Frame_t * pAbc, Cmd_TraceSpan_t * pSpan );
+extern void       Cmd_TraceSpanStop( Abc_Frame_t * pAbc, Cmd_TraceSpan_t * pSpan, int argc, char ** argv, int fError );
 /*=== cmdUtils.c =======================================================*/
 extern int        CmdCommandDispatch( Abc_Frame_t * pAbc, int * argc, char *** argv );
 extern const char *     CmdSplitLine( Abc_Frame_t * pAbc, const char * sCommand, int * argc, char *** argv );
@@ -0,0 +1,230 @@
+/**CFile****************************************************************
+
+  FileName    [cmdTrace.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Recording the trace of executed commands.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: cmdTrace.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+#include "cmdInt.h"
+
+#if !defined(_WIN32) && !defined(__wasm)
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the trace of the commands executed since the tracing has started
+typedef struct Cmd_Trace_t_ Cmd_Trace_t;
+struct Cmd_Trace_t_
+{
+    char *         pFileName;     // the output file
+    int            Id;            // the number of this trace
+    abctime        clkStart;      // the time when the tracing started
+    int            nEvents;       // the number of recorded events
+    int            nDepth;        // the current nesting level
+    Vec_Str_t *    vEvents;       // the text of the recorded events
+};
+
+static int s_nTraces = 0;  // the number of traces started
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the peak resident set size of the process (in KB).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Cmd_TracePeakRss()
+{
+#if !defined(_WIN32) && !defined(__wasm)
+    struct rusage Usage;
+    if ( getrusage( RUSAGE_SELF, &Usage ) )
+        return 0;
+#if defined(__APPLE__)
+    return (word)Usage.ru_maxrss >> 10;
+#else
+    return (word)Usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops tracing.]
+
+  Description [The trace is written in the Chrome trace event format,
+  which can be loaded into chrome://tracing or ui.perfetto.dev. When
+  the trace is restarted by a command, the commands that are running
+  (the command itself, its scripts and aliases) were started by the
+  previous trace, so the new trace keeps their nesting level but does
+  not record them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_TraceIsStarted( Abc_Frame_t * pAbc )
+{
+    return pAbc->pCmdTrace != NULL;
+}
+void Cmd_TraceStart( Abc_Frame_t * pAbc, char * pFileName )
+{
+    Cmd_Trace_t * p;
+    int nDepth = 0;
+    if ( pAbc->pCmdTrace )
+    {
+        nDepth = ((Cmd_Trace_t *)pAbc->pCmdTrace)->nDepth;
+        Cmd_TraceStop( pAbc );
+    }
+    p = ABC_CALLOC( Cmd_Trace_t, 1 );
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    p->Id        = ++s_nTraces;
+    p->nDepth    = nDepth;
+    p->clkStart  = Abc_Clock();
+    p->vEvents   = Vec_StrAlloc( 1 << 16 );
+    pAbc->pCmdTrace = p;
+}
+void Cmd_TraceStop( Abc_Frame_t * pAbc )
+{
+    Cmd_Trace_t * p = (Cmd_Trace_t *)pAbc->pCmdTrace;
+    FILE * pFile;
+    if ( p == NULL )
+        return;
+    pFile = fopen( p->pFileName, "wb" );
+    if ( pFile == NULL )
+        fprintf( pAbc->Err, "Cannot open file \"%s\" for writing the command trace.\n", p->pFileName );
+    else
+    {
+        fprintf( pFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+        fwrite( Vec_StrArray(p->vEvents), 1, Vec_StrSize(p->vEvents), pFile );
+        fprintf( pFile, "\n]}\n" );
+        fclose( pFile );
+    }
+    Vec_StrFree( p->vEvents );
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+    pAbc->pCmdTrace = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the state before the command.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_TraceReadSizes( Abc_Frame_t * pAbc, int * pnGia, int * pnNtk )
+{
+    *pnGia = pAbc->pGia    ? Gia_ManAndNum(pAbc->pGia)     : -1;
+    *pnNtk = pAbc->pNtkCur ? Abc_NtkNodeNum(pAbc->pNtkCur) : -1;
+}
+void Cmd_TraceSpanStart( Abc_Frame_t * pAbc, Cmd_TraceSpan_t * pSpan )
+{
+    Cmd_Trace_t * p = (Cmd_Trace_t *)pAbc->pCmdTrace;
+    pSpan->fStarted = (p != NULL);
+    if ( p == NULL )
+        return;
+    p->nDepth++;
+    pSpan->iTrace  = p->Id;
+    pSpan->clkWall = Abc_Clock();
+    pSpan->clkCpu  = clock();
+    pSpan->nRssKb  = Cmd_TracePeakRss();
+    Cmd_TraceReadSizes( pAbc, &pSpan->nGiaAnds, &pSpan->nNtkNodes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the event for the completed command.]
+
+  Description [The events are "complete" events (phase "X"), so that the
+  nesting of commands invoked from scripts and aliases is recovered by
+  the viewer from their time intervals.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_TracePrintString( Vec_Str_t * vStr, char * pStr )
+{
+    for ( ; *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            Vec_StrPush( vStr, '\\' );
+        if ( (unsigned char)*pStr >= ' ' )
+            Vec_StrPush( vStr, *pStr );
+    }
+}
+void Cmd_TraceSpanStop( Abc_Frame_t * pAbc, Cmd_TraceSpan_t * pSpan, int argc, char ** argv, int fError )
+{
+    Cmd_Trace_t * p = (Cmd_Trace_t *)pAbc->pCmdTrace;
+    abctime clkWall = Abc_Clock(), clkCpu = clock();
+    int i, nGiaAnds, nNtkNodes;
+    if ( p == NULL || !pSpan->fStarted )
+        return;
+    if ( p->nDepth > 0 )
+        p->nDepth--;
+    // the command was started by another trace
+    if ( argc == 0 || pSpan->iTrace != p->Id )
+        return;
+    Cmd_TraceReadSizes( pAbc, &nGiaAnds, &nNtkNodes );
+    if ( p->nEvents++ )
+        Vec_StrPrintStr( p->vEvents, ",\n" );
+    Vec_StrPrintStr( p->vEvents, "{\"name\":\"" );
+    Cmd_TracePrintString( p->vEvents, argv[0] );
+    Vec_StrPrintF( p->vEvents, "\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.0f,\"dur\":%.0f,\"args\":{\"command\":\"",
+        p->nDepth ? "nested" : "command",
+        1000000.0 * (pSpan->clkWall - p->clkStart) / CLOCKS_PER_SEC,
+        1000000.0 * (clkWall - pSpan->clkWall) / CLOCKS_PER_SEC );
+    for ( i = 0; i < argc; i++ )
+    {
+        if ( i ) Vec_StrPush( p->vEvents, ' ' );
+        Cmd_TracePrintString( p->vEvents, argv[i] );
+    }
+    Vec_StrPrintF( p->vEvents, "\",\"cpu_ms\":%.3f,\"rss_peak_kb\":%llu,\"rss_peak_delta_kb\":%llu,\"gia_ands\":[%d,%d],\"ntk_nodes\":[%d,%d],\"status\":%d}}",
+        1000.0 * (clkCpu - pSpan->clkCpu) / CLOCKS_PER_SEC,
+        (unsigned long long)Cmd_TracePeakRss(), (unsigned long long)(Cmd_TracePeakRss() - pSpan->nRssKb),
+        pSpan->nGiaAnds, nGiaAnds, pSpan->nNtkNodes, nNtkNodes, fError );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -102,6 +102,7 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     Abc_Ntk_t * pNetCopy;
     int (*pFunc) ( Abc_Frame_t *, int, char ** );
     Abc_Command * pCommand;
+    Cmd_TraceSpan_t Span;
     char * value;
     int fError;
     double clk;
@@ -152,8 +153,10 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
 
     // execute the command
     clk = Extra_CpuTimeDouble();
+    Cmd_TraceSpanStart( pAbc, &Span );
     pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
     fError = (*pFunc)( pAbc, argc, argv );
+    Cmd_TraceSpanStop( pAbc, &Span, argc, argv, fError );
     pAbc->TimeCommand += Extra_CpuTimeDouble() - clk;
 
     // automatic execution of arbitrary command after each command 
@@ -2942,9 +2942,11 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
     int fNewAlgo    = 1;
     int fCnfObjIds  = 0;
     int fAddOrCla   = 1;
+    int fFastCnf    = 0;
+    int nProcs      = 1;
     int c, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Kaiovh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KPafiovh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -2957,6 +2959,20 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
                 nLutSize = atoi(argv[globalUtilOptind]);
                 globalUtilOptind++;
                 break;
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs <= 0 )
+                    goto usage;
+                break;
+            case 'f':
+                fFastCnf ^= 1;
+                break;
             case 'a':
                 fNewAlgo ^= 1;
                 break;
@@ -3006,17 +3022,21 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
         return 0;
     }
     fclose( pFile );
-    if ( fNewAlgo )
+    if ( fFastCnf )
+        Gia_ManCnfFastDump( pAbc->pGia, pFileName, fAddOrCla, nProcs, fVerbose );
+    else if ( fNewAlgo )
         Mf_ManDumpCnf( pAbc->pGia, pFileName, nLutSize, fCnfObjIds, fAddOrCla, fVerbose );
     else
         Jf_ManDumpCnf( pAbc->pGia, pFileName, fVerbose );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: &write_cnf [-Kaiovh] <file>\n" );
+    fprintf( pAbc->Err, "usage: &write_cnf [-KP num] [-afiovh] <file>\n" );
     fprintf( pAbc->Err, "\t           writes CNF produced by a new generator\n" );
     fprintf( pAbc->Err, "\t-K <num> : the LUT size (3 <= num <= 8) [default = %d]\n", nLutSize );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads used by the fast generator [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-a       : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
+    fprintf( pAbc->Err, "\t-f       : toggle using the fast generator (same CNF as \"write_cnf -f\") [default = %s]\n", fFastCnf? "yes" : "no" );
     fprintf( pAbc->Err, "\t-i       : toggle using AIG object IDs as CNF variables [default = %s]\n", fCnfObjIds? "yes" : "no" );
     fprintf( pAbc->Err, "\t-o       : toggle adding OR clause for the outputs [default = %s]\n", fAddOrCla? "yes" : "no" );
     fprintf( pAbc->Err, "\t-v       : toggle printing verbose information [default = %s]\n", fVerbose? "yes" : "no" );
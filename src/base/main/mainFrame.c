@@ -105,6 +105,7 @@ void        Abc_FrameSetNFrames( int nFrames )               { ABC_FREE( s_Globa
 void        Abc_FrameSetStatus( int Status )                 { ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->Status = Status;   }
 void        Abc_FrameSetManDsd( void * pMan )                { if (s_GlobalFrame->pManDsd  && s_GlobalFrame->pManDsd  != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd,  0); s_GlobalFrame->pManDsd = pMan;  }
 void        Abc_FrameSetManDsd2( void * pMan )               { if (s_GlobalFrame->pManDsd2 && s_GlobalFrame->pManDsd2 != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd2, 0); s_GlobalFrame->pManDsd2 = pMan; }
+void        Abc_FrameSetTtStore( void * pStore )             { if (s_GlobalFrame->pTtStore && s_GlobalFrame->pTtStore != pStore) If_TtStoreFree((If_TtStore_t *)s_GlobalFrame->pTtStore); s_GlobalFrame->pTtStore = pStore; }
 void        Abc_FrameSetInv( Vec_Int_t * vInv )              { Vec_IntFreeP(&s_GlobalFrame->pAbcWlcInv); s_GlobalFrame->pAbcWlcInv = vInv; }
 void        Abc_FrameSetJsonStrs( Abc_Nam_t * pStrs )        { Abc_NamDeref( s_GlobalFrame->pJsonStrs ); s_GlobalFrame->pJsonStrs = pStrs; }
 void        Abc_FrameSetJsonObjs( Vec_Wec_t * vObjs )        { Vec_WecFreeP(&s_GlobalFrame->vJsonObjs ); s_GlobalFrame->vJsonObjs = vObjs; }
@@ -128,6 +129,27 @@ void        Abc_FrameSetArrayMapping( int * p )              { ABC_FREE( s_Globa
 int *       Abc_FrameReadBoxes( Abc_Frame_t * pAbc )         { return pAbc->pBoxes;                                            }
 void        Abc_FrameSetBoxes( int * p )                     { ABC_FREE( s_GlobalFrame->pBoxes ); s_GlobalFrame->pBoxes = p;   }      
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the truth tables kept across mapping runs.]
+
+  Description [The store is restarted when it takes more than 128 MB,
+  so that long scripts mapping many designs do not accumulate memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_FrameReadTtStore()
+{
+    if ( s_GlobalFrame->pTtStore && If_TtStoreMemory((If_TtStore_t *)s_GlobalFrame->pTtStore) > (double)(1<<27) )
+        Abc_FrameSetTtStore( NULL );
+    if ( s_GlobalFrame->pTtStore == NULL )
+        s_GlobalFrame->pTtStore = If_TtStoreAlloc();
+    return s_GlobalFrame->pTtStore;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns 1 if the flag is enabled without value or with value 1.]
@@ -229,6 +251,7 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     if ( p->pSave4    )  Aig_ManStop( (Aig_Man_t *)p->pSave4 );
     if ( p->pManDsd   )  If_DsdManFree( (If_DsdMan_t *)p->pManDsd, 0 );
     if ( p->pManDsd2  )  If_DsdManFree( (If_DsdMan_t *)p->pManDsd2, 0 );
+    if ( p->pTtStore  )  If_TtStoreFree( (If_TtStore_t *)p->pTtStore );
     if ( p->pNtkBackup)  Abc_NtkDelete( p->pNtkBackup );
     if ( p->vPlugInComBinPairs ) 
     {
@@ -92,12 +92,14 @@ struct Abc_Frame_t_
     // used for runtime measurement
     double          TimeCommand;   // the runtime of the last command
     double          TimeTotal;     // the total runtime of all commands
+    void *          pCmdTrace;     // the trace of executed commands
     // temporary storage for structural choices
     Vec_Ptr_t *     vStore;        // networks to be used by choice
     // decomposition package    
     void *          pManDec;       // decomposition manager
     void *          pManDsd;       // decomposition manager
     void *          pManDsd2;      // decomposition manager
+    void *          pTtStore;      // truth tables of the cut functions kept across mapping runs
     // libraries for mapping
     void *          pLibLut[ABC_LUT_LIBS]; // the current LUT library
     void *          pLibCell;      // the current cell library
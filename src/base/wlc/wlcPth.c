@@ -76,13 +76,12 @@ void Wla_ManJoinThread( Wla_Man_t * pWla, int RunId )
         status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
     }
 
-    status = pthread_join( *(pthread_t *)(pWla->pThread), NULL );
-    assert( status == 0 );
-    ABC_FREE( pWla->pThread );
+    Util_TaskWait( (Util_Task_t *)pWla->pThread );
+    Util_TaskFree( (Util_Task_t *)pWla->pThread );
     pWla->pThread = NULL;
 }
     
-void * Wla_Bmc3Thread ( void * pArg )
+int Wla_Bmc3Task( void * pArg )
 {
     int status;
     int RetValue = -1;
@@ -136,20 +135,14 @@ void * Wla_Bmc3Thread ( void * pArg )
     Abc_NtkDelete( pAbcNtk );
     Aig_ManStop( pData->pAig );
     ABC_FREE( pData );
-
-    // quit this thread
-    pthread_exit( NULL );
-    assert(0);
-    return NULL;
+    return 1;
 }
 
 void Wla_ManConcurrentBmc3( Wla_Man_t * pWla, Aig_Man_t * pAig, Abc_Cex_t ** ppCex )
 {
-    int status;
     Bmc3_ThData_t * pData;
 
     assert( pWla->pThread == NULL );
-    pWla->pThread = (void *)ABC_CALLOC( pthread_t, 1 );
 
     pData = ABC_CALLOC( Bmc3_ThData_t, 1 );
     pData->pWla = pWla;
@@ -158,8 +151,7 @@ void Wla_ManConcurrentBmc3( Wla_Man_t * pWla, Aig_Man_t * pAig, Abc_Cex_t ** ppC
     pData->RunId = g_nRunIds;
     pData->fVerbose = pWla->pPars->fVerbose;
 
-    status = pthread_create( (pthread_t *)pWla->pThread, NULL, Wla_Bmc3Thread, pData );
-    assert( status == 0 );
+    pWla->pThread = (void *)Util_TaskSpawn( Wla_Bmc3Task, pData, 0 );
 }
 
 #endif // pthreads are used
@@ -84,6 +84,7 @@ typedef struct If_LibLut_t_  If_LibLut_t;
 typedef struct If_LibCell_t_ If_LibCell_t;
 typedef struct If_LibBox_t_  If_LibBox_t;
 typedef struct If_DsdMan_t_  If_DsdMan_t;
+typedef struct If_TtStore_t_ If_TtStore_t;
 typedef struct Ifn_Ntk_t_    Ifn_Ntk_t;
 
 typedef struct Ifif_Par_t_   Ifif_Par_t;
@@ -116,6 +117,7 @@ struct If_Par_t_
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
     int                nLutDecSize;   // the LUT size for decomposition
+    int                nThreads;      // the number of threads for cut enumeration
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -186,6 +188,14 @@ struct If_Par_t_
     int (* pFuncCell2) (If_Man_t *, word *, int, Vec_Str_t *, char **); //  procedure called for cut functions
     int (* pFuncWrite) (If_Man_t *);                                    //  procedure called for cut functions
     void *             pReoMan;       // reordering manager
+    If_TtStore_t *     pTtStore;      // truth tables kept across mapping runs
+};
+
+// truth tables of cut functions kept across mapping runs
+struct If_TtStore_t_
+{
+    Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1];   // truth table memory and hash table
+    Vec_Wec_t *        vTtIsops[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into ISOP
 };
 
 // the LUT library
@@ -275,6 +285,9 @@ struct If_Man_t_
     int                nCutsUselessAll;
     int                nCuts5, nCuts5a;
     If_DsdMan_t *      pIfDsdMan;     // DSD manager
+    int                fTtStore;      // truth tables are taken from pPars->pTtStore
+    int                nTtStoreBeg;   // the number of truth tables before this run
+    double             TtStoreMemBeg; // the memory of truth tables before this run
     Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1];   // truth table memory and hash table
     Vec_Wec_t *        vTtIsops[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into DSD
     Vec_Int_t *        vTtDsds[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into DSD
@@ -691,6 +704,10 @@ extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
+/*=== ifMapMt.c ===========================================================*/
+extern int             If_ManPerformMappingMtIsSupported( If_Man_t * p, int Mode );
+extern int             If_ManCrossCutMt( If_Man_t * p );
+extern void            If_ManPerformMappingMt( If_Man_t * p, int Mode, int fPreprocess, int fFirst, char * pLabel );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSat.c ==========================================================*/
@@ -712,6 +729,11 @@ extern int             If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut
 extern int             If_CutComputeTruthPerm( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1 );
 extern Vec_Mem_t *     If_DeriveHashTable6( int nVars, word Truth );
 extern int             If_CutCheckTruth6( If_Man_t * p, If_Cut_t * pCut );
+extern If_TtStore_t *  If_TtStoreAlloc();
+extern void            If_TtStoreFree( If_TtStore_t * p );
+extern Vec_Mem_t *     If_TtStoreMem( If_TtStore_t * p, int nVars );
+extern Vec_Wec_t *     If_TtStoreIsops( If_TtStore_t * p, int nVars );
+extern double          If_TtStoreMemory( If_TtStore_t * p );
 /*=== ifTune.c ===========================================================*/
 extern Ifn_Ntk_t *     Ifn_NtkParse( char * pStr );
 extern int             Ifn_NtkTtBits( char * pStr );
@@ -85,7 +85,10 @@ int If_ManPerformMapping( If_Man_t * p )
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    if ( p->pPars->nThreads > 1 )
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutMt(p)) );
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
@@ -143,8 +146,8 @@ int If_ManPerformMappingComb( If_Man_t * p )
     if ( p->pPars->fExpRed )
         If_ManImproveMapping( p );
 
-    // area flow oriented mapping
-    for ( i = 0; i < p->pPars->nFlowIters; i++ )
+    // area flow oriented mapping (recovery rounds are skipped once the current task is cancelled)
+    for ( i = 0; i < p->pPars->nFlowIters && !Util_TaskStop(); i++ )
     {
         If_ManPerformMappingRound( p, p->pPars->nCutsMax, 1, 0, 0, "Flow" );
         if ( p->pPars->fExpRed )
@@ -152,7 +155,7 @@ int If_ManPerformMappingComb( If_Man_t * p )
     }
 
     // area oriented mapping
-    for ( i = 0; i < p->pPars->nAreaIters; i++ )
+    for ( i = 0; i < p->pPars->nAreaIters && !Util_TaskStop(); i++ )
     {
         if ( p->pPars->fDumpFile && p->pPars->nLutSize <= 6 && i == p->pPars->nAreaIters-1 ) {
             p->vCuts = Vec_IntAlloc( 1 << 20 );
@@ -68,16 +68,31 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     {
         for ( v = 0; v <= p->pPars->nLutSize; v++ )
             p->nTruth6Words[v] = Abc_Truth6WordNum( v );
+        // reuse the truth tables of the previous runs unless other data is indexed by their IDs
+        // (the dumped file should contain only the truth tables of this run)
+        p->fTtStore = pPars->pTtStore && !pPars->fUseDsd && !pPars->fUseTtPerm && !pPars->fUseCofVars && !pPars->fUseAndVars && !pPars->fDumpFile;
         for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
-            p->vTtMem[v] = Vec_MemAllocForTT( v, pPars->fUseTtPerm );
+            p->vTtMem[v] = p->fTtStore ? If_TtStoreMem( pPars->pTtStore, v ) : Vec_MemAllocForTT( v, pPars->fUseTtPerm );
+        for ( v = 6; p->fTtStore && v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+            p->nTtStoreBeg += Vec_MemEntryNum( p->vTtMem[v] );
+        for ( v = 6; p->fTtStore && v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+            p->TtStoreMemBeg += Vec_MemMemory( p->vTtMem[v] );
         for ( v = 0; v < 6; v++ )
             p->vTtMem[v] = p->vTtMem[6];
         if ( p->pPars->fDelayOpt || pPars->nGateSize > 0 )
         {
-            for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
-                p->vTtIsops[v] = Vec_WecAlloc( 1000 );
-            for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
-                Vec_WecInit( p->vTtIsops[v], 2 );
+            if ( p->fTtStore )
+            {
+                for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+                    p->vTtIsops[v] = If_TtStoreIsops( pPars->pTtStore, v );
+            }
+            else
+            {
+                for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+                    p->vTtIsops[v] = Vec_WecAlloc( 1000 );
+                for ( v = 6; v <= Abc_MaxInt(6,p->pPars->nLutSize); v++ )
+                    Vec_WecInit( p->vTtIsops[v], 2 );
+            }
             for ( v = 0; v < 6; v++ )
                 p->vTtIsops[v] = p->vTtIsops[6];
         }
@@ -411,7 +426,8 @@ void If_ManStop( If_Man_t * p )
         If_ManCacheAnalize( p );
     if ( p->pPars->fVerbose && p->pPars->fTruth )
     {
-        int nUnique = 0, nMemTotal = 0;
+        // with the shared store, only the truth tables added by this run are counted
+        int nUnique = -p->nTtStoreBeg, nMemTotal = -(int)p->TtStoreMemBeg;
         for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
             nUnique += Vec_MemEntryNum(p->vTtMem[i]);
         for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
@@ -473,12 +489,15 @@ void If_ManStop( If_Man_t * p )
     Vec_IntFreeP( &p->vCutCosts );
     if ( p->vPairHash )
         Hash_IntManStop( p->vPairHash );
-    for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
-        Vec_MemHashFree( p->vTtMem[i] );
-    for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
-        Vec_MemFreeP( &p->vTtMem[i] );
-    for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
-        Vec_WecFreeP( &p->vTtIsops[i] );
+    if ( !p->fTtStore )
+    {
+        for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
+            Vec_MemHashFree( p->vTtMem[i] );
+        for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
+            Vec_MemFreeP( &p->vTtMem[i] );
+        for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
+            Vec_WecFreeP( &p->vTtIsops[i] );
+    }
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
         Vec_IntFreeP( &p->vTtOccurs[i] );
     Mem_FixedStop( p->pMemObj, 0 );
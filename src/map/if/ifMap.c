@@ -737,6 +737,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( p->pPars->nThreads > 1 && If_ManPerformMappingMtIsSupported(p, Mode) )
+        If_ManPerformMappingMt( p, Mode, fPreprocess, fFirst, pLabel );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
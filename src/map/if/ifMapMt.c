@@ -0,0 +1,393 @@
+/**CFile****************************************************************
+
+  FileName    [ifMapMt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Level-parallel mapping procedures.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: ifMapMt.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "if.h"
+#include "misc/extra/extra.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define IF_MT_PROC_MAX   64      // the max number of threads
+#define IF_MT_LEVEL_MIN  64      // levels with fewer nodes are mapped by the main thread
+
+typedef struct If_MapMt_t_ If_MapMt_t;
+typedef struct If_MapMtTh_t_ If_MapMtTh_t;
+
+// the data shared by the threads
+struct If_MapMt_t_
+{
+    If_Man_t *       p;             // the mapping manager
+    int              Mode;          // the mapping mode
+    int              fPreprocess;   // preprocessing round
+    int              fFirst;        // the first round
+    int              nThreads;      // the number of threads
+    If_Obj_t **      ppNodes;       // the nodes of the current level
+    int              nNodes;        // the number of nodes of the current level
+};
+
+// the data of one thread
+struct If_MapMtTh_t_
+{
+    If_MapMt_t *     pMt;           // the shared data
+    int              iThread;       // the thread number
+    int              nCutsMerged;   // the number of cuts merged
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the round can be performed level by level.]
+
+  Description [Level-parallel mapping is limited to the LUT mapping
+  without truth tables, choices, boxes, and user callbacks, and to the
+  delay-oriented rounds. The cut computation in this case depends only
+  on the cuts and the best cuts of the nodes with lower levels, which
+  are not modified while the level is being mapped. The area recovery
+  rounds update the references of the best cuts after each node, so
+  they are performed serially.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingMtIsSupported( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( Mode != 0 || p->pManTim || p->nChoices || p->vCuts )
+        return 0;
+    if ( pPars->fTruth || pPars->fUseTtPerm || pPars->fLiftLeaves || pPars->fPower || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->pFuncCell || pPars->pFuncCell2 || pPars->pLutStruct )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib || pPars->fUserLutDec || pPars->fUserLut2D ||
+         pPars->fUseDsdTune || pPars->fUseCofVars || pPars->fUseAndVars || pPars->fUse34Spec || pPars->fUseCheck1 || pPars->fUseCheck2 || pPars->fEnableCheck07 )
+        return 0;
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes in the order of their levels.]
+
+  Description [Returns the array of nodes and fills in the array of
+  the starting positions of the levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * If_ManCollectLevels( If_Man_t * p, Vec_Int_t * vStarts )
+{
+    Vec_Ptr_t * vNodes;
+    If_Obj_t * pObj;
+    int i, LevelMax = 0;
+    If_ManForEachNode( p, pObj, i )
+        LevelMax = Abc_MaxInt( LevelMax, If_ObjLevel(pObj) );
+    // count the nodes on each level
+    Vec_IntFill( vStarts, LevelMax + 2, 0 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_IntAddToEntry( vStarts, If_ObjLevel(pObj) + 1, 1 );
+    for ( i = 1; i < Vec_IntSize(vStarts); i++ )
+        Vec_IntAddToEntry( vStarts, i, Vec_IntEntry(vStarts, i-1) );
+    // place the nodes in the order of their IDs within each level
+    vNodes = Vec_PtrStart( Vec_IntEntryLast(vStarts) );
+    If_ManForEachNode( p, pObj, i )
+    {
+        int * pPlace = Vec_IntEntryP( vStarts, If_ObjLevel(pObj) );
+        Vec_PtrWriteEntry( vNodes, (*pPlace)++, pObj );
+    }
+    // restore the starting positions
+    for ( i = Vec_IntSize(vStarts) - 1; i > 0; i-- )
+        Vec_IntWriteEntry( vStarts, i, Vec_IntEntry(vStarts, i-1) );
+    Vec_IntWriteEntry( vStarts, 0, 0 );
+    return vNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut of the circuit when mapped by levels.]
+
+  Description [The cutsets of all nodes of one level are allocated
+  before any of them is dereferenced, so the cross-cut may be larger
+  than the one computed for the topological order by If_ManCrossCut().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutMt( If_Man_t * p )
+{
+    Vec_Int_t * vStarts = Vec_IntAlloc( 100 );
+    Vec_Ptr_t * vNodes = If_ManCollectLevels( p, vStarts );
+    If_Obj_t * pObj, * pFanin;
+    int i, k, nCutSize = 0, nCutSizeMax = 0;
+    for ( i = 0; i + 1 < Vec_IntSize(vStarts); i++ )
+    {
+        nCutSize += Vec_IntEntry(vStarts, i+1) - Vec_IntEntry(vStarts, i);
+        nCutSizeMax = Abc_MaxInt( nCutSizeMax, nCutSize );
+        for ( k = Vec_IntEntry(vStarts, i); k < Vec_IntEntry(vStarts, i+1); k++ )
+        {
+            pObj = (If_Obj_t *)Vec_PtrEntry( vNodes, k );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vStarts );
+    return nCutSizeMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the best cut for the given node.]
+
+  Description [This is the part of If_ObjPerformMappingAnd() restricted
+  to the parameters accepted by If_ManPerformMappingMtIsSupported().
+  The cutset is allocated and dereferenced by the calling thread before
+  and after the level is mapped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ObjPerformMappingAndMt( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst, int * pnCutsMerged )
+{
+    If_Set_t * pCutSet = pObj->pCutSet;
+    If_Cut_t * pCut0, * pCut1, * pCut;
+    int i, k;
+    int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
+    assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
+    assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
+    assert( pCutSet != NULL && pCutSet->nCuts == 0 );
+    assert( Mode == 0 );
+
+    // prepare
+    pObj->EstRefs = (float)pObj->nRefs;
+
+    // get the current assigned best cut
+    pCut = If_ObjCutBest(pObj);
+    if ( !fFirst )
+    {
+        // recompute the parameters of the best cut
+        pCut->Delay = If_CutDelay( p, pObj, pCut );
+        assert( pCut->Delay != -1 );
+        if ( pCut->Delay > pObj->Required + 2*p->fEpsilon )
+            Abc_Print( 1, "If_ObjPerformMappingAndMt(): Warning! Node with ID %d has delay (%f) exceeding the required times (%f).\n",
+                pObj->Id, pCut->Delay, pObj->Required + p->fEpsilon );
+        pCut->Area = If_CutAreaFlow( p, pCut );
+        if ( p->pPars->fEdge )
+            pCut->Edge = If_CutEdgeFlow( p, pCut );
+        // save the best cut from the previous iteration
+        if ( !fPreprocess || pCut->nLeaves <= 1 )
+            If_CutCopy( p, pCutSet->ppCuts[pCutSet->nCuts++], pCut );
+    }
+
+    // generate cuts
+    If_ObjForEachCut( pObj->pFanin0, pCut0, i )
+    If_ObjForEachCut( pObj->pFanin1, pCut1, k )
+    {
+        // get the next free cut
+        assert( pCutSet->nCuts <= pCutSet->nCutsMax );
+        pCut = pCutSet->ppCuts[pCutSet->nCuts];
+        // make sure K-feasible cut exists
+        if ( Abc_TtCountOnes((word)(pCut0->uSign | pCut1->uSign)) > p->pPars->nLutSize )
+            continue;
+        // merge the cuts
+        if ( !If_CutMergeOrdered( p, pCut0, pCut1, pCut ) )
+            continue;
+        if ( pObj->fSpec && pCut->nLeaves == (unsigned)p->pPars->nLutSize )
+            continue;
+        (*pnCutsMerged)++;
+        // check if this cut is contained in any of the available cuts
+        if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, 0 ) )
+            continue;
+        // check if the cut is a special AND-gate cut
+        pCut->fAndCut = fUseAndCut && pCut->nLeaves == 2 && pCut->pLeaves[0] == pObj->pFanin0->Id && pCut->pLeaves[1] == pObj->pFanin1->Id;
+        pCut->iCutFunc = -1;
+        pCut->fCompl = 0;
+        pCut->fUser = 0;
+        pCut->Cost = 0;
+        // check if the cut satisfies the required times
+        pCut->Delay = If_CutDelay( p, pObj, pCut );
+        if ( pCut->Delay == -1 )
+            continue;
+        // compute area of the cut
+        pCut->Area = If_CutAreaFlow( p, pCut );
+        if ( p->pPars->fEdge )
+            pCut->Edge = If_CutEdgeFlow( p, pCut );
+        // insert the cut into storage
+        If_CutSort( p, pCutSet, pCut );
+    }
+    assert( pCutSet->nCuts > 0 );
+
+    // update the best cut
+    if ( !fPreprocess || pCutSet->ppCuts[0]->Delay <= pObj->Required + p->fEpsilon )
+        If_CutCopy( p, If_ObjCutBest(pObj), pCutSet->ppCuts[0] );
+    // add the trivial cut to the set
+    if ( !pObj->fSkipCut && If_ObjCutBest(pObj)->nLeaves > 1 )
+    {
+        If_ManSetupCutTriv( p, pCutSet->ppCuts[pCutSet->nCuts++], pObj->Id );
+        assert( pCutSet->nCuts <= pCutSet->nCutsMax+1 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the share of the current level assigned to the thread.]
+
+  Description [The nodes of the level are distributed among the threads
+  in a round-robin fashion.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingMtSlice( If_MapMtTh_t * pTh, int nThreads )
+{
+    If_MapMt_t * pMt = pTh->pMt;
+    int k;
+    for ( k = pTh->iThread; k < pMt->nNodes; k += nThreads )
+        If_ObjPerformMappingAndMt( pMt->p, pMt->ppNodes[k], pMt->Mode, pMt->fPreprocess, pMt->fFirst, &pTh->nCutsMerged );
+}
+
+int If_ManPerformMappingMtTask( void * pArg )
+{
+    If_MapMtTh_t * pTh = (If_MapMtTh_t *)pArg;
+    If_ManPerformMappingMtSlice( pTh, pTh->pMt->nThreads );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping round level by level.]
+
+  Description [The nodes of each level are mapped concurrently. Before
+  the level is mapped, the cutsets of its nodes are allocated. After the
+  level is mapped, the cutsets are dereferenced in the order of node IDs.
+  Since each node is mapped using only the information of the nodes with
+  lower levels, the result is the same as that of the serial round,
+  independently of the number of threads. The shares of the level are
+  mapped by the tasks of the thread pool and by the calling thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingMt( If_Man_t * p, int Mode, int fPreprocess, int fFirst, char * pLabel )
+{
+    ProgressBar * pProgress = NULL;
+    If_MapMt_t Mt, * pMt = &Mt;
+    If_MapMtTh_t ThData[IF_MT_PROC_MAX];
+    Util_Task_t * pTasks[IF_MT_PROC_MAX];
+    Vec_Int_t * vStarts = Vec_IntAlloc( 100 );
+    Vec_Ptr_t * vNodes = If_ManCollectLevels( p, vStarts );
+    If_Obj_t * pObj;
+    int i, k, nThreads = Abc_MinInt( p->pPars->nThreads, IF_MT_PROC_MAX );
+    memset( pMt, 0, sizeof(If_MapMt_t) );
+    pMt->p           = p;
+    pMt->Mode        = Mode;
+    pMt->fPreprocess = fPreprocess;
+    pMt->fFirst      = fFirst;
+    pMt->nThreads    = nThreads;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pMt         = pMt;
+        ThData[i].iThread     = i;
+        ThData[i].nCutsMerged = 0;
+    }
+    if ( nThreads > 1 )
+        Util_PoolReserve( nThreads - 1 );
+    pProgress = Extra_ProgressBarStart( stdout, Vec_PtrSize(vNodes) );
+    for ( i = 0; i + 1 < Vec_IntSize(vStarts); i++ )
+    {
+        int iStart = Vec_IntEntry( vStarts, i );
+        int iStop  = Vec_IntEntry( vStarts, i+1 );
+        if ( iStart == iStop )
+            continue;
+        Extra_ProgressBarUpdate( pProgress, iStart, pLabel );
+        // prepare the nodes
+        for ( k = iStart; k < iStop; k++ )
+            If_ManSetupNodeCutSet( p, (If_Obj_t *)Vec_PtrEntry(vNodes, k) );
+        // map the nodes
+        pMt->ppNodes = (If_Obj_t **)Vec_PtrArray(vNodes) + iStart;
+        pMt->nNodes  = iStop - iStart;
+        if ( nThreads > 1 && pMt->nNodes >= IF_MT_LEVEL_MIN )
+        {
+            // the calling thread maps the first share
+            for ( k = 1; k < nThreads; k++ )
+                pTasks[k] = Util_TaskSubmit( If_ManPerformMappingMtTask, (void *)(ThData + k), 0 );
+            If_ManPerformMappingMtSlice( ThData, nThreads );
+            for ( k = 1; k < nThreads; k++ )
+            {
+                Util_TaskWait( pTasks[k] );
+                Util_TaskFree( pTasks[k] );
+            }
+        }
+        else
+            If_ManPerformMappingMtSlice( ThData, 1 );
+        // finalize the nodes
+        for ( k = iStart; k < iStop; k++ )
+        {
+            pObj = (If_Obj_t *)Vec_PtrEntry( vNodes, k );
+            if ( If_ObjCutBest(pObj)->fUseless )
+                Abc_Print( 1, "The best cut is useless.  Please increase the number of cuts used by the mapper, for example: \"&if -C 32\"\n" );
+            If_ManDerefNodeCutSet( p, pObj );
+        }
+    }
+    Extra_ProgressBarStop( pProgress );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        p->nCutsMerged += ThData[i].nCutsMerged;
+        p->nCutsTotal  += ThData[i].nCutsMerged;
+    }
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vStarts );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
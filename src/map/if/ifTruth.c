@@ -85,6 +85,30 @@ void If_CutRotatePins( If_Man_t * p, If_Cut_t * pCut )
     assert( (p->puTempW[0] & 1) == 0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Appends the ISOP of a new truth table.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_CutTruthIsopAdd( Vec_Wec_t * vIsops, word * pTruth, int nVars, Vec_Int_t * vCover )
+{
+    Vec_Int_t * vLevel = Vec_WecPushLevel( vIsops );
+    int fCompl = Kit_TruthIsop( (unsigned *)pTruth, nVars, vCover, 1 );
+    if ( fCompl >= 0 )
+    {
+        Vec_IntGrow( vLevel, Vec_IntSize(vCover) );
+        Vec_IntAppend( vLevel, vCover );
+        if ( fCompl )
+            vLevel->nCap ^= (1<<16); // hack to remember complemented attribute
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Truth table computation.]
@@ -136,15 +160,7 @@ int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_
 #endif
     if ( p->vTtIsops[pCut->nLeaves] && PrevSize != Vec_MemEntryNum(p->vTtMem[pCut->nLeaves]) )
     {
-        Vec_Int_t * vLevel = Vec_WecPushLevel( p->vTtIsops[pCut->nLeaves] );
-        fCompl = Kit_TruthIsop( (unsigned *)pTruth, pCut->nLeaves, p->vCover, 1 );
-        if ( fCompl >= 0 )
-        {
-            Vec_IntGrow( vLevel, Vec_IntSize(p->vCover) );
-            Vec_IntAppend( vLevel, p->vCover );
-            if ( fCompl )
-                vLevel->nCap ^= (1<<16); // hack to remember complemented attribute
-        }
+        If_CutTruthIsopAdd( p->vTtIsops[pCut->nLeaves], pTruth, pCut->nLeaves, p->vCover );
         assert( Vec_WecSize(p->vTtIsops[pCut->nLeaves]) == Vec_MemEntryNum(p->vTtMem[pCut->nLeaves]) );
     }
     return RetValue;
@@ -404,6 +420,80 @@ int If_CutCheckTruth6( If_Man_t * p, If_Cut_t * pCut )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Truth tables kept across mapping runs.]
+
+  Description [The mapper hash-conses the truth tables of the cut functions
+  and refers to them by their IDs. When the store is given to the mapper
+  (pPars->pTtStore), the tables (and their ISOPs) are not released when
+  the mapping is over, so the next run on the same or a similar AIG finds
+  most of the cut functions already there. The tables with fewer than six
+  variables are kept in the store of six-variable functions, as in the
+  manager. The first two entries are always constant 0 and the first
+  variable, which is what Vec_MemAllocForTT() creates.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_TtStore_t * If_TtStoreAlloc()
+{
+    return ABC_CALLOC( If_TtStore_t, 1 );
+}
+void If_TtStoreFree( If_TtStore_t * p )
+{
+    int v;
+    for ( v = 6; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+    {
+        Vec_MemHashFree( p->vTtMem[v] );
+        Vec_MemFreeP( &p->vTtMem[v] );
+        Vec_WecFreeP( &p->vTtIsops[v] );
+    }
+    ABC_FREE( p );
+}
+Vec_Mem_t * If_TtStoreMem( If_TtStore_t * p, int nVars )
+{
+    nVars = Abc_MaxInt( nVars, 6 );
+    assert( nVars <= IF_MAX_FUNC_LUTSIZE );
+    if ( p->vTtMem[nVars] == NULL )
+        p->vTtMem[nVars] = Vec_MemAllocForTT( nVars, 0 );
+    return p->vTtMem[nVars];
+}
+Vec_Wec_t * If_TtStoreIsops( If_TtStore_t * p, int nVars )
+{
+    Vec_Mem_t * vTtMem = If_TtStoreMem( p, nVars );
+    Vec_Int_t * vCover;
+    nVars = Abc_MaxInt( nVars, 6 );
+    if ( p->vTtIsops[nVars] == NULL )
+    {
+        p->vTtIsops[nVars] = Vec_WecAlloc( 1000 );
+        Vec_WecInit( p->vTtIsops[nVars], 2 );
+    }
+    if ( Vec_WecSize(p->vTtIsops[nVars]) == Vec_MemEntryNum(vTtMem) )
+        return p->vTtIsops[nVars];
+    // add the ISOPs of the tables derived by the runs that did not need them
+    vCover = Vec_IntAlloc( 1000 );
+    while ( Vec_WecSize(p->vTtIsops[nVars]) < Vec_MemEntryNum(vTtMem) )
+        If_CutTruthIsopAdd( p->vTtIsops[nVars], Vec_MemReadEntry(vTtMem, Vec_WecSize(p->vTtIsops[nVars])), nVars, vCover );
+    Vec_IntFree( vCover );
+    return p->vTtIsops[nVars];
+}
+double If_TtStoreMemory( If_TtStore_t * p )
+{
+    double Memory = sizeof(If_TtStore_t);
+    int v;
+    for ( v = 6; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+    {
+        if ( p->vTtMem[v] )
+            Memory += Vec_MemMemory( p->vTtMem[v] );
+        if ( p->vTtIsops[v] )
+            Memory += Vec_WecMemory( p->vTtIsops[v] );
+    }
+    return Memory;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -92,6 +92,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads for full timing update
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -174,6 +175,8 @@ struct SC_Timing_
     SC_Surface     pFallTrans;
     SC_Surface     pRisePower;     // -- Used to compute internal power
     SC_Surface     pFallPower;
+    int            fSameRise;      // -- pCellRise and pRiseTrans have the same indexes
+    int            fSameFall;      // -- pCellFall and pFallTrans have the same indexes
 };
 
 struct SC_Timings_ 
@@ -586,21 +589,74 @@ static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
 
     return p0 + sfrac * (p1 - p0);      // <<== multiply result with K factor here 
 }
+static inline float Scl_LibLookupPoint( SC_Surface * p, int s, int l, float sfrac, float lfrac )
+{
+    float * pDataS, * pDataS1, p0, p1;
+    if ( Vec_FltSize((Vec_Flt_t *)Vec_PtrEntry(&p->vData, s)) <= l+1 ||
+         Vec_FltSize((Vec_Flt_t *)Vec_PtrEntry(&p->vData, s+1)) <= l+1 )
+        return 0;
+    pDataS  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s) );
+    pDataS1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s+1) );
+    p0 = pDataS [l] + lfrac * (pDataS [l+1] - pDataS [l]);
+    p1 = pDataS1[l] + lfrac * (pDataS1[l+1] - pDataS1[l]);
+    return p0 + sfrac * (p1 - p0);
+}
+// looks up two tables at the same point; the sample points are found once if the tables have the same indexes
+static inline void Scl_LibLookup2( SC_Surface * p, SC_Surface * q, int fSame, float slew, float load, float * pRes, float * qRes )
+{
+    float * pIndex0, * pIndex1, sfrac, lfrac;
+    int s, l;
+    if ( !fSame || Vec_FltSize(&p->vIndex0) < 2 || Vec_FltSize(&p->vIndex1) < 2 ||
+         Vec_PtrSize(&p->vData) != Vec_FltSize(&p->vIndex0) || Vec_PtrSize(&q->vData) != Vec_FltSize(&q->vIndex0) )
+    {
+        *pRes = Scl_LibLookup( p, slew, load );
+        *qRes = Scl_LibLookup( q, slew, load );
+        return;
+    }
+    pIndex0 = Vec_FltArray(&p->vIndex0);
+    for ( s = 1; s < Vec_FltSize(&p->vIndex0)-1; s++ )
+        if ( pIndex0[s] > slew )
+            break;
+    s--;
+    pIndex1 = Vec_FltArray(&p->vIndex1);
+    for ( l = 1; l < Vec_FltSize(&p->vIndex1)-1; l++ )
+        if ( pIndex1[l] > load )
+            break;
+    l--;
+    if ( pIndex0[s+1] == pIndex0[s] || pIndex1[l+1] == pIndex1[l] )
+    {
+        *pRes = *qRes = 0;
+        return;
+    }
+    sfrac = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+    lfrac = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+    *pRes = Scl_LibLookupPoint( p, s, l, sfrac, lfrac );
+    *qRes = Scl_LibLookupPoint( q, s, l, sfrac, lfrac );
+}
+static inline int Scl_LibSameIndexes( SC_Surface * p, SC_Surface * q )
+{
+    return Vec_FltEqual( &p->vIndex0, &q->vIndex0 ) && Vec_FltEqual( &p->vIndex1, &q->vIndex1 );
+}
 static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
+    float DelayRise, DelayFall, SlewRise, SlewFall;
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
-        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
-        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + Scl_LibLookup(&pTime->pCellFall,  pSlewIn->fall, pLoad->fall) );
-        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Scl_LibLookup(&pTime->pRiseTrans, pSlewIn->rise, pLoad->rise) );
-        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Scl_LibLookup(&pTime->pFallTrans, pSlewIn->fall, pLoad->fall) );
+        Scl_LibLookup2( &pTime->pCellRise, &pTime->pRiseTrans, pTime->fSameRise, pSlewIn->rise, pLoad->rise, &DelayRise, &SlewRise );
+        Scl_LibLookup2( &pTime->pCellFall, &pTime->pFallTrans, pTime->fSameFall, pSlewIn->fall, pLoad->fall, &DelayFall, &SlewFall );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + DelayRise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + DelayFall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                SlewRise );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                SlewFall );
     }
     if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
     {
-        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->fall, pLoad->rise) );
-        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + Scl_LibLookup(&pTime->pCellFall,  pSlewIn->rise, pLoad->fall) );
-        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Scl_LibLookup(&pTime->pRiseTrans, pSlewIn->fall, pLoad->rise) );
-        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Scl_LibLookup(&pTime->pFallTrans, pSlewIn->rise, pLoad->fall) );
+        Scl_LibLookup2( &pTime->pCellRise, &pTime->pRiseTrans, pTime->fSameRise, pSlewIn->fall, pLoad->rise, &DelayRise, &SlewRise );
+        Scl_LibLookup2( &pTime->pCellFall, &pTime->pFallTrans, pTime->fSameFall, pSlewIn->rise, pLoad->fall, &DelayFall, &SlewFall );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + DelayRise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + DelayFall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                SlewRise );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                SlewFall );
     }
 }
 static inline void Scl_LibPinDeparture( SC_Timing * pTime, SC_Pair * pDepIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pDepOut )
@@ -827,6 +883,7 @@ extern int           Abc_SclClassCellNum( SC_Cell * pClass );
 extern void          Abc_SclShortNames( SC_Lib * p );
 extern int           Abc_SclLibClassNum( SC_Lib * pLib );
 extern void          Abc_SclLinkCells( SC_Lib * p );
+extern void          Abc_SclMarkSameIndexes( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
@@ -316,6 +316,36 @@ void Abc_SclLinkCells( SC_Lib * p )
         Vec_PtrWriteEntry( &p->vCellClasses, k, pRepr );
     }
     Vec_PtrFree( vList );
+    Abc_SclMarkSameIndexes( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks timing arcs whose delay and slew tables share indexes.]
+
+  Description [For these arcs, the delay and the output slew are looked up
+  together by finding the sample points once.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclMarkSameIndexes( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pRTime;
+    SC_Timing * pTime;
+    int i, k, n, t;
+    SC_LibForEachCell( p, pCell, i )
+        SC_CellForEachPinOut( pCell, pPin, k )
+            SC_PinForEachRTiming( pPin, pRTime, n )
+                Vec_PtrForEachEntry( SC_Timing *, &pRTime->vTimings, pTime, t )
+                {
+                    pTime->fSameRise = Scl_LibSameIndexes( &pTime->pCellRise, &pTime->pRiseTrans );
+                    pTime->fSameFall = Scl_LibSameIndexes( &pTime->pCellFall, &pTime->pFallTrans );
+                }
 }
 
 /**Function*************************************************************
@@ -457,6 +457,123 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
         printf( "after (%6.1f ps  %6.1f ps)\n", Abc_SclObjTimeOne(p, pObj, 1), Abc_SclObjTimeOne(p, pObj, 0) );
     }
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrival times of the internal nodes level by level.]
+
+  Description [The nodes of one level depend only on the nodes of the lower
+  levels, so they are split into chunks processed by the tasks of the shared
+  pool. Returns 0 if the nodes cannot be processed this way: load estimation
+  and fanin callbacks update the shared data, and the node order should be
+  topological.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Abc_SclTimeChunk_t_
+{
+    SC_Man *       p;
+    int *          pBeg;
+    int *          pEnd;
+} Abc_SclTimeChunk_t;
+
+static int Abc_SclTimeChunkTask( void * pArg )
+{
+    Abc_SclTimeChunk_t * pChunk = (Abc_SclTimeChunk_t *)pArg;
+    int * pId;
+    for ( pId = pChunk->pBeg; pId < pChunk->pEnd; pId++ )
+        Abc_SclTimeNode( pChunk->p, Abc_NtkObj(pChunk->p->pNtk, *pId), 0 );
+    return 0;
+}
+int Abc_SclTimeNodesLevelized( SC_Man * p )
+{
+    int nChunkMin = 500;
+    Abc_SclTimeChunk_t * pChunks;
+    Util_Task_t ** pTasks;
+    Vec_Int_t * vLevel, * vStart, * vOrder;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level, LevelMax = 0;
+    if ( p->nProcs < 2 || p->EstLoadMax || p->pFuncFanin )
+        return 0;
+    // compute levels in the node order
+    vLevel = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            if ( Abc_ObjId(pFanin) > Abc_ObjId(pObj) )
+            {
+                Vec_IntFree( vLevel );
+                return 0;
+            }
+            if ( Abc_ObjIsNode(pFanin) )
+                Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Abc_ObjId(pFanin)) );
+        }
+        Vec_IntWriteEntry( vLevel, i, Level + 1 );
+        LevelMax = Abc_MaxInt( LevelMax, Level + 1 );
+    }
+    // sort the nodes by level
+    vStart = Vec_IntStart( LevelMax + 2 );
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+        Vec_IntAddToEntry( vStart, Vec_IntEntry(vLevel, i) + 1, 1 );
+    for ( i = 1; i <= LevelMax + 1; i++ )
+        Vec_IntAddToEntry( vStart, i, Vec_IntEntry(vStart, i-1) );
+    vOrder = Vec_IntStart( Vec_IntEntryLast(vStart) );
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        Level = Vec_IntEntry( vLevel, i );
+        Vec_IntWriteEntry( vOrder, Vec_IntEntry(vStart, Level), i );
+        Vec_IntAddToEntry( vStart, Level, 1 );
+    }
+    // now entry Level points to the end of level Level
+    Vec_IntFree( vLevel );
+    // process the levels
+    pChunks = ABC_ALLOC( Abc_SclTimeChunk_t, p->nProcs );
+    pTasks  = ABC_ALLOC( Util_Task_t *, p->nProcs );
+    Util_PoolReserve( p->nProcs - 1 );
+    for ( Level = 1; Level <= LevelMax; Level++ )
+    {
+        int * pBeg  = Vec_IntEntryP( vOrder, Vec_IntEntry(vStart, Level-1) );
+        int * pEnd  = Vec_IntEntryP( vOrder, 0 ) + Vec_IntEntry(vStart, Level);
+        int nNodes  = pEnd - pBeg;
+        int nChunks = Abc_MinInt( p->nProcs, Abc_MaxInt(1, nNodes / nChunkMin) );
+        for ( k = 0; k < nChunks; k++ )
+        {
+            pChunks[k].p    = p;
+            pChunks[k].pBeg = pBeg + (int)((iword)nNodes * k / nChunks);
+            pChunks[k].pEnd = pBeg + (int)((iword)nNodes * (k+1) / nChunks);
+        }
+        for ( k = 1; k < nChunks; k++ )
+            pTasks[k] = Util_TaskSubmit( Abc_SclTimeChunkTask, pChunks + k, 0 );
+        Abc_SclTimeChunkTask( pChunks );
+        for ( k = 1; k < nChunks; k++ )
+        {
+            Util_TaskWait( pTasks[k] );
+            Util_TaskFree( pTasks[k] );
+        }
+    }
+    ABC_FREE( pChunks );
+    ABC_FREE( pTasks );
+    Vec_IntFree( vStart );
+    Vec_IntFree( vOrder );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recomputes timing of the whole network.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
     Abc_Obj_t * pObj;
@@ -467,8 +584,11 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+    if ( !Abc_SclTimeNodesLevelized( p ) )
+    {
+        Abc_NtkForEachNode1( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+    }
     Abc_NtkForEachCo( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     D = Abc_SclReadMaxDelay( p );
@@ -83,6 +83,7 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    int            nProcs;        // the number of threads for full timing update
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -558,6 +558,23 @@ extern word     Abc_RandomW( int fReset );
 // pthreads
 extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
 
+// shared task pool
+typedef struct Util_Task_t_ Util_Task_t;
+extern int           Util_PoolReserve( int nThreads );
+extern int           Util_PoolThreadNum();
+extern Util_Task_t * Util_TaskSubmit( int (*pFunc)(void *), void * pArg, int nTimeOut );
+extern Util_Task_t * Util_TaskSpawn( int (*pFunc)(void *), void * pArg, int nTimeOut );
+extern int           Util_TaskWait( Util_Task_t * pTask );
+extern int           Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks );
+extern int           Util_TaskIsDone( Util_Task_t * pTask );
+extern void          Util_TaskCancel( Util_Task_t * pTask );
+extern void          Util_TaskFree( Util_Task_t * pTask );
+extern void          Util_TaskRelease( Util_Task_t * pTask );
+extern int           Util_TaskStop();
+extern void *        Util_TaskArg();
+extern Util_Task_t * Util_TaskToken( int nTimeOut );
+extern Util_Task_t * Util_TaskSetCurrent( Util_Task_t * pTask );
+
 ABC_NAMESPACE_HEADER_END
 
 #endif
@@ -23,22 +23,6 @@
 #include <stdlib.h>
 #include <assert.h>
 
-#if defined(_WIN32) && !defined(__MINGW32__)
-#include <windows.h>
-#include <time.h>
-// nanosleep implementation for Windows
-static inline int nanosleep(const struct timespec *req, struct timespec *rem) {
-    LARGE_INTEGER li;
-    li.QuadPart = -((LONGLONG)req->tv_sec * 10000000 + req->tv_nsec / 100);
-    HANDLE timer = CreateWaitableTimer(NULL, TRUE, NULL);
-    if (!timer) return -1;
-    SetWaitableTimer(timer, &li, 0, NULL, NULL, 0);
-    WaitForSingleObject(timer, INFINITE);
-    CloseHandle(timer);
-    return 0;
-}
-#endif
-
 #ifdef ABC_USE_PTHREADS
 
 #if defined(_WIN32) && !defined(__MINGW32__)
@@ -47,30 +31,6 @@ static inline int nanosleep(const struct timespec *req, struct timespec *rem) {
 #include <pthread.h>
 #endif
 
-#ifdef __cplusplus
-#include <atomic>
-using namespace std;
-#else
-#ifndef _WIN32
-#include <stdatomic.h>
-#else
-// MSVC doesn't have stdatomic.h, use Interlocked functions instead
-#define atomic_bool volatile LONG
-#define atomic_int volatile LONG
-#define atomic_store(obj, val) InterlockedExchange((LONG*)obj, val)
-#define atomic_load(obj) (*(volatile LONG*)obj)
-#define atomic_compare_exchange_strong(obj, expected, desired) \
-    (InterlockedCompareExchange((LONG*)obj, desired, *expected) == *expected ? \
-     (*expected = desired, 1) : (*expected = *(volatile LONG*)obj, 0))
-#define atomic_store_explicit(obj, val, order) InterlockedExchange((LONG*)obj, val)
-#define atomic_load_explicit(obj, order) (*(volatile LONG*)obj)
-#define memory_order_acquire 0
-#define memory_order_release 0
-#define memory_order_seq_cst 0
-#endif
-#include <stdbool.h>
-#endif
-
 #endif
 
 #include "misc/vec/vec.h"
@@ -87,18 +47,145 @@ ABC_NAMESPACE_IMPL_START
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Shared work-stealing task pool.]
+
+  Description [All engines submit their tasks to one pool, whose worker
+  threads are started on demand and persist until the end of the run.
+  Each worker owns a deque: tasks submitted from inside a task go to the
+  owner's deque and are taken from its tail (LIFO), while idle workers
+  steal from the head (FIFO) of other deques or take tasks submitted by
+  outside threads from the shared queue. A thread waiting for a task
+  helps by running queued tasks, so nested parallel calls do not block
+  workers and do not start additional threads.
+
+  Two kinds of tasks are supported. Short tasks (Util_TaskSubmit) are
+  run by the existing workers and by the waiting threads. Long tasks
+  (Util_TaskSpawn), such as the engines of a portfolio, are guaranteed
+  to start promptly: the pool adds a worker when no idle one is
+  available, and the waiting threads never pick them up.
+
+  Tasks are cancelled cooperatively. A task whose deadline has passed or
+  which is cancelled before it starts is skipped and returns -1. A running
+  task should poll Util_TaskStop(), which also reflects the cancellation
+  and the deadline of the task that submitted it.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
 
+#ifdef _MSC_VER
+#define UTIL_TLS __declspec(thread)
+#else
+#define UTIL_TLS __thread
+#endif
+
+struct Util_Task_t_
+{
+    int        (*pFunc)(void *); // user function (NULL for a token)
+    void *       pArg;       // user data
+    Util_Task_t * pParent;   // the task that submitted this one
+    abctime      Deadline;   // the time to stop (0 = no limit)
+    volatile int fCancel;    // cancellation request
+    volatile int fDone;      // completion flag
+    int          fLong;      // the task is run by a dedicated worker
+    int          fDetached;  // the pool frees the task when it is done
+    int          Result;     // the result of the task
+};
+
+static UTIL_TLS Util_Task_t * s_pTaskCur = NULL; // the task run by this thread
+
+static int Util_TaskStopInt( Util_Task_t * pTask )
+{
+    for ( ; pTask; pTask = pTask->pParent )
+        if ( pTask->fCancel || (pTask->Deadline && Abc_Clock() > pTask->Deadline) )
+            return 1;
+    return 0;
+}
+static void Util_TaskInit( Util_Task_t * pTask, int (*pFunc)(void *), void * pArg, int nTimeOut )
+{
+    pTask->pFunc    = pFunc;
+    pTask->pArg     = pArg;
+    pTask->pParent  = s_pTaskCur;
+    pTask->Deadline = nTimeOut > 0 ? Abc_Clock() + (abctime)nTimeOut * CLOCKS_PER_SEC : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cancellation tokens.]
+
+  Description [A token is a task without a function. It carries a
+  cancellation flag and a deadline (in seconds, 0 = no deadline) and is
+  linked to the current task of the calling thread, so it is stopped
+  together with that task. After Util_TaskSetCurrent(), the engines run
+  by the calling thread observe the token in Util_TaskStop() and the
+  tasks submitted by this thread inherit it. Util_TaskSetCurrent()
+  returns the previous current task, to be restored when done. The
+  token is freed by Util_TaskFree() after the tasks linked to it are
+  finished.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Task_t * Util_TaskToken( int nTimeOut )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    Util_TaskInit( pTask, NULL, NULL, nTimeOut );
+    pTask->fDone = 1;
+    return pTask;
+}
+Util_Task_t * Util_TaskSetCurrent( Util_Task_t * pTask )
+{
+    Util_Task_t * pTaskPrev = s_pTaskCur;
+    s_pTaskCur = pTask;
+    return pTaskPrev;
+}
+void Util_TaskCancel( Util_Task_t * pTask )
+{
+    pTask->fCancel = 1;
+}
+// returns 1 if the current task should stop (cheap when no task is current)
+int Util_TaskStop()
+{
+    return s_pTaskCur && Util_TaskStopInt( s_pTaskCur );
+}
+// returns the user data of the current task (NULL for a token or no task)
+void * Util_TaskArg()
+{
+    return s_pTaskCur ? s_pTaskCur->pArg : NULL;
+}
+
 #ifndef ABC_USE_PTHREADS
 
+int           Util_PoolReserve( int nThreads )  { return 0; }
+int           Util_PoolThreadNum()              { return 0; }
+Util_Task_t * Util_TaskSubmit( int (*pFunc)(void *), void * pArg, int nTimeOut )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 ), * pTaskPrev;
+    Util_TaskInit( pTask, pFunc, pArg, nTimeOut );
+    pTaskPrev = Util_TaskSetCurrent( pTask );
+    pTask->Result = Util_TaskStopInt(pTask) ? -1 : pFunc( pArg );
+    Util_TaskSetCurrent( pTaskPrev );
+    pTask->fDone = 1;
+    return pTask;
+}
+Util_Task_t * Util_TaskSpawn( int (*pFunc)(void *), void * pArg, int nTimeOut ) { return Util_TaskSubmit( pFunc, pArg, nTimeOut ); }
+int           Util_TaskWait( Util_Task_t * pTask )                 { return pTask->Result; }
+int           Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks )
+{
+    int i;
+    for ( i = 0; i < nTasks; i++ )
+        if ( ppTasks[i] )
+            return i;
+    return -1;
+}
+int           Util_TaskIsDone( Util_Task_t * pTask )               { return 1; }
+void          Util_TaskFree( Util_Task_t * pTask )                 { ABC_FREE( pTask ); }
+void          Util_TaskRelease( Util_Task_t * pTask )              { ABC_FREE( pTask ); }
+
 void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
 {
     void * pData; int i;
@@ -108,108 +195,443 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
 
 #else // pthreads are used
 
-#define PAR_THR_MAX 100
-typedef struct Util_ThData_t_
-{
-    void *       pUserData;
-    int        (*pUserFunc)(void *);
-    int          iThread;
-    int          nTimeOut;
-    atomic_bool  fWorking;
-} Util_ThData_t;
+#define UTIL_POOL_MAX 256
 
-void * Util_Thread( void * pArg )
+typedef struct Util_Deque_t_
+{
+    pthread_mutex_t Mutex;
+    Util_Task_t **  pTasks;  // circular buffer
+    int             nCap;    // buffer capacity
+    int             iHead;   // the first task
+    int             nSize;   // the number of tasks
+} Util_Deque_t;
+
+typedef struct Util_Pool_t_
+{
+    pthread_mutex_t Mutex;     // protects the counters below
+    pthread_cond_t  CondWork;  // signaled when tasks are queued
+    pthread_cond_t  CondDone;  // signaled when tasks are done or queued
+    Util_Deque_t    Queue;     // short tasks submitted by outside threads
+    Util_Deque_t    QueueLong; // long tasks
+    Util_Deque_t    Deques[UTIL_POOL_MAX]; // short tasks submitted by the workers
+    pthread_t       Threads[UTIL_POOL_MAX];
+    int             nWorkers;  // the number of workers
+    int             nIdle;     // the number of sleeping workers
+    int             nQueued;   // the number of queued short tasks
+    int             nQueuedLong; // the number of queued long tasks
+    int             nWaiters;  // the number of threads waiting for tasks
+} Util_Pool_t;
+
+static Util_Pool_t *         s_pPool = NULL;
+static pthread_mutex_t       s_PoolMutex = PTHREAD_MUTEX_INITIALIZER;
+static UTIL_TLS int          s_iWorker = -1;   // the worker index of this thread
+
+static void Util_DequeStart( Util_Deque_t * q )
+{
+    int status = pthread_mutex_init( &q->Mutex, NULL );  assert( status == 0 );
+    q->nCap   = 64;
+    q->pTasks = ABC_ALLOC( Util_Task_t *, q->nCap );
+    q->iHead  = q->nSize = 0;
+}
+static void Util_DequePush( Util_Deque_t * q, Util_Task_t * pTask )
+{
+    pthread_mutex_lock( &q->Mutex );
+    if ( q->nSize == q->nCap )
+    {
+        Util_Task_t ** pTasks = ABC_ALLOC( Util_Task_t *, 2 * q->nCap );
+        int i;
+        for ( i = 0; i < q->nSize; i++ )
+            pTasks[i] = q->pTasks[(q->iHead + i) % q->nCap];
+        ABC_FREE( q->pTasks );
+        q->pTasks = pTasks;
+        q->iHead  = 0;
+        q->nCap  *= 2;
+    }
+    q->pTasks[(q->iHead + q->nSize++) % q->nCap] = pTask;
+    pthread_mutex_unlock( &q->Mutex );
+}
+static Util_Task_t * Util_DequePop( Util_Deque_t * q, int fTail )
 {
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+    Util_Task_t * pTask = NULL;
+    if ( q->nSize == 0 ) // unsynchronized peek to skip empty deques
+        return NULL;
+    pthread_mutex_lock( &q->Mutex );
+    if ( q->nSize > 0 )
+    {
+        if ( fTail )
+            pTask = q->pTasks[(q->iHead + --q->nSize) % q->nCap];
+        else
+        {
+            pTask = q->pTasks[q->iHead];
+            q->iHead = (q->iHead + 1) % q->nCap;
+            q->nSize--;
+        }
+    }
+    pthread_mutex_unlock( &q->Mutex );
+    return pTask;
+}
 
-    Util_ThData_t * pThData = (Util_ThData_t *)pArg;
+static void Util_PoolRun( Util_Pool_t * p, Util_Task_t * pTask )
+{
+    Util_Task_t * pTaskPrev = s_pTaskCur;
+    int fDetached;
+    s_pTaskCur = pTask;
+    pTask->Result = Util_TaskStopInt(pTask) ? -1 : pTask->pFunc( pTask->pArg );
+    s_pTaskCur = pTaskPrev;
+    pthread_mutex_lock( &p->Mutex );
+    pTask->fDone = 1;
+    fDetached = pTask->fDetached;
+    if ( p->nWaiters )
+        pthread_cond_broadcast( &p->CondDone );
+    pthread_mutex_unlock( &p->Mutex );
+    if ( fDetached )
+        ABC_FREE( pTask );
+}
+// takes a short task from the own deque, the shared queue, or another deque;
+// the tasks are pushed and popped under the pool mutex, so that the counters
+// always equal the number of queued tasks
+static Util_Task_t * Util_PoolTake( Util_Pool_t * p, int iWorker )
+{
+    Util_Task_t * pTask = NULL;
+    int i, nWorkers;
+    if ( p->nQueued == 0 ) // unsynchronized peek, rechecked before sleeping
+        return NULL;
+    pthread_mutex_lock( &p->Mutex );
+    nWorkers = p->nWorkers;
+    if ( iWorker >= 0 )
+        pTask = Util_DequePop( p->Deques + iWorker, 1 );
+    if ( pTask == NULL )
+        pTask = Util_DequePop( &p->Queue, 0 );
+    for ( i = 1; pTask == NULL && i <= nWorkers; i++ )
+        pTask = Util_DequePop( p->Deques + (Abc_MaxInt(iWorker, 0) + i) % nWorkers, 0 );
+    if ( pTask )
+        p->nQueued--;
+    pthread_mutex_unlock( &p->Mutex );
+    return pTask;
+}
+static Util_Task_t * Util_PoolTakeLong( Util_Pool_t * p )
+{
+    Util_Task_t * pTask;
+    if ( p->nQueuedLong == 0 ) // unsynchronized peek, rechecked before sleeping
+        return NULL;
+    pthread_mutex_lock( &p->Mutex );
+    pTask = Util_DequePop( &p->QueueLong, 0 );
+    if ( pTask )
+        p->nQueuedLong--;
+    pthread_mutex_unlock( &p->Mutex );
+    return pTask;
+}
+static void * Util_PoolWorker( void * pArg )
+{
+    Util_Pool_t * p = s_pPool;
+    Util_Task_t * pTask;
+    s_iWorker = (int)(ABC_PTRINT_T)pArg;
     while ( 1 )
     {
-        while ( !atomic_load_explicit((atomic_bool *)&pThData->fWorking, memory_order_acquire) )
-            nanosleep(&pause_duration, NULL);
-        if ( pThData->pUserData == NULL )
+        if ( (pTask = Util_PoolTakeLong(p)) || (pTask = Util_PoolTake(p, s_iWorker)) )
         {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            Util_PoolRun( p, pTask );
+            continue;
         }
-        pThData->pUserFunc( pThData->pUserData );
-        atomic_store_explicit(&pThData->fWorking, false, memory_order_release);
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nQueued == 0 && p->nQueuedLong == 0 )
+        {
+            p->nIdle++;
+            pthread_cond_wait( &p->CondWork, &p->Mutex );
+            p->nIdle--;
+        }
+        pthread_mutex_unlock( &p->Mutex );
     }
-    assert( 0 );
     return NULL;
 }
+// assumes that the pool mutex is locked
+static int Util_PoolAddWorker( Util_Pool_t * p )
+{
+    int status;
+    if ( p->nWorkers == UTIL_POOL_MAX )
+        return 0;
+    Util_DequeStart( p->Deques + p->nWorkers );
+    status = pthread_create( p->Threads + p->nWorkers, NULL, Util_PoolWorker, (void *)(ABC_PTRINT_T)p->nWorkers );  assert( status == 0 );
+    p->nWorkers++;
+    return 1;
+}
+static Util_Pool_t * Util_PoolGet()
+{
+    if ( s_pPool )
+        return s_pPool;
+    pthread_mutex_lock( &s_PoolMutex );
+    if ( s_pPool == NULL )
+    {
+        Util_Pool_t * p = ABC_CALLOC( Util_Pool_t, 1 );
+        int status;
+        status = pthread_mutex_init( &p->Mutex, NULL );     assert( status == 0 );
+        status = pthread_cond_init( &p->CondWork, NULL );   assert( status == 0 );
+        status = pthread_cond_init( &p->CondDone, NULL );   assert( status == 0 );
+        Util_DequeStart( &p->Queue );
+        Util_DequeStart( &p->QueueLong );
+        s_pPool = p;
+    }
+    pthread_mutex_unlock( &s_PoolMutex );
+    return s_pPool;
+}
 
-void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+/**Function*************************************************************
+
+  Synopsis    [Makes sure the pool has at least the given number of workers.]
+
+  Description [Returns the number of workers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolReserve( int nThreads )
 {
-    //abctime clkStart = Abc_Clock();
-    Util_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack = NULL;
-    int i, status;
-    fflush( stdout );
-    if ( nProcs <= 2 ) {
-        void * pData; int i;
-        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
-            pUserFunc( pData );
-        return;
+    Util_Pool_t * p = Util_PoolGet();
+    pthread_mutex_lock( &p->Mutex );
+    while ( p->nWorkers < nThreads && Util_PoolAddWorker(p) );
+    nThreads = p->nWorkers;
+    pthread_mutex_unlock( &p->Mutex );
+    return nThreads;
+}
+int Util_PoolThreadNum()
+{
+    return s_pPool ? s_pPool->nWorkers : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Submits a task.]
+
+  Description [The timeout is in seconds (0 = inherit the deadline of
+  the current task). The new task is linked to the current task or
+  token of the calling thread and should be waited for before that
+  task returns or the token is freed. A detached task should be spawned
+  with no current task.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Util_Task_t * Util_TaskStart( int (*pFunc)(void *), void * pArg, int nTimeOut, int fLong )
+{
+    Util_Pool_t * p = Util_PoolGet();
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    Util_TaskInit( pTask, pFunc, pArg, nTimeOut );
+    pTask->fLong    = fLong;
+    pthread_mutex_lock( &p->Mutex );
+    if ( fLong )
+        Util_DequePush( &p->QueueLong, pTask );
+    else if ( s_iWorker >= 0 )
+        Util_DequePush( p->Deques + s_iWorker, pTask );
+    else
+        Util_DequePush( &p->Queue, pTask );
+    if ( fLong )
+    {
+        // make sure a worker is available for each long task
+        if ( p->nIdle <= p->nQueued + p->nQueuedLong )
+            Util_PoolAddWorker( p );
+        p->nQueuedLong++;
     }
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
+    else
+        p->nQueued++;
+    pthread_cond_signal( &p->CondWork );
+    if ( p->nWaiters )
+        pthread_cond_broadcast( &p->CondDone );
+    pthread_mutex_unlock( &p->Mutex );
+    return pTask;
+}
+Util_Task_t * Util_TaskSubmit( int (*pFunc)(void *), void * pArg, int nTimeOut )
+{
+    return Util_TaskStart( pFunc, pArg, nTimeOut, 0 );
+}
+Util_Task_t * Util_TaskSpawn( int (*pFunc)(void *), void * pArg, int nTimeOut )
+{
+    return Util_TaskStart( pFunc, pArg, nTimeOut, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the task and returns its result.]
+
+  Description [While waiting, runs other short tasks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_TaskWait( Util_Task_t * pTask )
+{
+    Util_Pool_t * p = s_pPool;
+    Util_Task_t * pOther;
+    while ( !pTask->fDone )
     {
-        ThData[i].pUserData = NULL;
-        ThData[i].pUserFunc = pUserFunc;
-        ThData[i].iThread   = i;
-        ThData[i].nTimeOut  = TimeOut;
-        atomic_store_explicit(&ThData[i].fWorking, false, memory_order_release);
-        status = pthread_create( WorkerThread + i, NULL, Util_Thread, (void *)(ThData + i) );  assert( status == 0 );
+        if ( (pOther = Util_PoolTake(p, s_iWorker)) )
+        {
+            Util_PoolRun( p, pOther );
+            continue;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        p->nWaiters++;
+        while ( !pTask->fDone && p->nQueued == 0 )
+            pthread_cond_wait( &p->CondDone, &p->Mutex );
+        p->nWaiters--;
+        pthread_mutex_unlock( &p->Mutex );
     }
+    return pTask->Result;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits until one of the tasks is done.]
 
-    struct timespec pause_duration;
-    pause_duration.tv_sec = 0;
-    pause_duration.tv_nsec = 10000000L; // 10 milliseconds
+  Description [Returns the index of the finished task or -1 if all
+  entries are NULL. Does not run other tasks while waiting.]
 
-    // look at the threads
-    vStack = Vec_PtrDup( (Vec_Ptr_t *)vData );
-    while ( Vec_PtrSize(vStack) > 0 )
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks )
+{
+    Util_Pool_t * p = s_pPool;
+    int i, iDone = -1, fAny = 0;
+    for ( i = 0; i < nTasks; i++ )
+        fAny |= (ppTasks[i] != NULL);
+    if ( !fAny )
+        return -1;
+    pthread_mutex_lock( &p->Mutex );
+    p->nWaiters++;
+    while ( 1 )
     {
-        for ( i = 0; i < nProcs; i++ )
+        for ( i = 0; i < nTasks; i++ )
+            if ( ppTasks[i] && ppTasks[i]->fDone )
+                break;
+        if ( i < nTasks )
         {
-            if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-                continue;
-            ThData[i].pUserData = Vec_PtrPop( vStack );
-            atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
+            iDone = i;
             break;
         }
+        pthread_cond_wait( &p->CondDone, &p->Mutex );
+    }
+    p->nWaiters--;
+    pthread_mutex_unlock( &p->Mutex );
+    return iDone;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Task utilities.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_TaskIsDone( Util_Task_t * pTask )
+{
+    return pTask->fDone;
+}
+void Util_TaskFree( Util_Task_t * pTask )
+{
+    assert( pTask->fDone );
+    ABC_FREE( pTask );
+}
+// the pool frees the task when it is done
+void Util_TaskRelease( Util_Task_t * pTask )
+{
+    Util_Pool_t * p = s_pPool;
+    int fDone;
+    pthread_mutex_lock( &p->Mutex );
+    fDone = pTask->fDone;
+    pTask->fDetached = 1;
+    pthread_mutex_unlock( &p->Mutex );
+    if ( fDone )
+        ABC_FREE( pTask );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies the function to each entry using nProcs threads.]
+
+  Description [As before the pool was introduced, nProcs - 1 entries are
+  processed at the same time, while the calling thread dispatches them.
+  The next entry is submitted only after one of the running ones is done,
+  so the limit holds even if the pool has more workers. The timeout is
+  not used as the deadline of the tasks (the entries are never skipped);
+  the user function is expected to take it from its own data. While
+  waiting, the calling thread runs queued short tasks, so that nested
+  calls from inside tasks cannot block the workers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Util_ProcessThreadsWaitAny( Util_Task_t ** ppTasks, int nTasks )
+{
+    Util_Pool_t * p = s_pPool;
+    Util_Task_t * pOther;
+    int i;
+    while ( 1 )
+    {
+        for ( i = 0; i < nTasks; i++ )
+            if ( ppTasks[i]->fDone )
+                return i;
+        if ( (pOther = Util_PoolTake(p, s_iWorker)) )
+        {
+            Util_PoolRun( p, pOther );
+            continue;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        p->nWaiters++;
+        while ( p->nQueued == 0 )
+        {
+            for ( i = 0; i < nTasks; i++ )
+                if ( ppTasks[i]->fDone )
+                    break;
+            if ( i < nTasks )
+                break;
+            pthread_cond_wait( &p->CondDone, &p->Mutex );
+        }
+        p->nWaiters--;
+        pthread_mutex_unlock( &p->Mutex );
     }
-    Vec_PtrFree( vStack );    
-    
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
+    return -1;
+}
+void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose )
+{
+    Util_Task_t * pTasks[UTIL_POOL_MAX];
+    void * pData; int i, k, nTasks = 0;
+    fflush( stdout );
+    if ( nProcs <= 2 ) {
+        Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
+            pUserFunc( pData );
+        return;
+    }
+    nProcs = Abc_MinInt( nProcs - 1, UTIL_POOL_MAX );
+    Util_PoolReserve( nProcs );
+    Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
     {
-        if ( atomic_load_explicit(&ThData[i].fWorking, memory_order_acquire) )
-            i = -1; // Start from the beginning again
-        nanosleep(&pause_duration, NULL);
+        if ( nTasks == nProcs )
+        {
+            k = Util_ProcessThreadsWaitAny( pTasks, nTasks );
+            Util_TaskFree( pTasks[k] );
+            pTasks[k] = pTasks[--nTasks];
+        }
+        pTasks[nTasks++] = Util_TaskSubmit( pUserFunc, pData, 0 );
     }
-
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
+    for ( k = 0; k < nTasks; k++ )
     {
-        ThData[i].pUserData = NULL;
-        atomic_store_explicit(&ThData[i].fWorking, true, memory_order_release);
+        Util_TaskWait( pTasks[k] );
+        Util_TaskFree( pTasks[k] );
     }
-
-    // Join threads
-    for ( i = 0; i < nProcs; i++ )
-        pthread_join( WorkerThread[i], NULL );
-
-    //if ( fVerbose )
-    //    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );    
 }
 
 #endif // pthreads are used
@@ -50,6 +50,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Dar_Man_t_            Dar_Man_t;
 typedef struct Dar_Cut_t_            Dar_Cut_t;
+typedef struct Dar_LibDat_t_         Dar_LibDat_t;
 
 // the AIG 4-cut
 struct Dar_Cut_t_  // 6 words
@@ -80,6 +81,9 @@ struct Dar_Man_t_
     int              GainBest;       // the best gain
     int              LevelBest;      // the level of node with the best gain
     int              ClassBest;      // the equivalence class of the best replacement
+    // library data for the current cut
+    Dar_LibDat_t *   pDatas;         // the data of the library objects
+    int *            pNums;          // the numbers of the library objects
     // function statistics
     int              nTotalSubgs;    // the total number of subgraphs tried
     int              ClassTimes[222];// the runtimes for each class
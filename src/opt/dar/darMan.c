@@ -76,6 +76,8 @@ void Dar_ManStop( Dar_Man_t * p )
         Aig_MmFixedStop( p->pMemCuts, 0 );
     if ( p->vLeavesBest ) 
         Vec_PtrFree( p->vLeavesBest );
+    ABC_FREE( p->pDatas );
+    ABC_FREE( p->pNums );
     ABC_FREE( p );
 }
 
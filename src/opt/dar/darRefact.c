@@ -528,6 +528,8 @@ int Dar_ManRefactor( Aig_Man_t * pAig, Dar_RefPar_t * pPars )
             break;
         if ( pAig->Time2Quit && !(i & 256) && Abc_Clock() > pAig->Time2Quit )
             break;
+        if ( (i & 0xFF) == 0 && Util_TaskStop() )
+            break;
         Vec_VecClear( p->vCuts );
 
 //printf( "\nConsidering node %d.\n", pObj->Id );
@@ -52,6 +52,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nProcs       =    1;  // the number of threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -214,6 +215,15 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the update to be performed later
+    if ( p->fDeferUpdate )
+    {
+        p->iUpdFanin    = f;
+        p->iUpdFaninNew = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->uUpdTruth    = uTruth;
+        memcpy( p->pUpdTruth, p->pTruth, sizeof(word) * SFM_WORDS_MAX );
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth, p->pTruth );
     // the number of fanins cannot increase
@@ -280,6 +290,14 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // record the update to be performed later
+    if ( p->fDeferUpdate )
+    {
+        p->iUpdFanin    = -1;
+        p->iUpdFaninNew = -1;
+        p->uUpdTruth    = uTruth;
+        return 1;
+    }
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
@@ -353,6 +371,255 @@ void Sfm_NtkPrint( Sfm_Ntk_t * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution for the nodes in parallel.]
+
+  Description [In each round, the nodes are taken from several segments of
+  the node list and the nodes whose windows do not conflict with the windows
+  already selected are collected. The windows conflict when one of them
+  changes the nodes used by the other. The selected nodes are processed
+  concurrently on the worker copies of the network, each of which has its
+  own window and SAT solver, and the updates are performed in the order
+  of the nodes. The remaining nodes and the updated nodes are tried again
+  in the next round. The result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Sfm_Cand_t_ Sfm_Cand_t;
+struct Sfm_Cand_t_
+{
+    int               iNode;       // the node
+    int               fUpdate;     // the node can be updated
+    int               iFanin;      // the fanin to replace (-1 if only the function changes)
+    int               iFaninNew;   // the new fanin (-1 if the fanin is removed)
+    word              uTruth;      // the new function
+    word              pTruth[SFM_WORDS_MAX];
+};
+typedef struct Sfm_Job_t_ Sfm_Job_t;
+struct Sfm_Job_t_
+{
+    Sfm_Ntk_t *       p;           // the worker copy of the network
+    Sfm_Cand_t *      pCands;      // the selected nodes
+    int               nCands;      // the number of selected nodes
+    int               iStart;      // the first node of this job
+    int               nStep;       // the distance between the nodes of this job
+};
+static int Sfm_NtkPerformJob( void * pArg )
+{
+    Sfm_Job_t * pJob = (Sfm_Job_t *)pArg;
+    Sfm_Ntk_t * p = pJob->p;
+    int i;
+    for ( i = pJob->iStart; i < pJob->nCands; i += pJob->nStep )
+    {
+        Sfm_Cand_t * pCand = pJob->pCands + i;
+        pCand->fUpdate = Sfm_NodeResub( p, pCand->iNode );
+        if ( !pCand->fUpdate )
+            continue;
+        pCand->iFanin    = p->iUpdFanin;
+        pCand->iFaninNew = p->iUpdFaninNew;
+        pCand->uTruth    = p->uUpdTruth;
+        memcpy( pCand->pTruth, p->pUpdTruth, sizeof(word) * SFM_WORDS_MAX );
+    }
+    return 1;
+}
+typedef struct Sfm_Sel_t_ Sfm_Sel_t;
+struct Sfm_Sel_t_
+{
+    Sfm_Ntk_t *       p;           // the selector copy of the network
+    Vec_Int_t *       vStampsR;    // the nodes used by the selected windows
+    Vec_Int_t *       vStampsW;    // the nodes changed by the selected windows
+    int               Stamp;       // the current round
+};
+static int Sfm_NtkSelectCheckTfo_rec( Sfm_Sel_t * s, int iObj, int nLevelMax )
+{
+    int i, iFanout;
+    if ( Vec_IntEntry(s->vStampsR, iObj) == s->Stamp || Vec_IntEntry(s->vStampsW, iObj) == s->Stamp )
+        return 1;
+    if ( Sfm_ObjFanoutNum(s->p, iObj) > s->p->pPars->nFanoutMax )
+        return 0;
+    Sfm_ObjForEachFanout( s->p, iObj, iFanout, i )
+        if ( !Sfm_ObjIsPo(s->p, iFanout) && Sfm_ObjLevel(s->p, iFanout) <= nLevelMax && Sfm_NtkSelectCheckTfo_rec(s, iFanout, nLevelMax) )
+            return 1;
+    return 0;
+}
+static int Sfm_NtkSelectWindow( Sfm_Sel_t * s, int iNode )
+{
+    // the update of the node changes the functions of the node and its TFO in the window
+    // and preserves the functions of the roots (and hence of all other nodes), while the 
+    // proof uses only the objects of the window (p->vOrder contains the node, the divisors, 
+    // the roots, and their TFI bounded by the window size), so the windows are compatible 
+    // if neither of them changes the objects of the other one
+    Sfm_Ntk_t * p = s->p;
+    int i, iObj;
+    // quick check before computing the window: the window conflicts if its TFO contains 
+    // the objects used or changed by another window
+    if ( Sfm_NtkSelectCheckTfo_rec(s, iNode, Sfm_ObjLevel(p, iNode) + p->pPars->nTfoLevMax) )
+        return -1;
+    if ( !Sfm_NtkCreateWindow( p, iNode, 0 ) )
+        return 0;
+    Vec_IntForEachEntry( p->vOrder, iObj, i )
+        if ( Vec_IntEntry(s->vStampsW, iObj) == s->Stamp )
+            return -1;
+    Vec_IntForEachEntry( p->vTfo, iObj, i )
+        if ( Vec_IntEntry(s->vStampsR, iObj) == s->Stamp || Vec_IntEntry(s->vStampsW, iObj) == s->Stamp )
+            return -1;
+    // mark the objects used and changed by this window
+    Vec_IntForEachEntry( p->vOrder, iObj, i )
+        Vec_IntWriteEntry( s->vStampsR, iObj, s->Stamp );
+    Vec_IntForEachEntry( p->vTfo, iObj, i )
+        Vec_IntWriteEntry( s->vStampsW, iObj, s->Stamp );
+    Vec_IntWriteEntry( s->vStampsW, iNode, s->Stamp );
+    return 1;
+}
+static int Sfm_NtkPerformCommit( Sfm_Ntk_t * p, Sfm_Cand_t * pCand, Sfm_Sel_t * s )
+{
+    int nFanins = Sfm_ObjFaninNum(p, pCand->iNode);
+    // the new fanin may have been changed by another window or removed by an earlier update
+    if ( pCand->iFaninNew >= 0 && !Sfm_ObjIsPi(p, pCand->iFaninNew) && 
+        (Vec_IntEntry(s->vStampsW, pCand->iFaninNew) == s->Stamp || Sfm_ObjFanoutNum(p, pCand->iFaninNew) == 0) )
+        return 0;
+    if ( pCand->iFanin >= 0 )
+        Sfm_NtkUpdate( p, pCand->iNode, pCand->iFanin, pCand->iFaninNew, pCand->uTruth, pCand->pTruth );
+    else
+    {
+        Vec_WrdWriteEntry( p->vTruths, pCand->iNode, pCand->uTruth );
+        Sfm_TruthToCnf( pCand->uTruth, NULL, Sfm_ObjFaninNum(p, pCand->iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, pCand->iNode) );
+    }
+    assert( nFanins >= Sfm_ObjFaninNum(p, pCand->iNode) );
+    return 1;
+}
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p, Vec_Int_t * vCands )
+{
+    int nSelectMax = 64;  // the max number of windows in one round
+    int nRejectMax = 64;  // the max number of overlapping windows in one round
+    int nSegs = Abc_MinInt( nSelectMax, Vec_IntSize(vCands) ); // the number of segments of the candidate list
+    int nWorkers = p->pPars->nProcs;
+    Sfm_Ntk_t ** pWorkers = ABC_ALLOC( Sfm_Ntk_t *, nWorkers );
+    Sfm_Job_t * pJobs = ABC_ALLOC( Sfm_Job_t, nWorkers );
+    Util_Task_t ** pTasks = ABC_ALLOC( Util_Task_t *, nWorkers );
+    Sfm_Cand_t * pCands = ABC_CALLOC( Sfm_Cand_t, nSelectMax );
+    Vec_Int_t * vRetry = Vec_IntAlloc( 100 );
+    Vec_Int_t * vRetryNext = Vec_IntAlloc( 100 );
+    Vec_Int_t * vNext = Vec_IntAlloc( nSegs );
+    Vec_Str_t * vUpdated = Vec_StrStart( p->nObjs );
+    Sfm_Sel_t Sel, * s = &Sel;
+    int i, k, iNode, Status, nSelected, nRejected, nLeft = Vec_IntSize(vCands), nRounds = 0, Counter = 0, fStop = 0;
+    memset( s, 0, sizeof(Sfm_Sel_t) );
+    s->p        = Sfm_NtkDupWorker( p );
+    s->vStampsR = Vec_IntStartFull( p->nObjs );
+    s->vStampsW = Vec_IntStartFull( p->nObjs );
+    // the candidates are taken from several segments of the list to make the windows far apart
+    for ( k = 0; k < nSegs; k++ )
+        Vec_IntPush( vNext, k * Vec_IntSize(vCands) / nSegs );
+    for ( k = 0; k < nWorkers; k++ )
+        pWorkers[k] = Sfm_NtkDupWorker( p );
+    Util_PoolReserve( nWorkers - 1 );
+    while ( !fStop && (Vec_IntSize(vRetry) > 0 || nLeft > 0) )
+    {
+        // select the nodes with non-overlapping windows (the nodes to retry go first)
+        nSelected = nRejected = 0;
+        s->Stamp = ++nRounds;
+        Vec_IntClear( vRetryNext );
+        Vec_IntForEachEntry( vRetry, iNode, i )
+        {
+            Status = -1;
+            if ( nSelected < nSelectMax && nRejected < nRejectMax )
+                Status = Sfm_NtkSelectWindow( s, iNode );
+            if ( Status == 1 )
+                pCands[nSelected++].iNode = iNode;
+            else if ( Status == -1 )
+                Vec_IntPush( vRetryNext, iNode ), nRejected++;
+        }
+        while ( nSelected < nSelectMax && nRejected < nRejectMax && nLeft > 0 )
+            for ( k = 0; k < nSegs && nSelected < nSelectMax && nRejected < nRejectMax; k++ )
+            {
+                int iStop = (k + 1) * Vec_IntSize(vCands) / nSegs;
+                if ( Vec_IntEntry(vNext, k) == iStop )
+                    continue;
+                iNode  = Vec_IntEntry( vCands, Vec_IntAddToEntry(vNext, k, 1) - 1 );
+                Status = Sfm_NtkSelectWindow( s, iNode );
+                if ( Status == 1 )
+                    pCands[nSelected++].iNode = iNode;
+                else if ( Status == -1 )
+                    Vec_IntPush( vRetryNext, iNode ), nRejected++;
+                nLeft--;
+            }
+        // process the nodes
+        for ( k = 0; k < nWorkers; k++ )
+        {
+            pJobs[k].p      = pWorkers[k];
+            pJobs[k].pCands = pCands;
+            pJobs[k].nCands = nSelected;
+            pJobs[k].iStart = k;
+            pJobs[k].nStep  = nWorkers;
+        }
+        for ( k = 1; k < nWorkers; k++ )
+            pTasks[k] = Util_TaskSubmit( Sfm_NtkPerformJob, pJobs + k, 0 );
+        Sfm_NtkPerformJob( pJobs );
+        for ( k = 1; k < nWorkers; k++ )
+        {
+            Util_TaskWait( pTasks[k] );
+            Util_TaskFree( pTasks[k] );
+        }
+        // perform the updates in the order of the nodes
+        Vec_IntClear( vRetry );
+        for ( i = 0; i < nSelected; i++ )
+        {
+            if ( !pCands[i].fUpdate )
+                continue;
+            if ( !Sfm_NtkPerformCommit( p, pCands + i, s ) )
+            {
+                Vec_IntPush( vRetryNext, pCands[i].iNode );
+                continue;
+            }
+            // similar to the sequential flow, the node is tried again
+            Vec_IntPush( vRetry, pCands[i].iNode );
+            if ( Vec_StrEntry(vUpdated, pCands[i].iNode) )
+                continue;
+            Vec_StrWriteEntry( vUpdated, pCands[i].iNode, 1 );
+            if ( ++Counter == p->pPars->nNodesMax )
+            {
+                fStop = 1;
+                break;
+            }
+        }
+        Vec_IntAppend( vRetry, vRetryNext );
+    }
+    // collect statistics (runtime breakdown is not collected)
+    for ( k = 0; k < nWorkers; k++ )
+    {
+        Sfm_Ntk_t * pW = pWorkers[k];
+        p->nTryRemoves  += pW->nTryRemoves;
+        p->nTryImproves += pW->nTryImproves;
+        p->nTryResubs   += pW->nTryResubs;
+        p->nRemoves     += pW->nRemoves;
+        p->nImproves    += pW->nImproves;
+        p->nResubs      += pW->nResubs;
+        p->nNodesTried  += pW->nNodesTried;
+        p->nTotalDivs   += pW->nTotalDivs;
+        p->nSatCalls    += pW->nSatCalls;
+        p->nTimeOuts    += pW->nTimeOuts;
+        p->nMaxDivs     += pW->nMaxDivs;
+        Sfm_NtkFreeWorker( pW );
+    }
+    Sfm_NtkFreeWorker( s->p );
+    Vec_IntFree( s->vStampsR );
+    Vec_IntFree( s->vStampsW );
+    ABC_FREE( pWorkers );
+    ABC_FREE( pJobs );
+    ABC_FREE( pTasks );
+    ABC_FREE( pCands );
+    Vec_IntFree( vRetry );
+    Vec_IntFree( vRetryNext );
+    Vec_IntFree( vNext );
+    Vec_StrFree( vUpdated );
+    return Counter;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -366,6 +633,7 @@ void Sfm_NtkPrint( Sfm_Ntk_t * p )
 ***********************************************************************/
 int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 {
+    Vec_Int_t * vCands = NULL;
     int i, k, Counter = 0, CounterLarge = 0;
     //Sfm_NtkPrint( p );
     p->timeTotal = Abc_Clock();
@@ -382,6 +650,8 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nProcs > 1 && !pPars->fVeryVerbose )
+        vCands = Vec_IntAlloc( p->nNodes );
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
@@ -395,6 +665,11 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
             CounterLarge++;
             continue;
         }
+        if ( vCands )
+        {
+            Vec_IntPush( vCands, i );
+            continue;
+        }
         for ( k = 0; Sfm_NodeResub(p, i); k++ )
         {
 //            Counter++;
@@ -404,6 +679,11 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
         if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
             break;
     }
+    if ( vCands )
+    {
+        Counter = Sfm_NtkPerformPar( p, vCands );
+        Vec_IntFree( vCands );
+    }
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
     p->timeTotal = Abc_Clock() - p->timeTotal;
@@ -129,6 +129,12 @@ struct Sfm_Ntk_t_
     word *            pTtElems[SFM_FANIN_MAX];
     word              pTruth[SFM_WORDS_MAX];
     word              pCube[SFM_WORDS_MAX];
+    // deferred update
+    int               fDeferUpdate;// record the update instead of performing it
+    int               iUpdFanin;   // the fanin to replace (-1 if only the function changes)
+    int               iUpdFaninNew;// the new fanin (-1 if the fanin is removed)
+    word              uUpdTruth;   // the new function
+    word              pUpdTruth[SFM_WORDS_MAX];
     // nodes
     int               nTotalNodesBeg;
     int               nTotalEdgesBeg;
@@ -222,6 +228,8 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 /*=== sfmNtk.c ==========================================================*/
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
+extern Sfm_Ntk_t *  Sfm_NtkDupWorker( Sfm_Ntk_t * p );
+extern void         Sfm_NtkFreeWorker( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth, word * pTruth );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
@@ -253,6 +253,79 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     ABC_FREE( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Creates a worker copy of the network.]
+
+  Description [The copy shares the network structure with the original
+  and has its own traversal IDs, window, and SAT solver. It records
+  the updates instead of performing them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t * Sfm_NtkDupWorker( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pNew = ABC_ALLOC( Sfm_Ntk_t, 1 ); int i;
+    memcpy( pNew, p, sizeof(Sfm_Ntk_t) );
+    // parameters are changed while computing the window
+    pNew->pPars = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pNew->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    // attributes
+    memset( &pNew->vCounts,   0, sizeof(Vec_Int_t) );
+    memset( &pNew->vTravIds,  0, sizeof(Vec_Int_t) );
+    memset( &pNew->vTravIds2, 0, sizeof(Vec_Int_t) );
+    memset( &pNew->vId2Var,   0, sizeof(Vec_Int_t) );
+    memset( &pNew->vVar2Id,   0, sizeof(Vec_Int_t) );
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    pNew->nTravIds  = 0;
+    pNew->nTravIds2 = 0;
+    pNew->nSatVars  = 0;
+    pNew->vCover    = Vec_IntAlloc( 1 << 16 );
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pNew->pTtElems[i] = pNew->TtElems[i];
+    // window and SAT solver
+    Sfm_NtkPrepare( pNew );
+    pNew->fDeferUpdate = 1;
+    // statistics
+    pNew->nTryRemoves  = pNew->nTryImproves = pNew->nTryResubs = 0;
+    pNew->nRemoves     = pNew->nImproves    = pNew->nResubs    = 0;
+    pNew->nNodesTried  = pNew->nTotalDivs   = pNew->nSatCalls  = 0;
+    pNew->nTimeOuts    = pNew->nMaxDivs     = 0;
+    pNew->timeWin      = pNew->timeDiv      = pNew->timeCnf    = pNew->timeSat = 0;
+    return pNew;
+}
+void Sfm_NtkFreeWorker( Sfm_Ntk_t * p )
+{
+    ABC_FREE( p->pPars );
+    ABC_FREE( p->vCounts.pArray );
+    ABC_FREE( p->vTravIds.pArray );
+    ABC_FREE( p->vTravIds2.pArray );
+    ABC_FREE( p->vId2Var.pArray );
+    ABC_FREE( p->vVar2Id.pArray );
+    Vec_IntFree( p->vCover );
+    Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vDivs  );
+    Vec_IntFreeP( &p->vRoots );
+    Vec_IntFreeP( &p->vTfo   );
+    Vec_WrdFreeP( &p->vDivCexes );
+    Vec_IntFreeP( &p->vOrder );
+    Vec_IntFreeP( &p->vDivVars );
+    Vec_IntFreeP( &p->vDivIds );
+    Vec_IntFreeP( &p->vLits  );
+    Vec_IntFreeP( &p->vValues );
+    Vec_WecFreeP( &p->vClauses );
+    Vec_IntFreeP( &p->vFaninMap );
+    if ( p->pSat  ) sat_solver_delete( p->pSat );
+    ABC_FREE( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs resubstitution for the node.]
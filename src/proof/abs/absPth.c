@@ -83,7 +83,7 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 
 /**Function*************************************************************
 
-  Synopsis    [Create one thread]
+  Synopsis    [Runs the prover on one abstraction.]
 
   Description []
                
@@ -92,7 +92,7 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
   SeeAlso     []
 
 ***********************************************************************/
-void * Abs_ProverThread( void * pArg )
+int Abs_ProverTask( void * pArg )
 {
     Abs_ThData_t * pThData = (Abs_ThData_t *)pArg;
     Pdr_Par_t Pars, * pPars = &Pars;
@@ -124,10 +124,7 @@ void * Abs_ProverThread( void * pArg )
     // free memory
     Aig_ManStop( pThData->pAig );
     ABC_FREE( pThData );
-    // quit this thread
-    pthread_exit( NULL );
-    assert(0);
-    return NULL;
+    return 1;
 }
 void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
 {
@@ -136,7 +133,7 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     Ssw_Pars_t Pars, * pPars = &Pars;
     Aig_Man_t * pAig, * pTemp;
     Gia_Man_t * pAbs;
-    pthread_t ProverThread;
+    Util_Task_t * pTaskCur;
     int status;
     // disable verbosity
 //    fVerbose = 0;
@@ -171,10 +168,12 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     pThData->RunId = ++g_nRunIds;
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
-    // create thread
+    // start the prover in the background; the task frees its own data
+    // and is stopped by RunId, so it is not linked to the current task
     if ( fVerbose )  Abc_Print( 1, "\nTrying to prove abstraction %d.\n", pThData->RunId );
-    status = pthread_create( &ProverThread, NULL, Abs_ProverThread, pThData );
-    assert( status == 0 );
+    pTaskCur = Util_TaskSetCurrent( NULL );
+    Util_TaskRelease( Util_TaskSpawn( Abs_ProverTask, pThData, 0 ) );
+    Util_TaskSetCurrent( pTaskCur );
 }
 void Gia_GlaProveCancel( int fVerbose )
 {
@@ -108,6 +108,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nProcs;        // the number of threads for partitioned SAT sweeping
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -123,6 +124,8 @@ struct Cec_ParFra_t_
     int              fBMiterInfo;   // printing BMiter information
     int              nPO;           // number of po in original design given a bmiter
     char *           pDumpName;     // file name to dump statistics
+    char *           pProofFile;    // file with proved equivalences reused across runs
+    int              nProofHits;    // the number of candidates proved by the stored proofs
 };
 
 // combinational equivalence checking parameters
@@ -143,6 +146,8 @@ struct Cec_ParCec_t_
     const char *     pNameSpec;     // name of the first (spec) network
     const char *     pNameImpl;     // name of the second (impl) network
     Vec_Ptr_t *      vNamesIn;      // input names of the first network
+    char *           pProofFile;    // file with proved equivalences reused across runs
+    int              nProofHits;    // the number of candidates proved by the stored proofs
 };
 
 // sequential register correspodence parameters
@@ -245,6 +250,8 @@ extern Gia_Man_t *   Cec_ManChoiceComputation( Gia_Man_t * pAig, Cec_ParChc_t *
 /*=== cecCorr.c ==========================================================*/
 extern int           Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars );
 extern Gia_Man_t *   Cec_ManLSCorrespondence( Gia_Man_t * pAig, Cec_ParCor_t * pPars );
+/*=== cecCorrPart.c ==========================================================*/
+extern Gia_Man_t *   Cec_ManLSCorrespondencePart( Gia_Man_t * pAig, Cec_ParCor_t * pPars );
 /*=== cecCore.c ==========================================================*/
 extern void          Cec_ManSatSetDefaultParams( Cec_ParSat_t * p );
 extern void          Cec_ManSimSetDefaultParams( Cec_ParSim_t * p );
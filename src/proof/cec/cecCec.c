@@ -467,11 +467,13 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     pParsFra->fUseOrigIds  = pPars->fUseOrigIds;
     pParsFra->fVerbose     = pPars->fVerbose;
     pParsFra->fVeryVerbose = pPars->fVeryVerbose;
+    pParsFra->pProofFile   = pPars->pProofFile;
     pParsFra->fCheckMiter  = 1;
     pParsFra->fDualOut     = 1;
     pNew = Cec_ManSatSweeping( p, pParsFra, pPars->fSilent );
     ABC_SWAP( Vec_Int_t *, pInit->vIdsEquiv, p->vIdsEquiv );
     pPars->iOutFail = pParsFra->iOutFail;
+    pPars->nProofHits = pParsFra->nProofHits;
     // update
     pInit->pCexComb = p->pCexComb; p->pCexComb = NULL;
     Gia_ManStop( p );
@@ -353,7 +353,7 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSil
     Cec_ManFra_t * p;
     Cec_ManSim_t * pSim;
     Cec_ManPat_t * pPat;
-    int i, fTimeOut = 0, nMatches = 0;
+    int i, fTimeOut = 0, nMatches = 0, nPrfHits = 0;
     abctime clk, clk2, clkTotal = Abc_Clock();
     if ( pPars->fVerbose )
         printf( "Simulating %d words for %d rounds. SAT solving with %d conflicts.\n", pPars->nWords, pPars->nRounds, pPars->nBTLimit );
@@ -378,6 +378,8 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSil
     // prepare the managers
     // SAT sweeping
     p = Cec_ManFraStart( pIni, pPars );
+    if ( pPars->pProofFile )
+        p->pPrf = Cec_ManPrfStart( pPars->pProofFile, pPars->fVerbose );
     if ( pPars->fDualOut )
         pPars->fColorDiff = 1;
     // simulation
@@ -419,13 +421,20 @@ p->timeSim += Abc_Clock() - clk;
 //            p->pAig->pIso = Cec_ManDetectIsomorphism( p->pAig );
 //            Gia_ManEquivTransform( p->pAig, 1 );
         }
+        if ( p->pPrf )
+            nPrfHits = Cec_ManPrfHitNum( p->pPrf );
         pSrm = Cec_ManFraSpecReduction( p ); 
 
 //        Gia_AigerWrite( pSrm, "gia_srm.aig", 0, 0, 0 );
 
         if ( pPars->fVeryVerbose )
             Gia_ManPrintStats( pSrm, NULL );
-        if ( Gia_ManCoNum(pSrm) == 0 )
+        if ( Gia_ManCoNum(pSrm) == 0 && p->pPrf && Cec_ManPrfHitNum(p->pPrf) > nPrfHits )
+        {
+            // all remaining candidates were proved by the previous runs
+            p->nAllProved = p->nAllDisproved = p->nAllFailed = 0;
+        }
+        else if ( Gia_ManCoNum(pSrm) == 0 )
         {
             Gia_ManStop( pSrm );
             if ( p->pPars->fVerbose )
@@ -448,20 +457,29 @@ p->timeSim += Abc_Clock() - clk;
             }
             break;
         }
-clk = Abc_Clock();
-        if ( pPars->fRunCSat )
-            Cec_ManSatSolveCSat( pPat, pSrm, pParsSat ); 
         else
-            Cec_ManSatSolve( pPat, pSrm, pParsSat, p->pAig->vIdsOrig, p->vXorNodes, pAig->vIdsEquiv, 0 ); 
-p->timeSat += Abc_Clock() - clk;
-        if ( Cec_ManFraClassesUpdate( p, pSim, pPat, pSrm ) )
         {
-            Gia_ManStop( pSrm );
-            Gia_ManStop( p->pAig );
-            p->pAig = NULL;
-            goto finalize;
+clk = Abc_Clock();
+            if ( pPars->fRunCSat )
+                Cec_ManSatSolveCSat( pPat, pSrm, pParsSat ); 
+            else
+                Cec_ManSatSolve( pPat, pSrm, pParsSat, p->pAig->vIdsOrig, p->vXorNodes, pAig->vIdsEquiv, 0 ); 
+p->timeSat += Abc_Clock() - clk;
+            if ( Cec_ManFraClassesUpdate( p, pSim, pPat, pSrm ) )
+            {
+                Gia_ManStop( pSrm );
+                Gia_ManStop( p->pAig );
+                p->pAig = NULL;
+                goto finalize;
+            }
         }
         Gia_ManStop( pSrm );
+        // save the new proofs and count the reused ones
+        if ( p->pPrf )
+        {
+            Cec_ManPrfRecord( p->pPrf, p->pAig );
+            p->nAllProved += Cec_ManPrfHitNum(p->pPrf) - nPrfHits;
+        }
 
         // update the manager
         pSim->pAig = p->pAig = Gia_ManEquivReduceAndRemap( pTemp = p->pAig, 0, pParsSim->fDualOut );
@@ -484,7 +502,7 @@ p->timeSat += Abc_Clock() - clk;
             break;
         }
         // check resource limits
-        if ( p->pPars->TimeLimit && (Abc_Clock() - clkTotal)/CLOCKS_PER_SEC >= p->pPars->TimeLimit )
+        if ( (p->pPars->TimeLimit && (Abc_Clock() - clkTotal)/CLOCKS_PER_SEC >= p->pPars->TimeLimit) || Util_TaskStop() )
         {
             fTimeOut = 1;
             break;
@@ -559,6 +577,11 @@ finalize:
     pAig->pCexComb = pSim->pCexComb; pSim->pCexComb = NULL;
     Cec_ManSimStop( pSim );
     Cec_ManPatStop( pPat );
+    if ( p->pPrf )
+    {
+        pPars->nProofHits = Cec_ManPrfHitNum( p->pPrf );
+        Cec_ManPrfStop( p->pPrf, pPars->fVerbose );
+    }
     Cec_ManFraStop( p );
     if ( pTemp ) ABC_FREE( pTemp->pReprs );
     if ( pTemp ) ABC_FREE( pTemp->pNexts );
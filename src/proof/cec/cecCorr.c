@@ -24,6 +24,8 @@ ABC_NAMESPACE_IMPL_START
 
 static inline int Cec_ParCorShouldStop( Cec_ParCor_t * pPars )
 {
+    if ( Util_TaskStop() )
+        return 1;
     if ( pPars == NULL || pPars->pFunc == NULL )
         return 0;
     return ((int (*)(void *))pPars->pFunc)( pPars->pData );
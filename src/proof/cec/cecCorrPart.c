@@ -0,0 +1,470 @@
+/**CFile****************************************************************
+
+  FileName    [cecCorrPart.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Sharded signal correspondence over register partitions.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: cecCorrPart.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Cec_CorPart_t_ Cec_CorPart_t;
+struct Cec_CorPart_t_
+{
+    Cec_ParCor_t     Pars;          // parameters of this shard
+    Gia_Man_t *      pGia;          // the shard
+    Vec_Int_t *      vMap;          // shard object -> original object
+    int              Status;        // 1 if the classes of the shard are proved
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the cone of the node in the current shard.]
+
+  Description [ANDs are collected in a topological order. Newly reached
+  flop outputs are added to the queue of the candidate flops.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManCorPartCollect_rec( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vCis, Vec_Int_t * vQueue, int * pOwner, int iPart )
+{
+    int iObj = Gia_ObjId(p, pObj);
+    if ( iObj == 0 || Gia_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent(p, pObj);
+    if ( pOwner[iObj] == -1 )
+        pOwner[iObj] = iPart;
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        Vec_IntPush( vCis, iObj );
+        if ( Gia_ObjIsRo(p, pObj) )
+            Vec_IntPush( vQueue, Gia_ObjCioId(pObj) - Gia_ManPiNum(p) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Cec_ManCorPartCollect_rec( p, Gia_ObjFanin0(pObj), vNodes, vCis, vQueue, pOwner, iPart );
+    Cec_ManCorPartCollect_rec( p, Gia_ObjFanin1(pObj), vNodes, vCis, vQueue, pOwner, iPart );
+    Vec_IntPush( vNodes, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives one shard of the AIG.]
+
+  Description [The shard contains the flops in vFlops and the logic of
+  their next-state functions. Other flops in the support become primary
+  inputs, which over-approximates the behavior of the shard, so the
+  equivalences proved in the shard hold in the original AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_ManCorPartDerive( Gia_Man_t * p, Vec_Int_t * vFlops, Vec_Int_t * vNodes, Vec_Int_t * vCis, int * pFlop2Part, int iPart, Vec_Int_t ** pvMap )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vMap;
+    int i, iObj;
+    pNew = Gia_ManStart( 1 + Vec_IntSize(vCis) + Vec_IntSize(vFlops) + Vec_IntSize(vNodes) + Vec_IntSize(vFlops) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    vMap = Vec_IntAlloc( Gia_ManObjNum(pNew) );
+    Vec_IntPush( vMap, 0 );
+    Gia_ManConst0(p)->Value = 0;
+    // primary inputs and the flops of other shards become inputs
+    Vec_IntForEachEntry( vCis, iObj, i )
+    {
+        pObj = Gia_ManObj( p, iObj );
+        if ( Gia_ObjIsRo(p, pObj) && pFlop2Part[Gia_ObjCioId(pObj) - Gia_ManPiNum(p)] == iPart )
+            continue;
+        pObj->Value = Gia_ManAppendCi( pNew );
+        Vec_IntPush( vMap, iObj );
+    }
+    Vec_IntForEachEntry( vFlops, iObj, i )
+    {
+        pObj = Gia_ManRo( p, iObj );
+        pObj->Value = Gia_ManAppendCi( pNew );
+        Vec_IntPush( vMap, Gia_ObjId(p, pObj) );
+    }
+    Vec_IntForEachEntry( vNodes, iObj, i )
+    {
+        pObj = Gia_ManObj( p, iObj );
+        pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        Vec_IntPush( vMap, iObj );
+    }
+    Vec_IntForEachEntry( vFlops, iObj, i )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(Gia_ManRi(p, iObj)) );
+    Gia_ManSetRegNum( pNew, Vec_IntSize(vFlops) );
+    assert( Vec_IntSize(vMap) == Gia_ManCiNum(pNew) + Gia_ManAndNum(pNew) + 1 );
+    *pvMap = vMap;
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the flops by their structural support.]
+
+  Description [Each shard is grown from the first unassigned flop by
+  adding the flops found in the support of the flops already added,
+  in the breadth-first order, until the shard has nPartSize flops.
+  Returns the array of shards and records, for each object, the first
+  shard containing it in pOwner.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Cec_ManCorPartitions( Gia_Man_t * p, Cec_ParCor_t * pPars, int * pOwner )
+{
+    Vec_Ptr_t * vParts = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vFlops = Vec_IntAlloc( pPars->nPartSize );
+    Vec_Int_t * vQueue = Vec_IntAlloc( 100 );
+    Vec_Int_t * vNodes = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vCis   = Vec_IntAlloc( 1000 );
+    int * pFlop2Part   = ABC_FALLOC( int, Gia_ManRegNum(p) );
+    int f, k, iFlop, iPart = 0;
+    for ( f = 0; f < Gia_ManRegNum(p); f++ )
+    {
+        Cec_CorPart_t * pPart;
+        if ( pFlop2Part[f] >= 0 )
+            continue;
+        Vec_IntClear( vFlops );
+        Vec_IntClear( vNodes );
+        Vec_IntClear( vCis );
+        Vec_IntFill( vQueue, 1, f );
+        Gia_ManIncrementTravId( p );
+        Vec_IntForEachEntry( vQueue, iFlop, k )
+        {
+            if ( Vec_IntSize(vFlops) == pPars->nPartSize )
+                break;
+            if ( pFlop2Part[iFlop] >= 0 )
+                continue;
+            pFlop2Part[iFlop] = iPart;
+            Vec_IntPush( vFlops, iFlop );
+            Cec_ManCorPartCollect_rec( p, Gia_ObjFanin0(Gia_ManRi(p, iFlop)), vNodes, vCis, vQueue, pOwner, iPart );
+        }
+        Vec_IntForEachEntry( vFlops, iFlop, k )
+            if ( pOwner[Gia_ObjId(p, Gia_ManRo(p, iFlop))] == -1 )
+                pOwner[Gia_ObjId(p, Gia_ManRo(p, iFlop))] = iPart;
+        pPart = ABC_CALLOC( Cec_CorPart_t, 1 );
+        pPart->Pars = *pPars;
+        pPart->Pars.fVerbose = 0;
+        pPart->Pars.fVerboseFlops = 0;
+        // the shards run concurrently, so they do not call the user's callback
+        pPart->Pars.pFunc = NULL;
+        pPart->Pars.pData = NULL;
+        pPart->pGia = Cec_ManCorPartDerive( p, vFlops, vNodes, vCis, pFlop2Part, iPart, &pPart->vMap );
+        Vec_PtrPush( vParts, pPart );
+        iPart++;
+    }
+    Vec_IntFree( vFlops );
+    Vec_IntFree( vQueue );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vCis );
+    ABC_FREE( pFlop2Part );
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the computation should stop.]
+
+  Description [Checks the current task and the user's callback.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_ManCorPartStop( Cec_ParCor_t * pPars )
+{
+    if ( Util_TaskStop() )
+        return 1;
+    if ( pPars->pFunc == NULL )
+        return 0;
+    return ((int (*)(void *))pPars->pFunc)( pPars->pData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes equivalences of one shard.]
+
+  Description [The classes of a shard that was stopped or gave up are
+  not proved, so they are dropped and the shard is not merged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManCorPartTask( void * pArg )
+{
+    Cec_CorPart_t * pPart = (Cec_CorPart_t *)pArg;
+    pPart->Status = Cec_ManLSCorrespondenceClasses( pPart->pGia, &pPart->Pars ) && !Util_TaskStop();
+    if ( !pPart->Status )
+    {
+        ABC_FREE( pPart->pGia->pReprs );
+        ABC_FREE( pPart->pGia->pNexts );
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges the equivalences proved in the shards.]
+
+  Description [The classes of each shard are mapped back to the original
+  AIG and united. Each class is represented by its smallest object.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_ManCorPartFind( int * pUnion, int i )
+{
+    while ( pUnion[i] != i )
+        i = pUnion[i] = pUnion[pUnion[i]];
+    return i;
+}
+int Cec_ManCorPartMerge( Gia_Man_t * p, Vec_Ptr_t * vParts )
+{
+    Cec_CorPart_t * pPart;
+    int * pUnion = ABC_ALLOC( int, Gia_ManObjNum(p) );
+    int i, k, iRepr, nMerged = 0;
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        pUnion[i] = i;
+    Vec_PtrForEachEntry( Cec_CorPart_t *, vParts, pPart, k )
+    {
+        if ( !pPart->Status || pPart->pGia->pReprs == NULL )
+            continue;
+        for ( i = 1; i < Gia_ManObjNum(pPart->pGia); i++ )
+        {
+            int iRoot0, iRoot1;
+            if ( (iRepr = Gia_ObjRepr(pPart->pGia, i)) == GIA_VOID )
+                continue;
+            iRoot0 = Cec_ManCorPartFind( pUnion, Vec_IntEntry(pPart->vMap, i) );
+            iRoot1 = Cec_ManCorPartFind( pUnion, Vec_IntEntry(pPart->vMap, iRepr) );
+            if ( iRoot0 == iRoot1 )
+                continue;
+            // the smaller object becomes the root
+            pUnion[Abc_MaxInt(iRoot0, iRoot1)] = Abc_MinInt(iRoot0, iRoot1);
+        }
+    }
+    ABC_FREE( p->pReprs );
+    ABC_FREE( p->pNexts );
+    p->pReprs = ABC_CALLOC( Gia_Rpr_t, Gia_ManObjNum(p) );
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+    {
+        Gia_ObjSetRepr( p, i, GIA_VOID );
+        if ( (iRepr = Cec_ManCorPartFind(pUnion, i)) == i )
+            continue;
+        Gia_ObjSetRepr( p, i, iRepr );
+        nMerged++;
+    }
+    p->pNexts = Gia_ManDeriveNexts( p );
+    ABC_FREE( pUnion );
+    return nMerged;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares candidate classes for the reconciliation round.]
+
+  Description [Computes classes of the reduced AIG using simulation and
+  keeps only the candidates whose representative comes from a different
+  shard. The candidates within a shard have already been checked.
+  Returns the number of the remaining candidates.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManCorPartCrossing( Gia_Man_t * pRed, int * pOwner, Cec_ParCor_t * pPars )
+{
+    Cec_ParSim_t ParsSim, * pParsSim = &ParsSim;
+    Cec_ManSim_t * pSim;
+    int i, iRepr, nCands = 0;
+    Cec_ManSimSetDefaultParams( pParsSim );
+    pParsSim->nWords       = pPars->nWords;
+    pParsSim->nFrames      = pPars->nFrames;
+    pParsSim->fLatchCorr   = pPars->fLatchCorr;
+    pParsSim->fConstCorr   = pPars->fConstCorr;
+    pParsSim->fSeqSimulate = 1;
+    Gia_ManRandom( 1 );
+    pSim = Cec_ManSimStart( pRed, pParsSim );
+    Cec_ManSimClassesPrepare( pSim, pPars->nLevelMax );
+    Cec_ManSimClassesRefine( pSim );
+    Cec_ManSimStop( pSim );
+    for ( i = 1; i < Gia_ManObjNum(pRed); i++ )
+    {
+        if ( (iRepr = Gia_ObjRepr(pRed, i)) == GIA_VOID )
+            continue;
+        if ( pOwner[i] >= 0 && pOwner[i] == pOwner[iRepr] )
+            Gia_ObjSetRepr( pRed, i, GIA_VOID );
+        else if ( iRepr == 0 && pOwner[i] >= 0 )
+            Gia_ObjSetRepr( pRed, i, GIA_VOID );
+        else
+            nCands++;
+    }
+    ABC_FREE( pRed->pNexts );
+    pRed->pNexts = Gia_ManDeriveNexts( pRed );
+    return nCands;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sharded signal correspondence.]
+
+  Description [Partitions the flops by structural support, computes the
+  equivalences of the shards in parallel, reduces the AIG using them,
+  and runs a reconciliation round, which checks only the candidates
+  crossing the shard boundaries.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_ManLSCorrespondencePart( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
+{
+    Gia_Man_t * pRed, * pNew, * pTemp;
+    Gia_Obj_t * pObj;
+    Cec_CorPart_t * pPart;
+    Vec_Ptr_t * vParts;
+    int * pOwner, * pOwnerRed;
+    int i, nMerged, nCands, RetValue = 1;
+    abctime clk = Abc_Clock(), clkTotal = Abc_Clock();
+    assert( pPars->nPartSize > 0 );
+    if ( pPars->nPrefix || pPars->fMakeChoices )
+    {
+        Abc_Print( 1, "Sharded signal correspondence does not support prefix or choices.\n" );
+        return Cec_ManLSCorrespondence( pAig, pPars );
+    }
+    ABC_FREE( pAig->pReprs );
+    ABC_FREE( pAig->pNexts );
+    // derive the shards
+    pOwner = ABC_FALLOC( int, Gia_ManObjNum(pAig) );
+    vParts = Cec_ManCorPartitions( pAig, pPars, pOwner );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Derived %d shards with at most %d flops using %d threads.  ", Vec_PtrSize(vParts), pPars->nPartSize, Abc_MaxInt(pPars->nProcs, 1) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // solve the shards
+    clk = Abc_Clock();
+    Util_ProcessThreads( Cec_ManCorPartTask, vParts, Abc_MaxInt(pPars->nProcs, 1), 0, 0 );
+    if ( Cec_ManCorPartStop( pPars ) )
+    {
+        Vec_PtrForEachEntry( Cec_CorPart_t *, vParts, pPart, i )
+        {
+            Gia_ManStop( pPart->pGia );
+            Vec_IntFree( pPart->vMap );
+        }
+        Vec_PtrFreeFree( vParts );
+        ABC_FREE( pOwner );
+        return Gia_ManDup( pAig );
+    }
+    nMerged = Cec_ManCorPartMerge( pAig, vParts );
+    if ( pPars->fVerbose )
+    {
+        Vec_PtrForEachEntry( Cec_CorPart_t *, vParts, pPart, i )
+            if ( pPars->fVeryVerbose )
+                Abc_Print( 1, "%4d : Reg = %6d. PI = %6d. And = %8d. Cand = %6d.\n", i, Gia_ManRegNum(pPart->pGia),
+                    Gia_ManPiNum(pPart->pGia), Gia_ManAndNum(pPart->pGia), Gia_ManEquivCountLitsAll(pPart->pGia) );
+        Abc_Print( 1, "Merged %d objects using equivalences of the shards.  ", nMerged );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrForEachEntry( Cec_CorPart_t *, vParts, pPart, i )
+    {
+        Gia_ManStop( pPart->pGia );
+        Vec_IntFree( pPart->vMap );
+    }
+    Vec_PtrFreeFree( vParts );
+    // reduce the AIG and transfer the shard owners
+    pRed = Gia_ManCorrReduce( pAig );
+    pOwnerRed = ABC_FALLOC( int, Gia_ManObjNum(pRed) );
+    Gia_ManForEachObj( pAig, pObj, i )
+        if ( ~pObj->Value && pOwnerRed[Abc_Lit2Var(pObj->Value)] == -1 )
+            pOwnerRed[Abc_Lit2Var(pObj->Value)] = pOwner[i];
+    ABC_FREE( pOwner );
+    // check the candidates crossing the shard boundaries
+    clk = Abc_Clock();
+    nCands = Cec_ManCorPartCrossing( pRed, pOwnerRed, pPars );
+    ABC_FREE( pOwnerRed );
+    if ( nCands > 0 )
+        RetValue = Cec_ManLSCorrespondenceClasses( pRed, pPars );
+    if ( Cec_ManCorPartStop( pPars ) )
+    {
+        ABC_FREE( pAig->pReprs );
+        ABC_FREE( pAig->pNexts );
+        Gia_ManStop( pRed );
+        return Gia_ManDup( pAig );
+    }
+    // the crossing candidates are not proved if the round gave up
+    if ( RetValue == 0 )
+    {
+        ABC_FREE( pRed->pReprs );
+        ABC_FREE( pRed->pNexts );
+        nCands = 0;
+    }
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Reconciliation checked %d crossing candidates and merged %d objects.  ", nCands, nCands ? Gia_ManEquivCountLitsAll(pRed) : 0 );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // derive the result
+    if ( nCands > 0 )
+        pNew = Gia_ManCorrReduce( pRed );
+    else
+        pNew = Gia_ManDup( pRed );
+    Gia_ManStop( pRed );
+    pNew = Gia_ManSeqCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "NBeg = %d. NEnd = %d. (Gain = %6.2f %%).  RBeg = %d. REnd = %d. (Gain = %6.2f %%).\n",
+            Gia_ManAndNum(pAig), Gia_ManAndNum(pNew),
+            100.0*(Gia_ManAndNum(pAig)-Gia_ManAndNum(pNew))/(Gia_ManAndNum(pAig)?Gia_ManAndNum(pAig):1),
+            Gia_ManRegNum(pAig), Gia_ManRegNum(pNew),
+            100.0*(Gia_ManRegNum(pAig)-Gia_ManRegNum(pNew))/(Gia_ManRegNum(pAig)?Gia_ManRegNum(pAig):1) );
+        Abc_PrintTime( 1, "Total time", Abc_Clock() - clkTotal );
+    }
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -45,6 +45,9 @@ ABC_NAMESPACE_HEADER_START
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// store of proved equivalences keyed by structural cone hashes
+typedef struct Cec_ManPrf_t_ Cec_ManPrf_t;
+
 // simulation pattern manager
 typedef struct Cec_ManPat_t_ Cec_ManPat_t;
 struct Cec_ManPat_t_
@@ -152,6 +155,7 @@ struct Cec_ManFra_t_
     Cec_ParFra_t *   pPars;          // SAT sweeping parameters
     // simulation patterns
     Vec_Int_t *      vXorNodes;      // nodes used in speculative reduction
+    Cec_ManPrf_t *   pPrf;           // proofs stored by the previous runs
     int              nAllProved;     // total number of proved nodes
     int              nAllDisproved;  // total number of disproved nodes
     int              nAllFailed;     // total number of failed nodes
@@ -194,6 +198,7 @@ struct Cec_IncrMgr_t_
 extern void                 Cec_ManRefinedClassPrintStats( Gia_Man_t * p, Vec_Str_t * vStatus, int iIter, abctime Time );
 extern int                  Gia_ManCorrSpecReal( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int f, int nPrefix );
 extern void                 Gia_ManCorrSpecReduce_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int f, int nPrefix );
+extern Gia_Man_t *          Gia_ManCorrReduce( Gia_Man_t * p );
 /*=== cecCorrIncr.c ============================================================*/
 extern Cec_IncrMgr_t *      Cec_IncrMgrAlloc( Gia_Man_t * pAig, int nFrames );
 extern void                 Cec_IncrMgrFree( Cec_IncrMgr_t * p );
@@ -229,6 +234,13 @@ extern void                 Cec_ManPatSavePattern( Cec_ManPat_t *  pPat, Cec_Man
 extern void                 Cec_ManPatSavePatternCSat( Cec_ManPat_t * pMan, Vec_Int_t * vPat );
 extern Vec_Ptr_t *          Cec_ManPatCollectPatterns( Cec_ManPat_t *  pMan, int nInputs, int nWords );
 extern Vec_Ptr_t *          Cec_ManPatPackPatterns( Vec_Int_t * vCexStore, int nInputs, int nRegs, int nWordsInit );
+/*=== cecProof.c ============================================================*/
+extern Cec_ManPrf_t *       Cec_ManPrfStart( char * pFileName, int fVerbose );
+extern void                 Cec_ManPrfStop( Cec_ManPrf_t * p, int fVerbose );
+extern void                 Cec_ManPrfHashCones( Cec_ManPrf_t * p, Gia_Man_t * pAig );
+extern int                  Cec_ManPrfLookup( Cec_ManPrf_t * p, Gia_Man_t * pAig, int iRepr, int iNode );
+extern int                  Cec_ManPrfRecord( Cec_ManPrf_t * p, Gia_Man_t * pAig );
+extern int                  Cec_ManPrfHitNum( Cec_ManPrf_t * p );
 /*=== cecSeq.c ============================================================*/
 extern int                  Cec_ManSeqResimulate( Cec_ManSim_t * p, Vec_Ptr_t * vInfo );
 extern int                  Cec_ManSeqResimulateInfo( Gia_Man_t * pAig, Vec_Ptr_t * vSimInfo, Abc_Cex_t * pBestState, int fCheckMiter );
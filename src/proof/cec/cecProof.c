@@ -0,0 +1,399 @@
+/**CFile****************************************************************
+
+  FileName    [cecProof.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Reusing proved equivalences across CEC runs.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: cecProof.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+#include "misc/vec/vecHsh.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each node of the AIG is labeled by a 128-bit hash of its fanin cone,
+// which depends only on the structure of the cone and on the indexes of
+// its combinational inputs. The store keeps the proved equivalences as
+// classes of cone hashes (union-find with phases). While hashing, a cone
+// found in the store is replaced by the root of its class, so the hashes
+// do not depend on which members of the classes were merged in the TFI.
+// A candidate pair whose cones belong to the same class with the matching
+// phase computes the same function, so it is proved without a SAT call.
+
+#define CEC_PRF_MAGIC   ABC_CONST(0x32464f5250434543)  // "CECPROF2"
+#define CEC_PRF_MAX     (1 << 20)                      // the max number of cones kept in the file
+
+struct Cec_ManPrf_t_
+{
+    char *           pFileName;      // file with proved equivalences
+    Vec_Int_t *      vKeys;          // cone hashes of the entries (4 ints per entry)
+    Vec_Int_t *      vParents;       // parent literal of each entry (phase relative to parent)
+    Hsh_IntMan_t *   pHash;          // hash table of the entries
+    Vec_Wrd_t *      vCones;         // cone hashes of the current AIG (2 words per object)
+    Vec_Str_t *      vPhases;        // phases of the objects relative to their cone hashes
+    int              nLoaded;        // the number of entries read from file
+    int              nHits;          // the number of candidates proved by lookup
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Hashing primitives.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Cec_ManPrfMix( word x )
+{
+    x ^= x >> 33;
+    x *= ABC_CONST(0xff51afd7ed558ccd);
+    x ^= x >> 33;
+    x *= ABC_CONST(0xc4ceb9fe1a85ec53);
+    x ^= x >> 33;
+    return x;
+}
+static inline word Cec_ManPrfCompl( word x, int fCompl, int k )
+{
+    return fCompl ? Cec_ManPrfMix( x ^ (k ? ABC_CONST(0x9e3779b97f4a7c15) : ABC_CONST(0x2545f4914f6cdd1d)) ) : x;
+}
+static inline word Cec_ManPrfAnd( word a, word b, int k )
+{
+    word Min = Abc_MinWord( a, b ), Max = Abc_MaxWord( a, b );
+    return Cec_ManPrfMix( Cec_ManPrfMix(Min + (k ? ABC_CONST(0x5851f42d4c957f2d) : ABC_CONST(0x14057b7ef767814f))) ^ Max );
+}
+static inline word * Cec_ManPrfCone( Cec_ManPrf_t * p, int iObj )
+{
+    return Vec_WrdEntryP( p->vCones, 2*iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or adds the entry of the cone.]
+
+  Description [Returns -1 if the entry is not found and fAdd is 0.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_ManPrfEntry( Cec_ManPrf_t * p, word * pCone, int fAdd )
+{
+    int i, nEntries = Hsh_IntManEntryNum( p->pHash ), * pData = (int *)pCone;
+    if ( !fAdd )
+    {
+        int * pPlace = Hsh_IntManLookup( p->pHash, (unsigned *)pCone );
+        return *pPlace == -1 ? -1 : (int)Hsh_IntObj(p->pHash, *pPlace)->iData;
+    }
+    for ( i = 0; i < 4; i++ )
+        Vec_IntPush( p->vKeys, pData[i] );
+    i = Hsh_IntManAdd( p->pHash, nEntries );
+    if ( i < nEntries )
+        Vec_IntShrink( p->vKeys, 4 * nEntries );
+    else
+        Vec_IntPush( p->vParents, Abc_Var2Lit(i, 0) );
+    return i;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the root literal of the entry's class.]
+
+  Description [Compresses the path to the root.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_ManPrfFind( Cec_ManPrf_t * p, int iEntry )
+{
+    int iLit = Vec_IntEntry( p->vParents, iEntry ), iRoot;
+    if ( Abc_Lit2Var(iLit) == iEntry )
+        return iLit;
+    iRoot = Abc_LitNotCond( Cec_ManPrfFind(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+    Vec_IntWriteEntry( p->vParents, iEntry, iRoot );
+    return iRoot;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the store and loads the proofs from file.]
+
+  Description [The file does not have to exist.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cec_ManPrf_t * Cec_ManPrfStart( char * pFileName, int fVerbose )
+{
+    Cec_ManPrf_t * p;
+    FILE * pFile;
+    word Header[2], Entry[3];
+    p = ABC_CALLOC( Cec_ManPrf_t, 1 );
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    p->vKeys     = Vec_IntAlloc( 4 * 1000 );
+    p->vParents  = Vec_IntAlloc( 1000 );
+    p->pHash     = Hsh_IntManStart( p->vKeys, 4, 1000 );
+    p->vCones    = Vec_WrdAlloc( 0 );
+    p->vPhases   = Vec_StrAlloc( 0 );
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return p;
+    if ( fread( Header, sizeof(word), 2, pFile ) != 2 || Header[0] != CEC_PRF_MAGIC )
+        printf( "File \"%s\" does not contain stored proofs and will be overwritten.\n", pFileName );
+    else
+    {
+        // the entries are unique and their parents are written after path compression
+        while ( fread( Entry, sizeof(word), 3, pFile ) == 3 && Entry[2] < 2*Header[1] )
+            if ( Cec_ManPrfEntry( p, Entry, 1 ) == p->nLoaded )
+                Vec_IntWriteEntry( p->vParents, p->nLoaded++, (int)Entry[2] );
+        if ( p->nLoaded != (int)Header[1] )
+        {
+            printf( "File \"%s\" is corrupted and will be overwritten.\n", pFileName );
+            Vec_IntClear( p->vKeys );
+            Vec_IntClear( p->vParents );
+            Hsh_IntManStop( p->pHash );
+            p->pHash = Hsh_IntManStart( p->vKeys, 4, 1000 );
+            p->nLoaded = 0;
+        }
+    }
+    fclose( pFile );
+    if ( fVerbose )
+        printf( "Loaded %d cones with proved equivalences from file \"%s\".\n", p->nLoaded, pFileName );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the entries to be written into file.]
+
+  Description [If there are more than CEC_PRF_MAX entries, the oldest
+  ones are dropped. Classes left with one entry are dropped too. Returns
+  the parent literals of the selected entries, renumbered in the file
+  order, or -1 for the dropped entries.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Cec_ManPrfPrune( Cec_ManPrf_t * p )
+{
+    int nEntries = Vec_IntSize(p->vParents);
+    int iFirst = Abc_MaxInt( nEntries - CEC_PRF_MAX, 0 );
+    Vec_Int_t * vCounts = Vec_IntStart( nEntries );
+    Vec_Int_t * vReprs  = Vec_IntStartFull( nEntries );
+    Vec_Int_t * vRes    = Vec_IntStartFull( nEntries );
+    int i, iRoot, iRepr, nSelected = 0;
+    for ( i = iFirst; i < nEntries; i++ )
+        Vec_IntAddToEntry( vCounts, Abc_Lit2Var(Cec_ManPrfFind(p, i)), 1 );
+    for ( i = iFirst; i < nEntries; i++ )
+    {
+        iRoot = Cec_ManPrfFind( p, i );
+        if ( Vec_IntEntry(vCounts, Abc_Lit2Var(iRoot)) < 2 )
+            continue;
+        // the first selected entry of the class becomes its root in the file
+        if ( (iRepr = Vec_IntEntry(vReprs, Abc_Lit2Var(iRoot))) == -1 )
+            Vec_IntWriteEntry( vReprs, Abc_Lit2Var(iRoot), (iRepr = Abc_Var2Lit(nSelected, Abc_LitIsCompl(iRoot))) );
+        Vec_IntWriteEntry( vRes, i, Abc_LitNotCond(iRepr, Abc_LitIsCompl(iRoot)) );
+        nSelected++;
+    }
+    Vec_IntFree( vCounts );
+    Vec_IntFree( vReprs );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the proofs into file and stops the store.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManPrfStop( Cec_ManPrf_t * p, int fVerbose )
+{
+    int i, iLit, nEntries = Vec_IntSize(p->vParents), nWritten = 0;
+    FILE * pFile = fopen( p->pFileName, "wb" );
+    if ( pFile == NULL )
+        printf( "Cannot open file \"%s\" for writing.\n", p->pFileName );
+    else
+    {
+        Vec_Int_t * vParents = Cec_ManPrfPrune( p );
+        word Header[2] = { CEC_PRF_MAGIC, 0 }, Entry[3];
+        Vec_IntForEachEntry( vParents, iLit, i )
+            nWritten += (iLit != -1);
+        Header[1] = (word)nWritten;
+        fwrite( Header, sizeof(word), 2, pFile );
+        Vec_IntForEachEntry( vParents, iLit, i )
+        {
+            if ( iLit == -1 )
+                continue;
+            memcpy( Entry, Vec_IntEntryP(p->vKeys, 4*i), 2*sizeof(word) );
+            Entry[2] = (word)iLit;
+            fwrite( Entry, sizeof(word), 3, pFile );
+        }
+        fclose( pFile );
+        Vec_IntFree( vParents );
+        if ( fVerbose )
+            printf( "Reused %d stored proofs. Written %d cones (%d new, %d dropped) into file \"%s\".\n",
+                p->nHits, nWritten, nEntries - p->nLoaded, nEntries - nWritten, p->pFileName );
+    }
+    Hsh_IntManStop( p->pHash );
+    Vec_IntFree( p->vKeys );
+    Vec_IntFree( p->vParents );
+    Vec_WrdFree( p->vCones );
+    Vec_StrFree( p->vPhases );
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes structural hashes of all fanin cones.]
+
+  Description [The cones with proved equivalences are replaced by
+  the roots of their classes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManPrfHashCones( Cec_ManPrf_t * p, Gia_Man_t * pAig )
+{
+    Gia_Obj_t * pObj;
+    word * pCone, * pCone0, * pCone1;
+    int i, k, fCompl0, fCompl1, iEntry, iRoot;
+    Vec_WrdFill( p->vCones, 2*Gia_ManObjNum(pAig), 0 );
+    Vec_StrFill( p->vPhases, Gia_ManObjNum(pAig), 0 );
+    Gia_ManForEachObj( pAig, pObj, i )
+    {
+        pCone = Cec_ManPrfCone( p, i );
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            pCone0  = Cec_ManPrfCone( p, Gia_ObjFaninId0(pObj, i) );
+            pCone1  = Cec_ManPrfCone( p, Gia_ObjFaninId1(pObj, i) );
+            fCompl0 = Gia_ObjFaninC0(pObj) ^ Vec_StrEntry( p->vPhases, Gia_ObjFaninId0(pObj, i) );
+            fCompl1 = Gia_ObjFaninC1(pObj) ^ Vec_StrEntry( p->vPhases, Gia_ObjFaninId1(pObj, i) );
+            for ( k = 0; k < 2; k++ )
+                pCone[k] = Cec_ManPrfAnd( Cec_ManPrfCompl(pCone0[k], fCompl0, k), Cec_ManPrfCompl(pCone1[k], fCompl1, k), k );
+        }
+        else if ( Gia_ObjIsCi(pObj) )
+        {
+            pCone[0] = Cec_ManPrfMix( (word)Gia_ObjCioId(pObj) + 1 );
+            pCone[1] = Cec_ManPrfMix( ((word)Gia_ObjCioId(pObj) + 1) << 32 );
+        }
+        else if ( Gia_ObjIsConst0(pObj) )
+            pCone[0] = pCone[1] = ABC_CONST(0x8badf00d8badf00d);
+        else
+            continue;
+        // replace the cone by the root of its class
+        if ( Vec_IntSize(p->vParents) == 0 || (iEntry = Cec_ManPrfEntry(p, pCone, 0)) == -1 )
+            continue;
+        iRoot = Cec_ManPrfFind( p, iEntry );
+        memcpy( pCone, Vec_IntEntryP(p->vKeys, 4*Abc_Lit2Var(iRoot)), 2*sizeof(word) );
+        Vec_StrWriteEntry( p->vPhases, i, (char)Abc_LitIsCompl(iRoot) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the candidate pair was proved before.]
+
+  Description [Assumes that the cone hashes and the phases are computed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManPrfLookup( Cec_ManPrf_t * p, Gia_Man_t * pAig, int iRepr, int iNode )
+{
+    int fCompl = Gia_ObjPhase(Gia_ManObj(pAig, iRepr)) ^ Gia_ObjPhase(Gia_ManObj(pAig, iNode));
+    int iEntryR, iEntryN;
+    fCompl ^= Vec_StrEntry(p->vPhases, iRepr) ^ Vec_StrEntry(p->vPhases, iNode);
+    if ( Vec_IntSize(p->vParents) == 0 )
+        return 0;
+    if ( (iEntryR = Cec_ManPrfEntry(p, Cec_ManPrfCone(p, iRepr), 0)) == -1 )
+        return 0;
+    if ( (iEntryN = Cec_ManPrfEntry(p, Cec_ManPrfCone(p, iNode), 0)) == -1 )
+        return 0;
+    if ( Cec_ManPrfFind(p, iEntryR) != Abc_LitNotCond(Cec_ManPrfFind(p, iEntryN), fCompl) )
+        return 0;
+    p->nHits++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the proved nodes of the current AIG.]
+
+  Description [Returns the number of merged classes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManPrfRecord( Cec_ManPrf_t * p, Gia_Man_t * pAig )
+{
+    Gia_Obj_t * pObj;
+    int i, iRepr, fCompl, iRootR, iRootN, Counter = 0;
+    Gia_ManForEachAnd( pAig, pObj, i )
+    {
+        if ( !Gia_ObjProved(pAig, i) || (iRepr = Gia_ObjRepr(pAig, i)) == GIA_VOID )
+            continue;
+        fCompl = Gia_ObjPhase(Gia_ManObj(pAig, iRepr)) ^ Gia_ObjPhase(pObj);
+        fCompl ^= Vec_StrEntry(p->vPhases, iRepr) ^ Vec_StrEntry(p->vPhases, i);
+        iRootR = Cec_ManPrfFind( p, Cec_ManPrfEntry(p, Cec_ManPrfCone(p, iRepr), 1) );
+        iRootN = Cec_ManPrfFind( p, Cec_ManPrfEntry(p, Cec_ManPrfCone(p, i), 1) );
+        if ( Abc_Lit2Var(iRootR) == Abc_Lit2Var(iRootN) )
+            continue;
+        // the cone of N is the cone of R complemented by fCompl
+        Vec_IntWriteEntry( p->vParents, Abc_Lit2Var(iRootN), Abc_LitNotCond(iRootR, Abc_LitIsCompl(iRootN) ^ fCompl) );
+        Counter++;
+    }
+    return Counter;
+}
+int Cec_ManPrfHitNum( Cec_ManPrf_t * p )
+{
+    return p->nHits;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -61,8 +61,8 @@ struct Cec_SproveTrace_t_;
 static int Cec_SProveCallback( void * pUser, int fSolved, unsigned Result );
 static Gia_Man_t * Cec_GiaScorrOld( Gia_Man_t * p, int nTimeOut, Par_Share_t * pShare, struct Cec_ScorrStop_t_ * pStopOut );
 static Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p, int nTimeOut, Par_Share_t * pShare, struct Cec_ScorrStop_t_ * pStopOut );
-static void Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int nTimeOut, int nTimeOutU, Wlc_Ntk_t * pWlc, const char * pUfarArgs, int fVerbose, pthread_t * WorkerThread, Par_Share_t * pShare, int * pEngines, int StageId, int NetId, struct Cec_SproveTrace_t_ * pTrace );
-static void Cec_GiaStopThreads( Par_ThData_t * ThData, pthread_t * WorkerThread, int nWorkers );
+static void Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int nTimeOut, int nTimeOutU, Wlc_Ntk_t * pWlc, const char * pUfarArgs, int fVerbose, Par_Share_t * pShare, int * pEngines, int StageId, int NetId, struct Cec_SproveTrace_t_ * pTrace );
+static void Cec_GiaStopThreads( Par_ThData_t * ThData, int nWorkers );
 static int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int RetValue, int * pRetEngine );
 
 extern int Ufar_ProveWithTimeout( Wlc_Ntk_t * pNtk, int nTimeOut, int fVerbose, int (*pFuncStop)(int), int RunId, const char * pArgs );
@@ -92,13 +92,12 @@ struct Par_Share_t_
     volatile int       fSolved;
     volatile unsigned  Result;
     volatile int       iEngine;
+    Util_Task_t *      pToken;   // cancelled when the problem is solved
 };
 typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
     int         iEngine;
-    int         fWorking;
-    int         fStop;
     int         nTimeOut;
     int         Result;
     int         fVerbose;
@@ -111,8 +110,7 @@ typedef struct Par_ThData_t_
     int         StopReason;
     Par_Share_t * pShare;
     Cec_SproveTrace_t * pTrace;
-    pthread_mutex_t Mutex;
-    pthread_cond_t  Cond;
+    Util_Task_t * pTask;
 } Par_ThData_t;
 typedef struct Cec_ScorrStop_t_
 {
@@ -198,19 +196,19 @@ static inline void Cec_CopyGiaNameToAig( Gia_Man_t * pGia, Aig_Man_t * pAig )
 static int Cec_SProveStopUfar( int RunId )
 {
     (void)RunId;
-    return g_pUfarShare && g_pUfarShare->fSolved != 0;
+    return (g_pUfarShare && g_pUfarShare->fSolved != 0) || Util_TaskStop();
 }
 static int Cec_SProveStopGla( int RunId )
 {
     (void)RunId;
-    return g_pGlaShare && g_pGlaShare->fSolved != 0;
+    return (g_pGlaShare && g_pGlaShare->fSolved != 0) || Util_TaskStop();
 }
 static int Cec_ScorrStop( void * pUser )
 {
     Cec_ScorrStop_t * p = (Cec_ScorrStop_t *)pUser;
     if ( p == NULL )
         return 0;
-    if ( p->pShare && p->pShare->fSolved )
+    if ( (p->pShare && p->pShare->fSolved) || Util_TaskStop() )
     {
         p->fStoppedByCallback = 1;
         return 1;
@@ -235,10 +233,11 @@ static int Cec_SProveCallback( void * pUser, int fSolved, unsigned Result )
             pShare->fSolved = 1;
             pShare->Result  = Result;
             pShare->iEngine = pThData->iEngine;
+            Util_TaskCancel( pShare->pToken );
         }
         return 0;
     }
-    return pShare->fSolved != 0;
+    return pShare->fSolved != 0 || Util_TaskStop();
 }
 
 static inline const char * Cec_SproveNetName( int NetId )
@@ -726,11 +725,13 @@ static Gia_Man_t * Cec_SproveRunReduce( Gia_Man_t * pInput, Cec_SproveStage_t *
         pOutput = Cec_GiaScorrOld( pInput, pStage->ReduceTimeout, pShare, &Stop );
     else
         assert( 0 );
-    if ( Gia_ManAndNum(pOutput) == 0 )
+    // the classes of a stopped run are not proved and cannot solve the problem
+    if ( Gia_ManAndNum(pOutput) == 0 && !pShare->fSolved && !Stop.fStoppedByCallback && !Stop.fStoppedByTimeout )
     {
         pShare->fSolved = 1;
         pShare->Result  = 1;
         pShare->iEngine = pStage->ReduceType;
+        Util_TaskCancel( pShare->pToken );
         *pRetValue = 1;
         *pRetEngine = pStage->ReduceType;
     }
@@ -764,11 +765,10 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
 {
     abctime clkTotal = Abc_Clock(), clkStage = 0;
     Par_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
     Par_ThData_t UifData[1];
-    pthread_t UifThread[1];
     Par_Share_t Share;
     Cec_SproveTrace_t Trace;
+    Util_Task_t * pTaskCur;
     Gia_Man_t * pScorr = NULL, * pScorr2 = NULL;
     int UifEngines[1] = { PAR_ENGINE_UFAR };
     int i, RetValue = -1, RetEngine = -1, fThreadsStarted = 0, fUifStarted = 0;
@@ -776,9 +776,10 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
     memset( &Share, 0, sizeof(Par_Share_t) );
     memset( &Trace, 0, sizeof(Cec_SproveTrace_t) );
     memset( ThData, 0, sizeof(ThData) );
-    memset( WorkerThread, 0, sizeof(WorkerThread) );
     memset( UifData, 0, sizeof(UifData) );
-    memset( UifThread, 0, sizeof(UifThread) );
+    // the engines started below inherit this token and stop when it is cancelled
+    Share.pToken = Util_TaskToken( 0 );
+    pTaskCur = Util_TaskSetCurrent( Share.pToken );
     Abc_CexFreeP( &p->pCexComb );
     Abc_CexFreeP( &p->pCexSeq );
     if ( !fSilent && fVerbose )
@@ -792,7 +793,7 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
         Cec_SproveTraceWrite( &Trace, "START kind=ufar mode=persistent timeout=%d t=%llu",
             pPlan->nTimeOutUif, Cec_SproveClockToMs( Cec_SproveTraceTime(&Trace) ) );
         Cec_GiaInitThreads( UifData, 1, p, pPlan->nTimeOutUif, pPlan->nTimeOutUif, pWlc, pPlan->pUfarArgs, fVerbose,
-            UifThread, &Share, UifEngines, 0, SPROVE_NET_ORIG, &Trace );
+            &Share, UifEngines, 0, SPROVE_NET_ORIG, &Trace );
         fUifStarted = 1;
     }
     for ( i = 0; i < pPlan->nStages; i++ )
@@ -816,7 +817,7 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
             Cec_SproveTraceWrite( &Trace, "START kind=round stage=%d net=%s timeout=%d t=%llu",
                 pStage->Id, Cec_SproveNetName(pStage->RoundNet), pStage->RoundTimeout, Cec_SproveClockToMs( Cec_SproveTraceTime(&Trace) ) );
             Cec_GiaInitThreads( ThData, pStage->nRoundEngines, pRoundNet, pStage->RoundTimeout, pStage->RoundTimeout, pWlc, pPlan->pUfarArgs, fVerbose,
-                fThreadsStarted ? NULL : WorkerThread, &Share, pStage->RoundEngines, pStage->Id, pStage->RoundNet, &Trace );
+                &Share, pStage->RoundEngines, pStage->Id, pStage->RoundNet, &Trace );
             fThreadsStarted = 1;
         }
         if ( pStage->fHasReduce )
@@ -859,9 +860,11 @@ static int Cec_SproveExecutePlan( Gia_Man_t * p, Cec_SprovePlan_t * pPlan, Wlc_N
             Cec_SproveClockToMs( Cec_SproveTraceTime(&Trace) ) );
     }
     if ( fThreadsStarted )
-        Cec_GiaStopThreads( ThData, WorkerThread, pPlan->Stages[0].nRoundEngines );
+        Cec_GiaStopThreads( ThData, PAR_THR_MAX );
     if ( fUifStarted )
-        Cec_GiaStopThreads( UifData, UifThread, 1 );
+        Cec_GiaStopThreads( UifData, 1 );
+    Util_TaskSetCurrent( pTaskCur );
+    Util_TaskFree( Share.pToken );
     Gia_ManStopP( &pScorr2 );
     Gia_ManStopP( &pScorr );
     if ( !fSilent )
@@ -1135,88 +1138,19 @@ Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p, int nTimeOut, Par_Share_t * pShare,
   SeeAlso     []
 
 ***********************************************************************/
-void * Cec_GiaProveWorkerThread( void * pArg )
+int Cec_GiaProveWorkerTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    int status, Result;
-    status = pthread_mutex_lock( &pThData->Mutex );
-    assert( status == 0 );
-    while ( 1 )
-    {
-        while ( !pThData->fWorking && !pThData->fStop )
-        {
-            status = pthread_cond_wait( &pThData->Cond, &pThData->Mutex );
-            assert( status == 0 );
-        }
-        if ( pThData->fStop )
-            break;
-        status = pthread_mutex_unlock( &pThData->Mutex );
-        assert( status == 0 );
-        Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->fVerbose, pThData );
-        status = pthread_mutex_lock( &pThData->Mutex );
-        assert( status == 0 );
-        pThData->Result = Result;
-        pThData->fWorking = 0;
-        status = pthread_cond_broadcast( &pThData->Cond );
-        assert( status == 0 );
-    }
-    status = pthread_mutex_unlock( &pThData->Mutex );
-    assert( status == 0 );
-    return NULL;
-}
-static void Cec_GiaStartThreads( Par_ThData_t * ThData, int nWorkers )
-{
-    int i, status;
-    for ( i = 0; i < nWorkers; i++ )
-    {
-        status = pthread_mutex_lock( &ThData[i].Mutex );
-        assert( status == 0 );
-        assert( !ThData[i].fStop );
-        assert( !ThData[i].fWorking );
-        ThData[i].fWorking = 1;
-        status = pthread_cond_signal( &ThData[i].Cond );
-        assert( status == 0 );
-        status = pthread_mutex_unlock( &ThData[i].Mutex );
-        assert( status == 0 );
-    }
+    pThData->Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->fVerbose, pThData );
+    return 1;
 }
-static void Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int nTimeOut, int nTimeOutU, Wlc_Ntk_t * pWlc, const char * pUfarArgs, int fVerbose, pthread_t * WorkerThread, Par_Share_t * pShare, int * pEngines, int StageId, int NetId, Cec_SproveTrace_t * pTrace )
+static void Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int nTimeOut, int nTimeOutU, Wlc_Ntk_t * pWlc, const char * pUfarArgs, int fVerbose, Par_Share_t * pShare, int * pEngines, int StageId, int NetId, Cec_SproveTrace_t * pTrace )
 {
-    int i, status;
+    int i;
     assert( nWorkers <= PAR_THR_MAX );
     for ( i = 0; i < nWorkers; i++ )
     {
-        if ( WorkerThread )
-        {
-            ThData[i].p = Gia_ManDup( p );
-            Cec_CopyGiaName( p, ThData[i].p );
-            ThData[i].iEngine = pEngines[i];
-            ThData[i].fWorking = 0;
-            ThData[i].fStop    = 0;
-            ThData[i].nTimeOut = nTimeOut;
-            ThData[i].Result   = -1;
-            ThData[i].fVerbose = fVerbose;
-            ThData[i].nTimeOutU= nTimeOutU;
-            ThData[i].pWlc     = pWlc;
-            ThData[i].pUfarArgs= pUfarArgs;
-            ThData[i].WorkerId = i;
-            ThData[i].StageId  = StageId;
-            ThData[i].NetId    = NetId;
-            ThData[i].StopReason = 0;
-            ThData[i].pShare   = pShare;
-            ThData[i].pTrace   = pTrace;
-            status = pthread_mutex_init( &ThData[i].Mutex, NULL );
-            assert( status == 0 );
-            status = pthread_cond_init( &ThData[i].Cond, NULL );
-            assert( status == 0 );
-            status = pthread_create( WorkerThread + i, NULL, Cec_GiaProveWorkerThread, (void *)(ThData + i) );
-            assert( status == 0 );
-            continue;
-        }
-        status = pthread_mutex_lock( &ThData[i].Mutex );
-        assert( status == 0 );
-        assert( !ThData[i].fStop );
-        assert( !ThData[i].fWorking );
+        assert( ThData[i].pTask == NULL );
         Gia_ManStopP( &ThData[i].p );
         ThData[i].p = Gia_ManDup( p );
         Cec_CopyGiaName( p, ThData[i].p );
@@ -1233,54 +1167,40 @@ static void Cec_GiaInitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t *
         ThData[i].StopReason = 0;
         ThData[i].pShare   = pShare;
         ThData[i].pTrace   = pTrace;
-        status = pthread_mutex_unlock( &ThData[i].Mutex );
-        assert( status == 0 );
     }
-    Cec_GiaStartThreads( ThData, nWorkers );
+    // engines run for the whole stage, so each one gets its own pool thread
+    for ( i = 0; i < nWorkers; i++ )
+        ThData[i].pTask = Util_TaskSpawn( Cec_GiaProveWorkerTask, (void *)(ThData + i), 0 );
 }
-static void Cec_GiaStopThreads( Par_ThData_t * ThData, pthread_t * WorkerThread, int nWorkers )
+static void Cec_GiaStopThreads( Par_ThData_t * ThData, int nWorkers )
 {
-    int i, status;
-    for ( i = 0; i < nWorkers; i++ )
-    {
-        status = pthread_mutex_lock( &ThData[i].Mutex );
-        assert( status == 0 );
-        ThData[i].fStop = 1;
-        status = pthread_cond_signal( &ThData[i].Cond );
-        assert( status == 0 );
-        status = pthread_mutex_unlock( &ThData[i].Mutex );
-        assert( status == 0 );
-    }
+    int i;
     for ( i = 0; i < nWorkers; i++ )
     {
-        status = pthread_join( WorkerThread[i], NULL );
-        assert( status == 0 );
+        assert( ThData[i].pTask == NULL );
         Gia_ManStopP( &ThData[i].p );
-        status = pthread_cond_destroy( &ThData[i].Cond );
-        assert( status == 0 );
-        status = pthread_mutex_destroy( &ThData[i].Mutex );
-        assert( status == 0 );
     }
 }
 static int Cec_GiaWaitThreads( Par_ThData_t * ThData, int nWorkers, Gia_Man_t * p, int RetValue, int * pRetEngine )
 {
-    int i, status, fWorking;
+    int i;
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        if ( ThData[i].pTask == NULL )
+            continue;
+        Util_TaskWait( ThData[i].pTask );
+        Util_TaskFree( ThData[i].pTask );
+        ThData[i].pTask = NULL;
+    }
     for ( i = 0; i < nWorkers; i++ )
     {
-        status = pthread_mutex_lock( &ThData[i].Mutex );
-        assert( status == 0 );
-        fWorking = ThData[i].fWorking;
-        if ( RetValue == -1 && !fWorking && ThData[i].Result != -1 )
+        if ( RetValue == -1 && ThData[i].Result != -1 )
         {
             RetValue = ThData[i].Result;
             *pRetEngine = ThData[i].iEngine;
             if ( !p->pCexSeq && ThData[i].p->pCexSeq )
                 p->pCexSeq = Abc_CexDup( ThData[i].p->pCexSeq, -1 );
         }
-        status = pthread_mutex_unlock( &ThData[i].Mutex );
-        assert( status == 0 );
-        if ( fWorking )
-            i = -1;
     }
     return RetValue;
 }
@@ -966,18 +966,22 @@ int Cec4_ManSimulateCos( Gia_Man_t * p )
 void Cec4_ManSimulate( Gia_Man_t * p, Cec4_Man_t * pMan )
 {
     abctime clk = Abc_Clock();
+    int nThreads = Abc_MaxInt( 1, pMan->pPars->nProcs );
     Gia_Obj_t * pObj; int i;
     pMan->nSimulates++;
     if ( pMan->pTable == NULL )
         Cec4_RefineInit( p, pMan );
     else
         assert( Vec_IntSize(pMan->vRefClasses) == 0 );
+    // with several threads, the nodes are simulated first and the classes are checked next
+    if ( nThreads > 1 )
+        Gia_ManSimPatSimMtInt( p, Vec_WrdArray(p->vSims), p->nSimWords, nThreads );
     Gia_ManForEachAnd( p, pObj, i )
     {
         int iRepr = Gia_ObjRepr( p, i );
-        if ( Gia_ObjIsXor(pObj) )
+        if ( nThreads == 1 && Gia_ObjIsXor(pObj) )
             Cec4_ObjSimXor( p, i );
-        else
+        else if ( nThreads == 1 )
             Cec4_ObjSimAnd( p, i );
         if ( iRepr == GIA_VOID || p->pReprs[iRepr].fColorA || Cec4_ObjSimEqual(p, iRepr, i) )
             continue;
@@ -1642,6 +1646,48 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     //    printf( "*  " );
     return status;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Records the counter-example and resimulates when full.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec4_ManSavePattern( Cec4_Man_t * p, Vec_Int_t * vPat )
+{
+    int i, iLit;
+    assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
+    p->pAig->iPatsPi++;
+    Vec_IntForEachEntry( vPat, iLit, i )
+        Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
+    if ( p->pAig->vPats )
+    {
+        Vec_IntPush( p->pAig->vPats, Vec_IntSize(vPat)+2 );
+        Vec_IntAppend( p->pAig->vPats, vPat );
+        Vec_IntPush( p->pAig->vPats, -1 );
+    }
+}
+void Cec4_ManResimulatePatterns( Cec4_Man_t * p )
+{
+    abctime clk2;
+    if ( p->pAig->iPatsPi != 64 * p->pAig->nSimWords - 2 )
+        return;
+    clk2 = Abc_Clock();
+    Cec4_ManSimulate( p->pAig, p );
+    //printf( "FasterSmall = %d.  FasterBig = %d.\n", p->nFaster[0], p->nFaster[1] );
+    p->nFaster[0] = p->nFaster[1] = 0;
+    //if ( p->nSatSat && p->nSatSat % 100 == 0 )
+        Cec4_ManPrintStats( p->pAig, p->pPars, p, 0 );
+    Vec_IntFill( p->vCexStamps, Gia_ManObjNum(p->pAig), 0 );
+    p->pAig->iPatsPi = 0;
+    Vec_WrdFill( p->pAig->vSimsPi, Vec_WrdSize(p->pAig->vSimsPi), 0 );
+    p->timeResimGlo += Abc_Clock() - clk2;
+}
 int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
 {
     abctime clk = Abc_Clock();
@@ -1653,7 +1699,6 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
     status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
     if ( status == GLUCOSE_SAT )
     {
-        int iLit;
         //int iPatsOld = p->pAig->iPatsPi;
         //printf( "Disproved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatSat++;
@@ -1671,16 +1716,7 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
             for ( i = 0; i < pCex[0]; )
                 Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
         }
-        assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
-        p->pAig->iPatsPi++;
-        Vec_IntForEachEntry( p->vPat, iLit, i )
-            Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
-        if ( p->pAig->vPats )
-        {
-            Vec_IntPush( p->pAig->vPats, Vec_IntSize(p->vPat)+2 );
-            Vec_IntAppend( p->pAig->vPats, p->vPat );
-            Vec_IntPush( p->pAig->vPats, -1 );
-        }
+        Cec4_ManSavePattern( p, p->vPat );
         //Cec4_ManPackAddPattern( p->pAig, p->vPat, 0 );
         //assert( iPatsOld + 1 == p->pAig->iPatsPi );
         if ( fEasy )
@@ -1691,19 +1727,7 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         // this is not needed, but we keep it here anyway, because it takes very little time
         //Cec4_ManVerify( p->pNew, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, p->pSat );
         // resimulated once in a while
-        if ( p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 2 )
-        {
-            abctime clk2 = Abc_Clock();
-            Cec4_ManSimulate( p->pAig, p );
-            //printf( "FasterSmall = %d.  FasterBig = %d.\n", p->nFaster[0], p->nFaster[1] );
-            p->nFaster[0] = p->nFaster[1] = 0;
-            //if ( p->nSatSat && p->nSatSat % 100 == 0 )
-                Cec4_ManPrintStats( p->pAig, p->pPars, p, 0 );
-            Vec_IntFill( p->vCexStamps, Gia_ManObjNum(p->pAig), 0 );
-            p->pAig->iPatsPi = 0;
-            Vec_WrdFill( p->pAig->vSimsPi, Vec_WrdSize(p->pAig->vSimsPi), 0 );
-            p->timeResimGlo += Abc_Clock() - clk2;
-        }
+        Cec4_ManResimulatePatterns( p );
     }
     else if ( status == GLUCOSE_UNSAT )
     {
@@ -1746,6 +1770,382 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
     }
     return RetValue;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Partitioned multi-threaded SAT sweeping.]
+
+  Description [The candidate equivalences are divided into windows of
+  consecutive candidates, which roughly correspond to level bands. Each
+  window is solved by a thread with its own SAT solver, which loads the
+  cones of the candidates directly from the AIG, while the AIG and its
+  classes are not modified. The loaded cones are speculatively reduced:
+  the fanins that are candidates are replaced by their representatives.
+  After the round, the results are accepted in the topological order:
+  a proof is valid if the speculative cones of both nodes contain only
+  the candidates whose proofs were accepted. The counter-examples of all
+  windows are simulated to refine the classes before the next round.
+  The remaining candidates are handled by the serial sweeping.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec4_Win_t_ Cec4_Win_t;
+struct Cec4_Win_t_
+{
+    Gia_Man_t *      pAig;           // user's AIG (read-only)
+    Vec_Bit_t *      vSpec;          // nodes replaced by their representatives (shared)
+    Vec_Int_t *      vPairs;         // candidates (iRepr, iObj) in this window
+    Vec_Int_t *      vStatus;        // the status of each candidate
+    Vec_Int_t *      vCexes;         // counter-examples (size followed by CI literals)
+    Vec_Int_t *      vSatLits;       // SAT literals of the objects
+    Vec_Int_t *      vUsed;          // objects with SAT literals
+    Vec_Int_t *      vVarObjs;       // objects of the SAT variables
+    Vec_Int_t *      vStack;         // DFS stack
+    sat_solver *     pSat;           // thread-local SAT solver
+    int              jType;          // solver type
+    int              nBTLimit;       // conflict limit
+    int              nCexMax;        // the max number of counter-examples
+    int              nSat;           // statistics
+    int              nUnsat;
+    int              nUndec;
+};
+static inline int Cec4_WinFaninId( Cec4_Win_t * p, int iFan )
+{
+    return Vec_BitEntry(p->vSpec, iFan) ? Gia_ObjRepr(p->pAig, iFan) : iFan;
+}
+static inline int Cec4_WinFaninLit( Cec4_Win_t * p, int iFan, int fCompl )
+{
+    int iLit = Vec_IntEntry( p->vSatLits, Cec4_WinFaninId(p, iFan) );
+    if ( Vec_BitEntry(p->vSpec, iFan) )
+        fCompl ^= Gia_ManObj(p->pAig, iFan)->fPhase ^ Gia_ObjReprObj(p->pAig, iFan)->fPhase;
+    return Abc_LitNotCond( iLit, fCompl );
+}
+int Cec4_WinObjGetCnfLit( Cec4_Win_t * p, int iObj )
+{
+    Gia_Obj_t * pObj;
+    int iVar, iFan0, iFan1, Lit0, Lit1;
+    if ( Vec_IntEntry(p->vSatLits, iObj) >= 0 )
+        return Vec_IntEntry(p->vSatLits, iObj);
+    // derive the CNF of the cone in the topological order without recursion
+    Vec_IntClear( p->vStack );
+    Vec_IntPush( p->vStack, iObj );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        int iCur = Vec_IntEntryLast( p->vStack );
+        if ( Vec_IntEntry(p->vSatLits, iCur) >= 0 )
+        {
+            Vec_IntPop( p->vStack );
+            continue;
+        }
+        pObj = Gia_ManObj( p->pAig, iCur );
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            iFan0 = Cec4_WinFaninId( p, Gia_ObjFaninId0(pObj, iCur) );
+            iFan1 = Cec4_WinFaninId( p, Gia_ObjFaninId1(pObj, iCur) );
+            if ( Vec_IntEntry(p->vSatLits, iFan0) < 0 )
+                Vec_IntPush( p->vStack, iFan0 );
+            if ( Vec_IntEntry(p->vSatLits, iFan1) < 0 )
+                Vec_IntPush( p->vStack, iFan1 );
+            if ( Vec_IntEntry(p->vSatLits, iFan0) < 0 || Vec_IntEntry(p->vSatLits, iFan1) < 0 )
+                continue;
+        }
+        Vec_IntPop( p->vStack );
+        Vec_IntPush( p->vUsed, iCur );
+        Lit0 = Lit1 = -1;
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            Lit0 = Cec4_WinFaninLit( p, Gia_ObjFaninId0(pObj, iCur), Gia_ObjFaninC0(pObj) );
+            Lit1 = Cec4_WinFaninLit( p, Gia_ObjFaninId1(pObj, iCur), Gia_ObjFaninC1(pObj) );
+            // the fanins may be merged by the speculative reduction
+            if ( Abc_Lit2Var(Lit0) == Abc_Lit2Var(Lit1) )
+            {
+                int LitConst0 = Vec_IntEntry( p->vSatLits, 0 );
+                if ( Gia_ObjIsXor(pObj) )
+                    Vec_IntWriteEntry( p->vSatLits, iCur, Abc_LitNotCond(LitConst0, Lit0 != Lit1) );
+                else
+                    Vec_IntWriteEntry( p->vSatLits, iCur, Lit0 == Lit1 ? Lit0 : LitConst0 );
+                continue;
+            }
+        }
+        iVar = sat_solver_addvar( p->pSat );
+        Vec_IntWriteEntry( p->vSatLits, iCur, Abc_Var2Lit(iVar, 0) );
+        Vec_IntPush( p->vVarObjs, iCur );
+        if ( iCur == 0 )
+        {
+            int LitConst0 = Abc_Var2Lit( iVar, 1 );
+            sat_solver_addclause( p->pSat, &LitConst0, 1 );
+        }
+        else if ( Gia_ObjIsAnd(pObj) )
+        {
+            assert( Lit0 >= 0 && Lit1 >= 0 );
+            if ( p->jType < 2 )
+            {
+                if ( Gia_ObjIsXor(pObj) )
+                    sat_solver_add_xor( p->pSat, iVar, Abc_Lit2Var(Lit0), Abc_Lit2Var(Lit1), Abc_LitIsCompl(Lit0) ^ Abc_LitIsCompl(Lit1) );
+                else
+                    sat_solver_add_and( p->pSat, iVar, Abc_Lit2Var(Lit0), Abc_Lit2Var(Lit1), Abc_LitIsCompl(Lit0), Abc_LitIsCompl(Lit1), 0 );
+            }
+            if ( p->jType > 0 )
+            {
+                if ( (Lit0 > Lit1) ^ Gia_ObjIsXor(pObj) )
+                     Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+                sat_solver_set_var_fanin_lit( p->pSat, iVar, Lit0, Lit1 );
+            }
+        }
+        else
+            assert( Gia_ObjIsCi(pObj) );
+    }
+    return Vec_IntEntry(p->vSatLits, iObj);
+}
+int Cec4_WinSolve( void * pArg )
+{
+    Cec4_Win_t * p = (Cec4_Win_t *)pArg;
+    int i, k, iRepr, iObj, iCi, Lit0, Lit1, fPhase, status, Lits[2];
+    p->pSat = sat_solver_start();
+    sat_solver_set_jftr( p->pSat, p->jType );
+    Vec_IntClear( p->vVarObjs );
+    Cec4_WinObjGetCnfLit( p, 0 );
+    Vec_IntForEachEntryDouble( p->vPairs, iRepr, iObj, i )
+    {
+        if ( p->nSat >= p->nCexMax )
+            break;
+        fPhase = Gia_ManObj(p->pAig, iRepr)->fPhase ^ Gia_ManObj(p->pAig, iObj)->fPhase;
+        Lit0   = Cec4_WinObjGetCnfLit( p, iRepr );
+        Lit1   = Abc_LitNotCond( Cec4_WinObjGetCnfLit(p, iObj), fPhase );
+        if ( Lit0 == Lit1 )
+            status = GLUCOSE_UNSAT;
+        else
+        {
+            if ( p->jType > 0 )
+            {
+                sat_solver_start_new_round( p->pSat );
+                sat_solver_mark_cone( p->pSat, Abc_Lit2Var(Lit0) );
+                sat_solver_mark_cone( p->pSat, Abc_Lit2Var(Lit1) );
+            }
+            // check that the nodes cannot be different
+            Lits[0] = Abc_LitNot( Lit0 );
+            Lits[1] = Lit1;
+            sat_solver_set_conflict_budget( p->pSat, p->nBTLimit );
+            status = sat_solver_solve( p->pSat, Lits, 2 );
+            if ( status == GLUCOSE_UNSAT && iRepr > 0 )
+            {
+                Lits[0] = Lit0;
+                Lits[1] = Abc_LitNot( Lit1 );
+                sat_solver_set_conflict_budget( p->pSat, p->nBTLimit );
+                status = sat_solver_solve( p->pSat, Lits, 2 );
+            }
+        }
+        if ( status == GLUCOSE_UNSAT )
+        {
+            Vec_IntWriteEntry( p->vStatus, i/2, 1 );
+            p->nUnsat++;
+        }
+        else if ( status == GLUCOSE_SAT )
+        {
+            int iCex = Vec_IntSize( p->vCexes );
+            Vec_IntPush( p->vCexes, 0 );
+            if ( p->jType == 0 )
+            {
+                Vec_IntForEachEntry( p->vUsed, iCi, k )
+                    if ( Gia_ObjIsCi(Gia_ManObj(p->pAig, iCi)) )
+                        Vec_IntPush( p->vCexes, Abc_Var2Lit(iCi, sat_solver_read_cex_varvalue(p->pSat, Abc_Lit2Var(Vec_IntEntry(p->vSatLits, iCi)))) );
+            }
+            else
+            {
+                int * pCex = sat_solver_read_cex( p->pSat );
+                for ( k = 1; k <= pCex[0]; k++ )
+                {
+                    iCi = Vec_IntEntry( p->vVarObjs, Abc_Lit2Var(pCex[k]) );
+                    if ( Gia_ObjIsCi(Gia_ManObj(p->pAig, iCi)) )
+                        Vec_IntPush( p->vCexes, Abc_Var2Lit(iCi, !Abc_LitIsCompl(pCex[k])) );
+                }
+            }
+            Vec_IntWriteEntry( p->vCexes, iCex, Vec_IntSize(p->vCexes) - iCex - 1 );
+            Vec_IntWriteEntry( p->vStatus, i/2, 0 );
+            p->nSat++;
+        }
+        else
+        {
+            Vec_IntWriteEntry( p->vStatus, i/2, 2 );
+            p->nUndec++;
+        }
+    }
+    sat_solver_stop( p->pSat );
+    p->pSat = NULL;
+    return 1;
+}
+void Cec4_ManSweepPartitioned( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    Cec_ParFra_t * pPars = pMan->pPars;
+    int nWins = Abc_MinInt( pPars->nProcs, 100 );
+    Cec4_Win_t * pWins = ABC_CALLOC( Cec4_Win_t, nWins ), * pWin;
+    Vec_Ptr_t * vData  = Vec_PtrAlloc( nWins );
+    Vec_Int_t * vCands = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vStatus = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Vec_Bit_t * vSpec  = Vec_BitStart( Gia_ManObjNum(p) );
+    Vec_Bit_t * vTaint = Vec_BitStart( Gia_ManObjNum(p) );
+    Vec_Int_t * vPat   = Vec_IntAlloc( 100 );
+    Gia_Obj_t * pObj;
+    int i, k, w, r, iObj, nLits, nCands, nProved, nFailed, nCexes, fTaint;
+    abctime clk = Abc_Clock();
+    for ( w = 0; w < nWins; w++ )
+    {
+        pWin = pWins + w;
+        pWin->pAig     = p;
+        pWin->vSpec    = vSpec;
+        pWin->vPairs   = Vec_IntAlloc( 1000 );
+        pWin->vStatus  = Vec_IntAlloc( 1000 );
+        pWin->vCexes   = Vec_IntAlloc( 1000 );
+        pWin->vSatLits = Vec_IntStartFull( Gia_ManObjNum(p) );
+        pWin->vUsed    = Vec_IntAlloc( 1000 );
+        pWin->vVarObjs = Vec_IntAlloc( 1000 );
+        pWin->vStack   = Vec_IntAlloc( 1000 );
+        pWin->jType    = pPars->jType;
+        pWin->nBTLimit = pPars->nBTLimit;
+        pWin->nCexMax  = Abc_MaxInt( 1, (64 * p->nSimWords - 2) / nWins );
+    }
+    for ( r = 0; r < pPars->nItersMax; r++ )
+    {
+        // collect the candidates in the topological order
+        Vec_IntClear( vCands );
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            Vec_BitWriteEntry( vSpec, i, 0 );
+            if ( !Gia_ObjHasRepr(p, i) || Gia_ObjFailed(p, i) )
+                continue;
+            if ( Gia_ObjProved(p, i) )
+            {
+                Vec_BitWriteEntry( vSpec, i, 1 );
+                continue;
+            }
+            if ( pPars->nLevelMax && Gia_ObjLevel(p, pObj) > pPars->nLevelMax )
+                continue;
+            Vec_BitWriteEntry( vSpec, i, 1 );
+            Vec_IntPushTwo( vCands, Gia_ObjRepr(p, i), i );
+        }
+        // leave a few remaining candidates to the serial sweeping
+        nCands = Vec_IntSize(vCands) / 2;
+        if ( nCands < 16 * nWins )
+            break;
+        // divide them into windows
+        Vec_PtrClear( vData );
+        for ( w = 0; w < nWins; w++ )
+        {
+            int iStart = (int)((word)nCands * w / nWins);
+            int iStop  = (int)((word)nCands * (w+1) / nWins);
+            pWin = pWins + w;
+            Vec_IntClear( pWin->vPairs );
+            for ( k = iStart; k < iStop; k++ )
+                Vec_IntPushTwo( pWin->vPairs, Vec_IntEntry(vCands, 2*k), Vec_IntEntry(vCands, 2*k+1) );
+            Vec_IntFill( pWin->vStatus, iStop - iStart, -1 );
+            Vec_IntClear( pWin->vCexes );
+            Vec_IntForEachEntry( pWin->vUsed, iObj, k )
+                Vec_IntWriteEntry( pWin->vSatLits, iObj, -1 );
+            Vec_IntClear( pWin->vUsed );
+            pWin->nSat = pWin->nUnsat = pWin->nUndec = 0;
+            if ( iStart < iStop )
+                Vec_PtrPush( vData, pWin );
+        }
+        Util_ProcessThreads( Cec4_WinSolve, vData, Vec_PtrSize(vData) + 1, 0, 0 );
+        // collect the results
+        Vec_PtrForEachEntry( Cec4_Win_t *, vData, pWin, w )
+        {
+            Vec_IntForEachEntry( pWin->vStatus, k, i )
+                Vec_IntWriteEntry( vStatus, Vec_IntEntry(pWin->vPairs, 2*i+1), k );
+            pMan->nSatUnsat += pWin->nUnsat;
+            pMan->nSatSat   += pWin->nSat;
+            pMan->nSatUndec += pWin->nUndec;
+        }
+        // accept the results whose speculative cones are proved
+        nProved = nFailed = nCexes = 0;
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            if ( Vec_BitEntry(vSpec, i) && Gia_ObjProved(p, i) )
+            {
+                Vec_BitWriteEntry( vTaint, i, Vec_BitEntry(vTaint, Gia_ObjRepr(p, i)) );
+                continue;
+            }
+            fTaint = Vec_BitEntry(vTaint, Gia_ObjFaninId0(pObj, i)) || Vec_BitEntry(vTaint, Gia_ObjFaninId1(pObj, i));
+            if ( Vec_BitEntry(vSpec, i) )
+            {
+                fTaint |= Vec_BitEntry(vTaint, Gia_ObjRepr(p, i));
+                if ( !fTaint && Vec_IntEntry(vStatus, i) == 1 )
+                    Gia_ObjSetProved( p, i ), nProved++;
+                else if ( !fTaint && Vec_IntEntry(vStatus, i) == 2 )
+                    Gia_ObjSetFailed( p, i ), nFailed++;
+                fTaint = !Gia_ObjProved( p, i );
+                Vec_IntWriteEntry( vStatus, i, -1 );
+            }
+            Vec_BitWriteEntry( vTaint, i, fTaint );
+        }
+        // simulate the counter-examples of all windows
+        Vec_PtrForEachEntry( Cec4_Win_t *, vData, pWin, w )
+        {
+            for ( k = 0; k < Vec_IntSize(pWin->vCexes); k += nLits + 1 )
+            {
+                nLits = Vec_IntEntry( pWin->vCexes, k );
+                Vec_IntClear( vPat );
+                for ( i = 0; i < nLits; i++ )
+                    Vec_IntPush( vPat, Vec_IntEntry(pWin->vCexes, k+1+i) );
+                Cec4_ManSavePattern( pMan, vPat );
+                Cec4_ManResimulatePatterns( pMan );
+                pMan->nPatterns++;
+                nCexes++;
+            }
+        }
+        if ( p->iPatsPi > 0 )
+        {
+            abctime clk2 = Abc_Clock();
+            Cec4_ManSimulate( p, pMan );
+            p->iPatsPi = 0;
+            Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+            Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+            pMan->timeResimGlo += Abc_Clock() - clk2;
+        }
+        if ( pPars->fVerbose )
+        {
+            printf( "Round %3d : Cands =%8d  Wins =%3d  Proved =%8d  Failed =%6d  Cexes =%6d  ", 
+                r, nCands, Vec_PtrSize(vData), nProved, nFailed, nCexes );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        // stop when the speculative reduction is not effective
+        if ( 10 * (nProved + nFailed) < nCands )
+            break;
+    }
+    for ( w = 0; w < nWins; w++ )
+    {
+        pWin = pWins + w;
+        Vec_IntFree( pWin->vPairs );
+        Vec_IntFree( pWin->vStatus );
+        Vec_IntFree( pWin->vCexes );
+        Vec_IntFree( pWin->vSatLits );
+        Vec_IntFree( pWin->vUsed );
+        Vec_IntFree( pWin->vVarObjs );
+        Vec_IntFree( pWin->vStack );
+    }
+    ABC_FREE( pWins );
+    Vec_PtrFree( vData );
+    Vec_IntFree( vCands );
+    Vec_IntFree( vStatus );
+    Vec_BitFree( vSpec );
+    Vec_BitFree( vTaint );
+    Vec_IntFree( vPat );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the representative using recent counter-examples.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 Gia_Obj_t * Cec4_ManFindRepr( Gia_Man_t * p, Cec4_Man_t * pMan, int iObj )
 {
     abctime clk = Abc_Clock();
@@ -1863,7 +2263,7 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
 
     Cec4_Man_t * pMan = Cec4_ManCreate( p, pPars ); 
     Gia_Obj_t * pObj, * pRepr; 
-    int i, fSimulate = 1, Id;
+    int i, fSimulate = 1, fStopped = 0, Id;
     if ( pPars->fVerbose )
         printf( "Solver type = %d. Simulate %d words in %d rounds. SAT with %d confs. Recycle after %d SAT calls.\n", 
             pPars->jType, pPars->nWords, pPars->nRounds, pPars->nBTLimit, pPars->nCallsRecycle );
@@ -1945,6 +2345,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
+    if ( pPars->nProcs > 1 )
+        Cec4_ManSweepPartitioned( p, pMan );
     pMan->pNew = Cec4_ManStartNew( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -1967,6 +2369,17 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         pRepr = Gia_ObjReprObj( p, i );
         if ( pRepr == NULL )
             continue;
+        if ( Gia_ObjProved(p, i) ) // proved by partitioned sweeping
+        {
+            if ( pPars->fBMiterInfo )
+                Bnd_ManMerge( Gia_ObjId(p, pRepr), i, pObj->fPhase ^ pRepr->fPhase );
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            if ( Gia_ObjId(p, pRepr) == 0 )
+                pMan->iLastConst = i;
+            continue;
+        }
+        if ( Gia_ObjFailed(p, i) ) // undecided by partitioned sweeping
+            continue;
         if ( 1 ) // select representative based on recent counter-examples
         {
             pRepr = Cec4_ManFindRepr( p, pMan, i );
@@ -1989,6 +2402,9 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
                 pMan->iLastConst = i;
             continue;
         }
+        // skip the remaining SAT calls if the current task is cancelled
+        if ( fStopped || (fStopped = Util_TaskStop()) )
+            continue;
         if ( Cec4_ManSweepNode(pMan, i, Gia_ObjId(p, pRepr)) && Gia_ObjProved(p, i) )
         {
             if (pPars->fBMiterInfo){
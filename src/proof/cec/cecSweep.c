@@ -52,6 +52,8 @@ Gia_Man_t * Cec_ManFraSpecReduction( Cec_ManFra_t * p )
     Vec_IntClear( p->vXorNodes );
     if ( p->pPars->nLevelMax )
         Gia_ManLevelNum( p->pAig );
+    if ( p->pPrf )
+        Cec_ManPrfHashCones( p->pPrf, p->pAig );
     pNew = Gia_ManStart( Gia_ManObjNum(p->pAig) );
     pNew->pName = Abc_UtilStrsav( p->pAig->pName );
     pNew->pSpec = Abc_UtilStrsav( p->pAig->pName );
@@ -107,6 +109,12 @@ Gia_Man_t * Cec_ManFraSpecReduction( Cec_ManFra_t * p )
         piCopies[i] = Abc_LitNotCond( iRepr, fCompl );
         if ( Gia_ObjProved(p->pAig, i) )
             continue;
+        // skip the pair proved by the previous runs
+        if ( p->pPrf && Cec_ManPrfLookup( p->pPrf, p->pAig, Gia_ObjRepr(p->pAig, i), i ) )
+        {
+            Gia_ObjSetProved( p->pAig, i );
+            continue;
+        }
         // produce speculative miter
         iMiter = Gia_ManHashXor( pNew, iNode, piCopies[i] );
         Gia_ManAppendCo( pNew, iMiter );
@@ -50,9 +50,12 @@ struct Pdr_Par_t_
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
     int nRandomSeed;      // value to seed the SAT solver with
+    int nSolverType;      // SAT solver used for the timeframes (0 = bsat, 1 = satoko, 2 = cadical)
+    int nThreads;         // the number of concurrent workers sharing the lemmas
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fNewXSim;         // updated X-valued simulation
+    int fWordXSim;        // word-parallel X-valued simulation
     int fFlopPrio;        // use structural flop priorities
     int fFlopOrder;       // order flops for 'analyze_final' during generalization
     int fDumpInv;         // dump inductive invariant
@@ -77,20 +77,20 @@ static inline int Pdr_ObjSatVar2FindOrAdd( Pdr_Man_t * p, int k, Aig_Obj_t * pOb
         Vec_IntGrow(vId2Vars, 2 * k + 1);
     if ( Vec_IntGetEntry(vId2Vars, k) == 0 )
     {
-        sat_solver * pSat = Pdr_ManSolver(p, k);
+        void * pSat = Pdr_ManSolver(p, k);
         Vec_Int_t * vVar2Ids = (Vec_Int_t *)Vec_PtrEntry(&p->vVar2Ids, k);
         int iVarNew = Vec_IntSize( vVar2Ids );
         assert( iVarNew > 0 );
         Vec_IntPush( vVar2Ids, Aig_ObjId(pObj) );
         Vec_IntWriteEntry( vId2Vars, k, iVarNew << 2 );
-        sat_solver_setnvars( pSat, iVarNew + 1 );
+        Pdr_ManSatSetNVars( p, pSat, iVarNew + 1 );
         if ( k == 0 && Saig_ObjIsLo(p->pAig, pObj) ) // initialize the register output
         {
             int Lit = Abc_Var2Lit( iVarNew, 1 );
-            int RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+            int RetValue = Pdr_ManSatAddClause( p, pSat, &Lit, &Lit + 1 );
             assert( RetValue == 1 );
             (void) RetValue;
-            sat_solver_compress( pSat );
+            Pdr_ManSatCompress( p, pSat );
         }
     }
     return Vec_IntEntry( vId2Vars, k );
@@ -98,7 +98,7 @@ static inline int Pdr_ObjSatVar2FindOrAdd( Pdr_Man_t * p, int k, Aig_Obj_t * pOb
 int Pdr_ObjSatVar2( Pdr_Man_t * p, int k, Aig_Obj_t * pObj, int Level, int Pol )
 {
     Vec_Int_t * vLits;
-    sat_solver * pSat;
+    void * pSat;
     Vec_Int_t * vVar2Ids = (Vec_Int_t *)Vec_PtrEntry(&p->vVar2Ids, k);
     int nVarCount = Vec_IntSize(vVar2Ids);
     int iVarThis  = Pdr_ObjSatVar2FindOrAdd( p, k, pObj );
@@ -142,7 +142,7 @@ int Pdr_ObjSatVar2( Pdr_Man_t * p, int k, Aig_Obj_t * pObj, int Level, int Pol )
                     iVar = Pdr_ObjSatVar2( p, k, Aig_ManObj(p->pAig, Abc_Lit2Var(*pLit)), Level+1, 3 );
                     Vec_IntPush( vLits, Abc_Var2Lit( iVar, Abc_LitIsCompl(*pLit) ) );
                 }
-                RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits)+Vec_IntSize(vLits) );
+                RetValue = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits)+Vec_IntSize(vLits) );
                 assert( RetValue );
                 (void) RetValue;
             }
@@ -160,7 +160,7 @@ int Pdr_ObjSatVar2( Pdr_Man_t * p, int k, Aig_Obj_t * pObj, int Level, int Pol )
                     iVar = Pdr_ObjSatVar2( p, k, Aig_ManObj(p->pAig, Abc_Lit2Var(*pLit)), Level+1, ((unsigned)p->pCnf2->pClaPols[i] >> (2*(pLit-p->pCnf2->pClauses[i]-1))) & 3 );
                     Vec_IntPush( vLits, Abc_Var2Lit( iVar, Abc_LitIsCompl(*pLit) ) );
                 }
-                RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits)+Vec_IntSize(vLits) );
+                RetValue = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits)+Vec_IntSize(vLits) );
                 assert( RetValue );
                 (void) RetValue;
             }
@@ -178,20 +178,20 @@ static inline int Pdr_ObjSatVar2FindOrAdd( Pdr_Man_t * p, int k, Aig_Obj_t * pOb
         Vec_IntGrow(vId2Vars, 2 * k + 1);
     if ( Vec_IntGetEntry(vId2Vars, k) == 0 )
     {
-        sat_solver * pSat = Pdr_ManSolver(p, k);
+        void * pSat = Pdr_ManSolver(p, k);
         Vec_Int_t * vVar2Ids = (Vec_Int_t *)Vec_PtrEntry(&p->vVar2Ids, k);
         int iVarNew = Vec_IntSize( vVar2Ids );
         assert( iVarNew > 0 );
         Vec_IntPush( vVar2Ids, Aig_ObjId(pObj) );
         Vec_IntWriteEntry( vId2Vars, k, iVarNew );
-        sat_solver_setnvars( pSat, iVarNew + 1 );
+        Pdr_ManSatSetNVars( p, pSat, iVarNew + 1 );
         if ( k == 0 && Saig_ObjIsLo(p->pAig, pObj) ) // initialize the register output
         {
             int Lit = Abc_Var2Lit( iVarNew, 1 );
-            int RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+            int RetValue = Pdr_ManSatAddClause( p, pSat, &Lit, &Lit + 1 );
             assert( RetValue == 1 );
             (void) RetValue;
-            sat_solver_compress( pSat );
+            Pdr_ManSatCompress( p, pSat );
         }
         *pfNewVar = 1;
     }
@@ -200,7 +200,7 @@ static inline int Pdr_ObjSatVar2FindOrAdd( Pdr_Man_t * p, int k, Aig_Obj_t * pOb
 int Pdr_ObjSatVar2( Pdr_Man_t * p, int k, Aig_Obj_t * pObj, int Level, int Pol )
 {
     Vec_Int_t * vLits;
-    sat_solver * pSat;
+    void * pSat;
     int fNewVar = 0, iVarThis  = Pdr_ObjSatVar2FindOrAdd( p, k, pObj, &fNewVar );
     int * pLit, i, iVar, iClaBeg, iClaEnd, RetValue;
     if ( Aig_ObjIsCi(pObj) || !fNewVar )
@@ -219,7 +219,7 @@ int Pdr_ObjSatVar2( Pdr_Man_t * p, int k, Aig_Obj_t * pObj, int Level, int Pol )
             iVar = Pdr_ObjSatVar2( p, k, Aig_ManObj(p->pAig, Abc_Lit2Var(*pLit)), Level+1, Pol );
             Vec_IntPush( vLits, Abc_Var2Lit( iVar, Abc_LitIsCompl(*pLit) ) );
         }
-        RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits)+Vec_IntSize(vLits) );
+        RetValue = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits)+Vec_IntSize(vLits) );
         assert( RetValue );
         (void) RetValue;
     }
@@ -332,7 +332,7 @@ int Pdr_ObjRegNum( Pdr_Man_t * p, int k, int iSatVar )
 int Pdr_ManFreeVar( Pdr_Man_t * p, int k )
 {
     if ( p->pPars->fMonoCnf )
-        return sat_solver_nvars( Pdr_ManSolver(p, k) );
+        return Pdr_ManSatNVars( p, Pdr_ManSolver(p, k) );
     else
     {
         Vec_Int_t * vVar2Ids = (Vec_Int_t *)Vec_PtrEntry( &p->vVar2Ids, k );
@@ -341,6 +341,34 @@ int Pdr_ManFreeVar( Pdr_Man_t * p, int k )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Sets the global runtime limit and the stop function.]
+
+  Description [CaDiCaL checks them in the termination callback installed
+  by Pdr_ManSatAlloc().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Pdr_ManSatSetLimits( Pdr_Man_t * p, void * pSat )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+    {
+        satoko_set_runtime_limit( (satoko_t *)pSat, p->timeToStop );
+        satoko_set_runid( (satoko_t *)pSat, p->pPars->RunId );
+        satoko_set_stop_func( (satoko_t *)pSat, p->pPars->pFuncStop );
+    }
+    else if ( p->pPars->nSolverType == PDR_SAT_BSAT )
+    {
+        sat_solver_set_runtime_limit( (sat_solver *)pSat, p->timeToStop );
+        sat_solver_set_runid( (sat_solver *)pSat, p->pPars->RunId );
+        sat_solver_set_stop_func( (sat_solver *)pSat, p->pPars->pFuncStop );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates SAT solver.]
@@ -352,7 +380,7 @@ int Pdr_ManFreeVar( Pdr_Man_t * p, int k )
   SeeAlso     []
 
 ***********************************************************************/
-static inline sat_solver * Pdr_ManNewSolver1( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit )
+static inline void * Pdr_ManNewSolver1( void * pSat, Pdr_Man_t * p, int k, int fInit )
 {
     Aig_Obj_t * pObj;
     int i;
@@ -368,10 +396,24 @@ static inline sat_solver * Pdr_ManNewSolver1( sat_solver * pSat, Pdr_Man_t * p,
         Saig_ManForEachLi( p->pAig, pObj, i )
             Vec_IntWriteEntry( p->vVar2Reg, Pdr_ObjSatVar(p, k, 3, pObj), i );
     }
-    pSat = (sat_solver *)Cnf_DataWriteIntoSolverInt( pSat, p->pCnf1, 1, fInit );
-    sat_solver_set_runtime_limit( pSat, p->timeToStop );
-    sat_solver_set_runid( pSat, p->pPars->RunId );
-    sat_solver_set_stop_func( pSat, p->pPars->pFuncStop );
+    if ( p->pPars->nSolverType == PDR_SAT_BSAT )
+        pSat = Cnf_DataWriteIntoSolverInt( pSat, p->pCnf1, 1, fInit );
+    else
+    {
+        int Lit;
+        Pdr_ManSatSetNVars( p, pSat, p->pCnf1->nVars );
+        for ( i = 0; i < p->pCnf1->nClauses; i++ )
+            if ( !Pdr_ManSatAddClause( p, pSat, p->pCnf1->pClauses[i], p->pCnf1->pClauses[i+1] ) )
+                assert( 0 );
+        if ( fInit )
+            Aig_ManForEachLoSeq( p->pAig, pObj, i )
+            {
+                Lit = toLitCond( p->pCnf1->pVarNums[pObj->Id], 1 );
+                if ( !Pdr_ManSatAddClause( p, pSat, &Lit, &Lit + 1 ) )
+                    assert( 0 );
+            }
+    }
+    Pdr_ManSatSetLimits( p, pSat );
     return pSat;
 }
 
@@ -386,7 +428,7 @@ static inline sat_solver * Pdr_ManNewSolver1( sat_solver * pSat, Pdr_Man_t * p,
   SeeAlso     []
 
 ***********************************************************************/
-static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit )
+static inline void * Pdr_ManNewSolver2( void * pSat, Pdr_Man_t * p, int k, int fInit )
 {
     Vec_Int_t * vVar2Ids;
     int i, Entry;
@@ -418,10 +460,8 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
     Vec_IntPush( vVar2Ids, -1 );
     // start the SAT solver
 //    pSat = sat_solver_new();
-    sat_solver_setnvars( pSat, 500 );
-    sat_solver_set_runtime_limit( pSat, p->timeToStop );
-    sat_solver_set_runid( pSat, p->pPars->RunId );
-    sat_solver_set_stop_func( pSat, p->pPars->pFuncStop );
+    Pdr_ManSatSetNVars( p, pSat, 500 );
+    Pdr_ManSatSetLimits( p, pSat );
     return pSat;
 }
 
@@ -436,7 +476,7 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
   SeeAlso     []
 
 ***********************************************************************/
-sat_solver * Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit )
+void * Pdr_ManNewSolver( void * pSat, Pdr_Man_t * p, int k, int fInit )
 {
     assert( pSat != NULL );
     if ( p->pPars->fMonoCnf )
@@ -59,9 +59,12 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nSolverType    =       0;  // SAT solver used for the timeframes (0 = bsat)
+    pPars->nThreads       =       1;  // the number of concurrent workers
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
+    pPars->fWordXSim      =       0;  // word-parallel X-valued simulation
     pPars->fFlopPrio      =       0;  // use structural flop priorities
     pPars->fFlopOrder     =       0;  // order flops for 'analyze_final' during generalization
     pPars->fDumpInv       =       0;  // dump inductive invariant
@@ -102,7 +105,7 @@ Pdr_Set_t * Pdr_ManReduceClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     Vec_Int_t * vLits;
     int i, Entry, nCoreLits, * pCoreLits;
     // get relevant SAT literals
-    nCoreLits = sat_solver_final(Pdr_ManSolver(p, k), &pCoreLits);
+    nCoreLits = Pdr_ManSatFinal(p, Pdr_ManSolver(p, k), &pCoreLits);
     // translate them into register literals and remove auxiliary
     vLits = Pdr_ManLitsToCube( p, k, pCoreLits, nCoreLits );
     // skip if there is no improvement
@@ -209,6 +212,8 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
             }
             // add the last clause
             Vec_PtrPush( vArrayK1, pCubeK );
+            if ( p->pPool && k+1 == kMax )
+                Pdr_ManPoolExport( p, k+1, pCubeK );
             Vec_PtrWriteEntry( vArrayK, j, Vec_PtrEntryLast(vArrayK) );
             Vec_PtrPop(vArrayK);
             j--;
@@ -342,6 +347,8 @@ int Pdr_ManPushAndBlockClauses( Pdr_Man_t * p )
             }
             // add the last clause
             Vec_PtrPush( vArrayK1, pCubeK );
+            if ( p->pPool && k+1 == kMax )
+                Pdr_ManPoolExport( p, k+1, pCubeK );
             Vec_PtrWriteEntry( vArrayK, j, Vec_PtrEntryLast(vArrayK) );
             Vec_PtrPop(vArrayK);
             j--;
@@ -1094,11 +1101,11 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
         // assume the unminimized cube
         if ( p->pPars->fSimpleGeneral )
         {
-            sat_solver *  pSat = Pdr_ManFetchSolver( p, k );
+            void *  pSat = Pdr_ManFetchSolver( p, k );
             Vec_Int_t * vLits1 = Pdr_ManCubeToLits( p, k, pCubeMin, 1, 0 );
-            int RetValue1 = sat_solver_addclause( pSat, Vec_IntArray(vLits1), Vec_IntArray(vLits1) + Vec_IntSize(vLits1) );
+            int RetValue1 = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits1), Vec_IntArray(vLits1) + Vec_IntSize(vLits1) );
             assert( RetValue1 == 1 );
-            sat_solver_compress( pSat );
+            Pdr_ManSatCompress( p, pSat );
         }
 
         // sort literals by their occurences
@@ -1176,11 +1183,11 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
             // assume the minimized cube
             if ( p->pPars->fSimpleGeneral )
             {
-                sat_solver *  pSat = Pdr_ManFetchSolver( p, k );
+                void *  pSat = Pdr_ManFetchSolver( p, k );
                 Vec_Int_t * vLits1 = Pdr_ManCubeToLits( p, k, pCubeMin, 1, 0 );
-                int RetValue1 = sat_solver_addclause( pSat, Vec_IntArray(vLits1), Vec_IntArray(vLits1) + Vec_IntSize(vLits1) );
+                int RetValue1 = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits1), Vec_IntArray(vLits1) + Vec_IntSize(vLits1) );
                 assert( RetValue1 == 1 );
-                sat_solver_compress( pSat );
+                Pdr_ManSatCompress( p, pSat );
             }
 
             // get the ordering by decreasing priority
@@ -1278,6 +1285,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         assert( pThis->iFrame > 0 );
         assert( !Pdr_SetIsInit(pThis->pState, -1) );
         p->iUseFrame = Abc_MinInt( p->iUseFrame, pThis->iFrame );
+        if ( p->pPool )
+            Pdr_ManPoolImport( p );
         clk = Abc_Clock();
         if ( Pdr_ManCheckContainment( p, pThis->iFrame, pThis->pState ) )
         {
@@ -1347,6 +1356,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            if ( p->pPool )
+                Pdr_ManPoolExport( p, k, pCubeMin );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
             {
@@ -1372,6 +1383,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( Util_TaskStop() )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -1661,6 +1674,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 return -1;
             }
         }
+        if ( p->pPool )
+            Pdr_ManPoolImport( p );
         RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
@@ -1706,7 +1721,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
 
         // check termination
-        if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+        if ( (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) || Util_TaskStop() )
         {
             p->pPars->iFrame = iFrame;
             return -1;
@@ -1766,6 +1781,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 ***********************************************************************/
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
+    Aig_Man_t * pAigUsed;
     Pdr_Man_t * p;
     int k, RetValue;
     abctime clk = Abc_Clock();
@@ -1787,8 +1803,14 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
-    p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->nThreads > 1 && !pPars->fSolveAll && !pPars->fUseAbs )
+        p = Pdr_ManSolvePar( pAig, pPars, &RetValue );
+    else
+    {
+        p = Pdr_ManStart( pAig, pPars, NULL );
+        RetValue = Pdr_ManSolveInt( p );
+    }
+    pAigUsed = p->pAig;
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -1808,6 +1830,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
     p->tTotal += Abc_Clock() - clk;
     Pdr_ManStop( p );
+    if ( pAigUsed != pAig ) // the copy solved by a concurrent worker
+        Aig_ManStop( pAigUsed );
     pPars->iFrame--;
     // convert all -2 (unknown) entries into -1 (undec)
     if ( pPars->vOutMap )
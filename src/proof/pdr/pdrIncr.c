@@ -222,9 +222,10 @@ sat_solver * IPdr_ManSetSolver( Pdr_Man_t * p, int k, int fSetPropOutput )
 
     assert( Vec_PtrSize(p->vSolvers) == k );
     assert( Vec_IntSize(p->vActVars) == k );
+    assert( p->pPars->nSolverType == PDR_SAT_BSAT );
 
     pSat = zsat_solver_new_seed(p->pPars->nRandomSeed);
-    pSat = Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
+    pSat = (sat_solver *)Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
     Vec_PtrPush( p->vSolvers, pSat );
     Vec_IntPush( p->vActVars, 0 );
 
@@ -892,7 +893,7 @@ int IPdr_ManCheckCubeReduce( Pdr_Man_t * p, Vec_Ptr_t * vClauses, Pdr_Set_t * pC
     int iActVar = 0;
     abctime clk = Abc_Clock();
 
-    pSat = Pdr_ManSolver( p, 1 );
+    pSat = (sat_solver *)Pdr_ManSolver( p, 1 );
 
     if ( pCube == NULL ) // solve the property
     {
@@ -34,10 +34,10 @@
 
 //#define PDR_USE_SATOKO 1
 
+#include "sat/satoko/satoko.h"
 #ifndef PDR_USE_SATOKO
     #include "sat/bsat/satSolver.h"
 #else
-    #include "sat/satoko/satoko.h"
     #define l_Undef  0
     #define l_True   1
     #define l_False -1
@@ -57,12 +57,18 @@
     #define sat_solver_set_stop_func         satoko_set_stop_func          
     #define sat_solver_compress(s)             
 #endif
+#include "sat/cadical/cadicalSolver.h"
 
 ABC_NAMESPACE_HEADER_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
+
+// SAT solvers used for the timeframes
+#define PDR_SAT_BSAT     0
+#define PDR_SAT_SATOKO   1
+#define PDR_SAT_CADICAL  2
              
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -70,6 +76,8 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Txs_Man_t_  Txs_Man_t;
 typedef struct Txs3_Man_t_ Txs3_Man_t;
+typedef struct Txs4_Man_t_ Txs4_Man_t;
+typedef struct Pdr_Pool_t_ Pdr_Pool_t;
 
 typedef struct Pdr_Set_t_ Pdr_Set_t;
 struct Pdr_Set_t_
@@ -126,6 +134,13 @@ struct Pdr_Man_t_
     int         nCexesTotal;
     // terminary simulation
     Txs3_Man_t * pTxs3;      
+    Txs4_Man_t * pTxs4;      
+    // concurrent solving
+    Pdr_Pool_t * pPool;    // lemmas shared by the workers
+    int         iWorker;   // the index of this worker
+    int         iPoolNext; // the first lemma in the pool not imported yet
+    int         nPoolIn;   // the number of imported lemmas
+    int         nPoolOut;  // the number of exported lemmas
     // internal use
     Vec_Int_t * vPrio;     // priority flops
     Vec_Int_t * vLits;     // array of literals
@@ -161,6 +176,7 @@ struct Pdr_Man_t_
     // runtime
     abctime     timeToStop;
     abctime     timeToStopOne;
+    abctime     timeToStopSat; // the runtime limit of the current SAT call
     // time stats
     abctime     tSat;
     abctime     tSatSat;
@@ -178,7 +194,7 @@ struct Pdr_Man_t_
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
 
-static inline sat_solver * Pdr_ManSolver( Pdr_Man_t * p, int k )  { return (sat_solver *)Vec_PtrEntry(p->vSolvers, k); }
+static inline void *       Pdr_ManSolver( Pdr_Man_t * p, int k )  { return Vec_PtrEntry(p->vSolvers, k); }
 
 static inline abctime      Pdr_ManTimeLimit( Pdr_Man_t * p )
 {
@@ -199,9 +215,10 @@ static inline abctime      Pdr_ManTimeLimit( Pdr_Man_t * p )
 extern int             Pdr_ObjSatVar( Pdr_Man_t * p, int k, int Pol, Aig_Obj_t * pObj );
 extern int             Pdr_ObjRegNum( Pdr_Man_t * p, int k, int iSatVar );
 extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
-extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
+extern void *          Pdr_ManNewSolver( void * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
@@ -216,9 +233,23 @@ extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_In
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern void            Pdr_ManPoolExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern void            Pdr_ManPoolImport( Pdr_Man_t * p );
+extern Pdr_Man_t *     Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue );
 /*=== pdrSat.c ==========================================================*/
-extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
-extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
+extern void *          Pdr_ManSatAlloc( Pdr_Man_t * p );
+extern void *          Pdr_ManSatRestart( Pdr_Man_t * p, void * pSat );
+extern void            Pdr_ManSatFree( Pdr_Man_t * p, void * pSat );
+extern int             Pdr_ManSatNVars( Pdr_Man_t * p, void * pSat );
+extern void            Pdr_ManSatSetNVars( Pdr_Man_t * p, void * pSat, int nVars );
+extern int             Pdr_ManSatAddClause( Pdr_Man_t * p, void * pSat, int * pBeg, int * pEnd );
+extern void            Pdr_ManSatCompress( Pdr_Man_t * p, void * pSat );
+extern int             Pdr_ManSatSolve( Pdr_Man_t * p, void * pSat, int * pBeg, int * pEnd, int nConfLimit, abctime TimeLimit );
+extern int             Pdr_ManSatFinal( Pdr_Man_t * p, void * pSat, int ** ppLits );
+extern int             Pdr_ManSatVarValue( Pdr_Man_t * p, void * pSat, int iVar );
+extern void *          Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
+extern void *          Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
 extern void            Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k );
 extern Vec_Int_t *     Pdr_ManCubeToLits( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, int fCompl, int fNext );
 extern Vec_Int_t *     Pdr_ManLitsToCube( Pdr_Man_t * p, int k, int * pArray, int nArray );
@@ -236,6 +267,10 @@ extern Pdr_Set_t *     Txs_ManTernarySim( Txs_Man_t * p, int k, Pdr_Set_t * pCub
 extern Txs3_Man_t *    Txs3_ManStart( Pdr_Man_t * pMan, Aig_Man_t * pAig, Vec_Int_t * vPrio );
 extern void            Txs3_ManStop( Txs3_Man_t * );
 extern Pdr_Set_t *     Txs3_ManTernarySim( Txs3_Man_t * p, int k, Pdr_Set_t * pCube );
+/*=== pdrTsim4.c ==========================================================*/
+extern Txs4_Man_t *    Txs4_ManStart( Pdr_Man_t * pMan, Aig_Man_t * pAig, Vec_Int_t * vPrio );
+extern void            Txs4_ManStop( Txs4_Man_t * );
+extern Pdr_Set_t *     Txs4_ManTernarySim( Txs4_Man_t * p, int k, Pdr_Set_t * pCube );
 /*=== pdrUtil.c ==========================================================*/
 extern Pdr_Set_t *     Pdr_SetAlloc( int nSize );
 extern Pdr_Set_t *     Pdr_SetCreate( Vec_Int_t * vLits, Vec_Int_t * vPiLits );
@@ -499,7 +499,7 @@ void Pdr_ManReportInvariant( Pdr_Man_t * p )
 ***********************************************************************/
 void Pdr_ManVerifyInvariant( Pdr_Man_t * p )
 {
-    sat_solver * pSat;
+    void * pSat;
     Vec_Int_t * vLits;
     Vec_Ptr_t * vCubes;
     Pdr_Set_t * pCube;
@@ -517,15 +517,15 @@ void Pdr_ManVerifyInvariant( Pdr_Man_t * p )
     Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
     {
         vLits = Pdr_ManCubeToLits( p, kThis, pCube, 1, 0 );
-        RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+        RetValue = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
         assert( RetValue );
-        sat_solver_compress( pSat );
+        Pdr_ManSatCompress( p, pSat );
     }
     // check each clause
     Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
     {
         vLits = Pdr_ManCubeToLits( p, kThis, pCube, 0, 1 );
-        RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, 0, 0, 0 );
+        RetValue = Pdr_ManSatSolve( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, p->timeToStop );
         if ( RetValue != l_False )
         {
             Abc_Print( 1, "Verification of clause %d failed.\n", i );
@@ -556,7 +556,7 @@ void Pdr_ManVerifyInvariant( Pdr_Man_t * p )
 ***********************************************************************/
 int Pdr_ManDeriveMarkNonInductive( Pdr_Man_t * p, Vec_Ptr_t * vCubes )
 {
-    sat_solver * pSat;
+    void * pSat;
     Vec_Int_t * vLits;
     Pdr_Set_t * pCube;
     int i, kThis, RetValue, fChanges = 0, Counter = 0;
@@ -569,9 +569,9 @@ int Pdr_ManDeriveMarkNonInductive( Pdr_Man_t * p, Vec_Ptr_t * vCubes )
         if ( pCube->nRefs == -1 ) // skip non-inductive
             continue;
         vLits = Pdr_ManCubeToLits( p, kThis, pCube, 1, 0 );
-        RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+        RetValue = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
         assert( RetValue );
-        sat_solver_compress( pSat );
+        Pdr_ManSatCompress( p, pSat );
     }
     // check each clause
     Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
@@ -579,7 +579,7 @@ int Pdr_ManDeriveMarkNonInductive( Pdr_Man_t * p, Vec_Ptr_t * vCubes )
         if ( pCube->nRefs == -1 ) // skip non-inductive
             continue;
         vLits = Pdr_ManCubeToLits( p, kThis, pCube, 0, 1 );
-        RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, 0, 0, 0 );
+        RetValue = Pdr_ManSatSolve( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, p->timeToStop );
         if ( RetValue != l_False ) // mark as non-inductive
         {
             pCube->nRefs = -1;
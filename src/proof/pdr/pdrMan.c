@@ -248,10 +248,14 @@ Vec_Int_t * Pdr_ManDeriveFlopPriorities2( Gia_Man_t * p, int fMuxCtrls )
 Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrioInit )
 {
     Pdr_Man_t * p;
+    // the updated X-valued simulation relies on bsat-specific incremental interface
+    int fNewXSim = pPars->fNewXSim && pPars->nSolverType == PDR_SAT_BSAT;
+    if ( pPars->fNewXSim && !fNewXSim && !pPars->fSilent )
+        Abc_Print( 0, "PDR: Updated X-valued simulation is only supported by bsat and will not be used.\n" );
     p = ABC_CALLOC( Pdr_Man_t, 1 );
     p->pPars    = pPars;
     p->pAig     = pAig;
-    p->pGia     = (pPars->fFlopPrio || p->pPars->fNewXSim || p->pPars->fUseAbs) ? Gia_ManFromAigSimple(pAig) : NULL;
+    p->pGia     = (pPars->fFlopPrio || fNewXSim || p->pPars->fUseAbs) ? Gia_ManFromAigSimple(pAig) : NULL;
     p->vSolvers = Vec_PtrAlloc( 0 );
     p->vClauses = Vec_VecAlloc( 0 );
     p->pQueue   = NULL;
@@ -281,7 +285,8 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->vRes     = Vec_IntAlloc( 100 );  // final result
     p->pCnfMan  = Cnf_ManStart();
     // ternary simulation
-    p->pTxs3    = pPars->fNewXSim ? Txs3_ManStart( p, pAig, p->vPrio ) : NULL;
+    p->pTxs3    = fNewXSim ? Txs3_ManStart( p, pAig, p->vPrio ) : NULL;
+    p->pTxs4    = pPars->fWordXSim ? Txs4_ManStart( p, pAig, p->vPrio ) : NULL;
     // additional AIG data-members
     if ( pAig->pFanData == NULL )
         Aig_ManFanoutStart( pAig );
@@ -318,7 +323,7 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
 void Pdr_ManStop( Pdr_Man_t * p )
 {
     Pdr_Set_t * pCla;
-    sat_solver * pSat;
+    void * pSat;
     int i, k;
     Gia_ManStopP( &p->pGia );
     Aig_ManCleanMarkAB( p->pAig );
@@ -339,8 +344,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
         fflush( stdout );
     }
 //    Abc_Print( 1, "SS =%6d. SU =%6d. US =%6d. UU =%6d.\n", p->nCasesSS, p->nCasesSU, p->nCasesUS, p->nCasesUU );
-    Vec_PtrForEachEntry( sat_solver *, p->vSolvers, pSat, i )
-        sat_solver_delete( pSat );
+    Vec_PtrForEachEntry( void *, p->vSolvers, pSat, i )
+        Pdr_ManSatFree( p, pSat );
     Vec_PtrFree( p->vSolvers );
     Vec_VecForEachEntry( Pdr_Set_t *, p->vClauses, pCla, i, k )
         Pdr_SetDeref( pCla );
@@ -368,8 +373,10 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFreeP( &p->vMapFf2Ppi );
     Vec_IntFreeP( &p->vMapPpi2Ff );
     // terminary simulation
-    if ( p->pPars->fNewXSim )
+    if ( p->pTxs3 )
         Txs3_ManStop( p->pTxs3 );
+    if ( p->pTxs4 )
+        Txs4_ManStop( p->pTxs4 );
     // internal use
     Vec_IntFreeP( &p->vPrio   );  // priority flops
     Vec_IntFree( p->vLits     );  // array of literals
@@ -0,0 +1,371 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Concurrent PDR with the shared lemma pool.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+void        Pdr_ManPoolExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube ) {}
+void        Pdr_ManPoolImport( Pdr_Man_t * p ) {}
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue )
+{
+    Pdr_Man_t * p = Pdr_ManStart( pAig, pPars, NULL );
+    *pRetValue = Pdr_ManSolveInt( p );
+    return p;
+}
+
+#else // pthreads are used
+
+#define PDR_PAR_THR_MAX 64
+
+// the lemmas learned by the workers
+struct Pdr_Pool_t_
+{
+    pthread_mutex_t  Mutex;      // protects the data below
+    Vec_Int_t *      vLemmas;    // lemmas as (worker, frame, nLits, lits)
+    int              nLemmas;    // the number of lemmas
+    int              iWinner;    // the first worker to solve the problem
+    Util_Task_t *    pToken;     // cancels the workers when the problem is solved
+    int           (* pFuncStop)(int); // the termination callback of the caller
+    int              RunId;      // the run ID of the caller
+};
+
+// information given to the thread
+typedef struct Pdr_ParThData_t_
+{
+    Pdr_Man_t *      pMan;
+    int              RetValue;
+} Pdr_ParThData_t;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the workers when the problem is solved.]
+
+  Description [The workers run under the token of the run, which is
+  cancelled by the first worker to solve the problem. The callback of
+  the caller is kept in the pool of the worker run by this thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManParCallBackToStop( int RunId )
+{
+    Pdr_ParThData_t * pThData = (Pdr_ParThData_t *)Util_TaskArg();
+    Pdr_Pool_t * pPool = pThData ? pThData->pMan->pPool : NULL;
+    if ( Util_TaskStop() )
+        return 1;
+    return pPool && pPool->pFuncStop && pPool->pFuncStop( pPool->RunId );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the lemma in the pool.]
+
+  Description [The lemma blocks the cube in the first k frames of this
+  worker.  Since the frames over-approximate the states reachable in the
+  given number of steps, the lemma holds in the first k frames of any
+  other worker, but it may be not inductive relative to their frames.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManPoolExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Pool_t * pPool = p->pPool;
+    int i, status;
+    assert( k > 0 );
+    status = pthread_mutex_lock( &pPool->Mutex );  assert( status == 0 );
+    Vec_IntPush( pPool->vLemmas, p->iWorker );
+    Vec_IntPush( pPool->vLemmas, k );
+    Vec_IntPush( pPool->vLemmas, pCube->nLits );
+    for ( i = 0; i < pCube->nLits; i++ )
+        Vec_IntPush( pPool->vLemmas, pCube->Lits[i] );
+    pPool->nLemmas++;
+    status = pthread_mutex_unlock( &pPool->Mutex );  assert( status == 0 );
+    p->nPoolOut++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemmas published by other workers.]
+
+  Description [A lemma learned in frame k is added to frame k, or to the
+  last frame of this worker, if it has fewer frames.  The lemmas already
+  subsumed by the clauses of this worker are skipped.  The remaining ones
+  are added only if they are inductive relative to the previous frame of
+  this worker, otherwise the frames would stop being monotone and the
+  fixed point could be detected too early.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Pdr_Set_t * Pdr_ManPoolCube( int * pLits, int nLits )
+{
+    Pdr_Set_t * p = Pdr_SetAlloc( nLits );
+    int i;
+    p->nLits  = nLits;
+    p->nTotal = nLits;
+    p->nRefs  = 1;
+    for ( i = 0; i < nLits; i++ )
+    {
+        p->Lits[i] = pLits[i];
+        p->Sign   |= ((word)1 << (p->Lits[i] % 63));
+    }
+    return p;
+}
+void Pdr_ManPoolImport( Pdr_Man_t * p )
+{
+    Pdr_Pool_t * pPool = p->pPool;
+    Pdr_Set_t * pCube;
+    Vec_Int_t * vLemmas;
+    int i, k, j, nLits, status, RetValue, kMax = Vec_PtrSize(p->vSolvers)-1;
+    if ( kMax < 1 )
+        return;
+    status = pthread_mutex_lock( &pPool->Mutex );  assert( status == 0 );
+    if ( p->iPoolNext == Vec_IntSize(pPool->vLemmas) )
+    {
+        status = pthread_mutex_unlock( &pPool->Mutex );  assert( status == 0 );
+        return;
+    }
+    vLemmas = Vec_IntAllocArrayCopy( Vec_IntArray(pPool->vLemmas) + p->iPoolNext, Vec_IntSize(pPool->vLemmas) - p->iPoolNext );
+    p->iPoolNext = Vec_IntSize(pPool->vLemmas);
+    status = pthread_mutex_unlock( &pPool->Mutex );  assert( status == 0 );
+    for ( i = 0; i < Vec_IntSize(vLemmas); i += 3 + nLits )
+    {
+        nLits = Vec_IntEntry( vLemmas, i+2 );
+        if ( Vec_IntEntry(vLemmas, i) == p->iWorker )
+            continue;
+        k = Abc_MinInt( Vec_IntEntry(vLemmas, i+1), kMax );
+        pCube = Pdr_ManPoolCube( Vec_IntEntryP(vLemmas, i+3), nLits );
+        if ( Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment( p, k, pCube ) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        // the lemma should be inductive relative to the previous frame
+        RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, p->pPars->nConfLimit, 0, 1 );
+        if ( RetValue != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        for ( j = 1; j <= k; j++ )
+            Pdr_ManSolverAddClause( p, j, pCube );
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        p->nPoolIn++;
+    }
+    Vec_IntFree( vLemmas );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManParWorker( void * pArg )
+{
+    Pdr_ParThData_t * pThData = (Pdr_ParThData_t *)pArg;
+    Pdr_Man_t * p = pThData->pMan;
+    int status;
+    pThData->RetValue = Pdr_ManSolveInt( p );
+    if ( pThData->RetValue != -1 )
+    {
+        status = pthread_mutex_lock( &p->pPool->Mutex );  assert( status == 0 );
+        if ( p->pPool->iWinner == -1 )
+        {
+            p->pPool->iWinner = p->iWorker;
+            Util_TaskCancel( p->pPool->pToken );
+        }
+        status = pthread_mutex_unlock( &p->pPool->Mutex );  assert( status == 0 );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the property using several concurrent workers.]
+
+  Description [Each worker runs PDR on its own copy of the AIG with its
+  own timeframe solvers.  The workers are diversified by the random seed
+  and the generalization options.  The lemmas learned while blocking the
+  proof obligations and the lemmas pushed into the last frame are shared
+  through the pool.  The first worker that proves or disproves the
+  property stops the others.  Returns the manager of this worker (or
+  the manager of the first worker, if the problem is not solved), which
+  is updated to use the parameters of the caller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue )
+{
+    Pdr_ParThData_t ThData[PDR_PAR_THR_MAX];
+    Util_Task_t * pTasks[PDR_PAR_THR_MAX], * pTaskCur;
+    Pdr_Pool_t Pool, * pPool = &Pool;
+    Pdr_Par_t * pParsAll;
+    Pdr_Man_t * p;
+    int i, status, iWinner, nWorkers = Abc_MinInt( pPars->nThreads, PDR_PAR_THR_MAX );
+    abctime clk = Abc_Clock();
+    assert( !pPars->fSolveAll && !pPars->fUseAbs );
+    // the winner switches to these parameters, so they should agree with
+    // the parameters the workers were started with
+    if ( pPars->nSolverType != PDR_SAT_BSAT )
+        pPars->fNewXSim = 0;
+    // start the pool
+    status = pthread_mutex_init( &pPool->Mutex, NULL );  assert( status == 0 );
+    pPool->vLemmas = Vec_IntAlloc( 1 << 16 );
+    pPool->nLemmas = 0;
+    pPool->iWinner = -1;
+    pPool->pFuncStop = pPars->pFuncStop;
+    pPool->RunId   = pPars->RunId;
+    // start the workers
+    pParsAll = ABC_ALLOC( Pdr_Par_t, nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        Pdr_Par_t * pParsW = pParsAll + i;
+        *pParsW = *pPars;
+        pParsW->nThreads      = 1;
+        pParsW->nRandomSeed   = pPars->nRandomSeed + i;
+        pParsW->pFuncStop     = Pdr_ManParCallBackToStop;
+        pParsW->RunId         = 0;
+        pParsW->pFuncProgress = NULL;
+        if ( i % 4 == 1 )
+            pParsW->fSkipDown  ^= 1;
+        else if ( i % 4 == 2 )
+            pParsW->fTwoRounds ^= 1;
+        else if ( i % 4 == 3 )
+            pParsW->fFlopOrder ^= 1;
+        // only the first worker reports the progress, while the results
+        // are reported after the workers are done, because the solvers of
+        // the workers are interrupted as soon as one of them succeeds
+        if ( i > 0 )
+        {
+            pParsW->fVerbose     = 0;
+            pParsW->fVeryVerbose = 0;
+            pParsW->fNotVerbose  = 1;
+        }
+        pParsW->fSilent = 1;
+        ThData[i].pMan = Pdr_ManStart( Aig_ManDupSimple(pAig), pParsW, NULL );
+        ThData[i].pMan->pPool   = pPool;
+        ThData[i].pMan->iWorker = i;
+        ThData[i].RetValue = -1;
+    }
+    // the workers are long tasks run under the token of this run
+    pPool->pToken = Util_TaskToken( 0 );
+    pTaskCur = Util_TaskSetCurrent( pPool->pToken );
+    for ( i = 0; i < nWorkers; i++ )
+        pTasks[i] = Util_TaskSpawn( Pdr_ManParWorker, (void *)(ThData + i), 0 );
+    Util_TaskSetCurrent( pTaskCur );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        Util_TaskWait( pTasks[i] );
+        Util_TaskFree( pTasks[i] );
+    }
+    Util_TaskFree( pPool->pToken );
+    // collect the results
+    iWinner = pPool->iWinner >= 0 ? pPool->iWinner : 0;
+    p = ThData[iWinner].pMan;
+    *pRetValue = ThData[iWinner].RetValue;
+    pPars->iFrame = pParsAll[iWinner].iFrame;
+    pPars->timeLastSolved = pParsAll[iWinner].timeLastSolved;
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Parallel PDR with %d workers shared %d lemmas. ", nWorkers, pPool->nLemmas );
+        if ( pPool->iWinner >= 0 )
+            Abc_Print( 1, "Worker %d solved the problem in frame %d. ", iWinner, pPars->iFrame );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        for ( i = 0; i < nWorkers; i++ )
+            Abc_Print( 1, "Worker %2d : Frames = %3d.  Clauses = %6d.  Exported = %6d.  Imported = %6d.\n",
+                i, Vec_PtrSize(ThData[i].pMan->vSolvers), ThData[i].pMan->nCubes, ThData[i].pMan->nPoolOut, ThData[i].pMan->nPoolIn );
+    }
+    if ( *pRetValue == 0 )
+    {
+        assert( p->pAig->pSeqModel != NULL );
+        pAig->pSeqModel = p->pAig->pSeqModel;
+        p->pAig->pSeqModel = NULL;
+    }
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        Aig_Man_t * pAigW = ThData[i].pMan->pAig;
+        if ( i == iWinner )
+            continue;
+        Pdr_ManStop( ThData[i].pMan );
+        Aig_ManStop( pAigW );
+    }
+    // let the winner use the parameters of the caller
+    p->pPars  = pPars;
+    p->pPool  = NULL;
+    if ( *pRetValue == 1 && !pPars->fSilent )
+    {
+        Pdr_ManReportInvariant( p );
+        Pdr_ManVerifyInvariant( p );
+    }
+    else if ( *pRetValue == -1 && !pPars->fSilent && pPars->nTimeOut && Abc_Clock() > p->timeToStop )
+        Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  pPars->nTimeOut, pPars->iFrame );
+    ABC_FREE( pParsAll );
+    Vec_IntFree( pPool->vLemmas );
+    status = pthread_mutex_destroy( &pPool->Mutex );  assert( status == 0 );
+    return p;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
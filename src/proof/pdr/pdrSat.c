@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "pdrInt.h"
+#include "sat/cadical/ccadical.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,6 +32,137 @@ ABC_NAMESPACE_IMPL_START
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Interface to the SAT solvers used for the timeframes.]
+
+  Description [The timeframe solvers are bsat, satoko, or CaDiCaL, as
+  selected by pPars->nSolverType.  The literals are in the ABC encoding
+  for all of them.  The conflict returned by Pdr_ManSatFinal() is the
+  clause composed of the negated assumptions, as in bsat.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManSatTerminate( void * pData )
+{
+    Pdr_Man_t * p = (Pdr_Man_t *)pData;
+    if ( p->timeToStopSat && Abc_Clock() > p->timeToStopSat )
+        return 1;
+    if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+        return 1;
+    return Util_TaskStop();
+}
+void * Pdr_ManSatAlloc( Pdr_Man_t * p )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+        return satoko_create();
+    if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+    {
+        cadical_solver * pSat = cadical_solver_new();
+        ccadical_set_terminate( (CCaDiCaL *)pSat->p, p, Pdr_ManSatTerminate );
+        return pSat;
+    }
+    return zsat_solver_new_seed( p->pPars->nRandomSeed );
+}
+void * Pdr_ManSatRestart( Pdr_Man_t * p, void * pSat )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+        satoko_reset( (satoko_t *)pSat );
+    else if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+    {
+        // CaDiCaL cannot be reset, so the solver is replaced
+        cadical_solver_delete( (cadical_solver *)pSat );
+        pSat = Pdr_ManSatAlloc( p );
+    }
+    else
+        zsat_solver_restart_seed( (sat_solver *)pSat, p->pPars->nRandomSeed );
+    return pSat;
+}
+void Pdr_ManSatFree( Pdr_Man_t * p, void * pSat )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+        satoko_destroy( (satoko_t *)pSat );
+    else if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+        cadical_solver_delete( (cadical_solver *)pSat );
+    else
+        sat_solver_delete( (sat_solver *)pSat );
+}
+int Pdr_ManSatNVars( Pdr_Man_t * p, void * pSat )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+        return satoko_varnum( (satoko_t *)pSat );
+    if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+        return cadical_solver_nvars( (cadical_solver *)pSat );
+    return sat_solver_nvars( (sat_solver *)pSat );
+}
+void Pdr_ManSatSetNVars( Pdr_Man_t * p, void * pSat, int nVars )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+        satoko_setnvars( (satoko_t *)pSat, nVars );
+    else if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+    {
+        if ( cadical_solver_nvars( (cadical_solver *)pSat ) < nVars )
+            cadical_solver_setnvars( (cadical_solver *)pSat, nVars );
+    }
+    else
+        sat_solver_setnvars( (sat_solver *)pSat, nVars );
+}
+int Pdr_ManSatAddClause( Pdr_Man_t * p, void * pSat, int * pBeg, int * pEnd )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+        return satoko_add_clause( (satoko_t *)pSat, pBeg, pEnd - pBeg );
+    if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+        return cadical_solver_addclause( (cadical_solver *)pSat, pBeg, pEnd );
+    return sat_solver_addclause( (sat_solver *)pSat, pBeg, pEnd );
+}
+void Pdr_ManSatCompress( Pdr_Man_t * p, void * pSat )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_BSAT )
+        sat_solver_compress( (sat_solver *)pSat );
+}
+int Pdr_ManSatSolve( Pdr_Man_t * p, void * pSat, int * pBeg, int * pEnd, int nConfLimit, abctime TimeLimit )
+{
+    abctime Limit;
+    int RetValue;
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+    {
+        Limit = satoko_set_runtime_limit( (satoko_t *)pSat, TimeLimit );
+        RetValue = satoko_solve_assumptions_limit( (satoko_t *)pSat, pBeg, pEnd - pBeg, nConfLimit );
+        satoko_set_runtime_limit( (satoko_t *)pSat, Limit );
+        return RetValue == SATOKO_SAT ? l_True : RetValue == SATOKO_UNSAT ? l_False : l_Undef;
+    }
+    if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+    {
+        p->timeToStopSat = TimeLimit;
+        RetValue = cadical_solver_solve( (cadical_solver *)pSat, pBeg, pEnd, nConfLimit, 0, 0, 0 );
+        p->timeToStopSat = 0;
+        return RetValue == 1 ? l_True : RetValue == -1 ? l_False : l_Undef;
+    }
+    Limit = sat_solver_set_runtime_limit( (sat_solver *)pSat, TimeLimit );
+    RetValue = sat_solver_solve( (sat_solver *)pSat, pBeg, pEnd, nConfLimit, 0, 0, 0 );
+    sat_solver_set_runtime_limit( (sat_solver *)pSat, Limit );
+    return RetValue;
+}
+int Pdr_ManSatFinal( Pdr_Man_t * p, void * pSat, int ** ppLits )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+        return satoko_final_conflict( (satoko_t *)pSat, ppLits );
+    if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+        return cadical_solver_final( (cadical_solver *)pSat, ppLits );
+    return sat_solver_final( (sat_solver *)pSat, ppLits );
+}
+int Pdr_ManSatVarValue( Pdr_Man_t * p, void * pSat, int iVar )
+{
+    if ( p->pPars->nSolverType == PDR_SAT_SATOKO )
+        return satoko_read_cex_varvalue( (satoko_t *)pSat, iVar );
+    if ( p->pPars->nSolverType == PDR_SAT_CADICAL )
+        return iVar < cadical_solver_nvars( (cadical_solver *)pSat ) && cadical_solver_get_var_value( (cadical_solver *)pSat, iVar );
+    return sat_solver_var_value( (sat_solver *)pSat, iVar );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates new SAT solver.]
@@ -42,17 +174,16 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
+void * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
 {
-    sat_solver * pSat;
+    void * pSat;
     Aig_Obj_t * pObj;
     int i;
     assert( Vec_PtrSize(p->vSolvers) == k );
     assert( Vec_VecSize(p->vClauses) == k );
     assert( Vec_IntSize(p->vActVars) == k );
     // create new solver
-//    pSat = sat_solver_new();
-    pSat = zsat_solver_new_seed(p->pPars->nRandomSeed);
+    pSat = Pdr_ManSatAlloc( p );
     pSat = Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
     Vec_PtrPush( p->vSolvers, pSat );
     Vec_VecExpand( p->vClauses, k );
@@ -74,9 +205,9 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
   SeeAlso     []
 
 ***********************************************************************/
-sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
+void * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
 {
-    sat_solver * pSat;
+    void * pSat;
     Vec_Ptr_t * vArrayK;
     Pdr_Set_t * pCube;
     int i, j;
@@ -85,10 +216,7 @@ sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
         return pSat;
     assert( k < Vec_PtrSize(p->vSolvers) - 1 );
     p->nStarts++;
-//    sat_solver_delete( pSat );
-//    pSat = sat_solver_new();
-//    sat_solver_restart( pSat );
-    zsat_solver_restart_seed( pSat, p->pPars->nRandomSeed );
+    pSat = Pdr_ManSatRestart( p, pSat );
     // create new SAT solver
     pSat = Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
     // write new SAT solver
@@ -178,7 +306,7 @@ Vec_Int_t * Pdr_ManCubeToLits( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, int fCom
 ***********************************************************************/
 void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
 {
-    sat_solver * pSat;
+    void * pSat;
     Aig_Obj_t * pObj;
     int Lit, RetValue, i;
     if ( !p->pPars->fUsePropOut )
@@ -193,10 +321,10 @@ void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
         if ( p->pPars->vOutMap && Vec_IntEntry(p->pPars->vOutMap, i) == -1 )
             continue;
         Lit = Abc_Var2Lit( Pdr_ObjSatVar(p, k, 1, pObj), 1 ); // neg literal
-        RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+        RetValue = Pdr_ManSatAddClause( p, pSat, &Lit, &Lit + 1 );
         assert( RetValue == 1 );
     }
-    sat_solver_compress( pSat );
+    Pdr_ManSatCompress( p, pSat );
 }
 
 /**Function*************************************************************
@@ -212,14 +340,14 @@ void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
 ***********************************************************************/
 void Pdr_ManSolverAddClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
 {
-    sat_solver * pSat;
+    void * pSat;
     Vec_Int_t * vLits;
     int RetValue;
     pSat  = Pdr_ManSolver(p, k);
     vLits = Pdr_ManCubeToLits( p, k, pCube, 1, 0 );
-    RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+    RetValue = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
     assert( RetValue == 1 );
-    sat_solver_compress( pSat );
+    Pdr_ManSatCompress( p, pSat );
 }
 
 /**Function*************************************************************
@@ -235,7 +363,7 @@ void Pdr_ManSolverAddClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
 ***********************************************************************/
 void Pdr_ManCollectValues( Pdr_Man_t * p, int k, Vec_Int_t * vObjIds, Vec_Int_t * vValues )
 {
-    sat_solver * pSat;
+    void * pSat;
     Aig_Obj_t * pObj;
     int iVar, i;
     Vec_IntClear( vValues );
@@ -243,7 +371,7 @@ void Pdr_ManCollectValues( Pdr_Man_t * p, int k, Vec_Int_t * vObjIds, Vec_Int_t
     Aig_ManForEachObjVec( vObjIds, p->pAig, pObj, i )
     {
         iVar = Pdr_ObjSatVar( p, k, 3, pObj ); assert( iVar >= 0 );
-        Vec_IntPush( vValues, sat_solver_var_value(pSat, iVar) );
+        Vec_IntPush( vValues, Pdr_ManSatVarValue(p, pSat, iVar) );
     }
 }
 
@@ -261,15 +389,12 @@ void Pdr_ManCollectValues( Pdr_Man_t * p, int k, Vec_Int_t * vObjIds, Vec_Int_t
 ***********************************************************************/
 int Pdr_ManCheckCubeCs( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
 { 
-    sat_solver * pSat;
+    void * pSat;
     Vec_Int_t * vLits;
-    abctime Limit;
     int RetValue;
     pSat = Pdr_ManFetchSolver( p, k );
     vLits = Pdr_ManCubeToLits( p, k, pCube, 0, 0 );
-    Limit = sat_solver_set_runtime_limit( pSat, Pdr_ManTimeLimit(p) );
-    RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, 0, 0, 0 );
-    sat_solver_set_runtime_limit( pSat, Limit );
+    RetValue = Pdr_ManSatSolve( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, Pdr_ManTimeLimit(p) );
     if ( RetValue == l_Undef )
         return -1;
     return (RetValue == l_False);
@@ -291,19 +416,17 @@ int Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPr
 { 
     //int fUseLit = 0;
     int fLitUsed = 0;
-    sat_solver * pSat;
+    void * pSat;
     Vec_Int_t * vLits;
     int Lit, RetValue;
-    abctime clk, Limit;
+    abctime clk;
     p->nCalls++;
     pSat = Pdr_ManFetchSolver( p, k );
     if ( pCube == NULL ) // solve the property
     {
         clk = Abc_Clock();
         Lit = Abc_Var2Lit( Pdr_ObjSatVar(p, k, 2, Aig_ManCo(p->pAig, p->iOutCur)), 0 ); // pos literal (property fails)
-        Limit = sat_solver_set_runtime_limit( pSat, Pdr_ManTimeLimit(p) );
-        RetValue = sat_solver_solve( pSat, &Lit, &Lit + 1, nConfLimit, 0, 0, 0 );
-        sat_solver_set_runtime_limit( pSat, Limit );
+        RetValue = Pdr_ManSatSolve( p, pSat, &Lit, &Lit + 1, nConfLimit, Pdr_ManTimeLimit(p) );
         if ( RetValue == l_Undef )
             return -1;
         if ( p->pPars->pFuncProgress && p->pPars->pFuncProgress( p->pPars->pProgress, 0, (unsigned)k ) )
@@ -321,9 +444,9 @@ int Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPr
             Lit = Abc_Var2Lit( Pdr_ManFreeVar(p, k), 0 );
             // add activation literal
             Vec_IntPush( vLits, Lit );
-            RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+            RetValue = Pdr_ManSatAddClause( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
             assert( RetValue == 1 );
-            sat_solver_compress( pSat );
+            Pdr_ManSatCompress( p, pSat );
             // create assumptions
             vLits = Pdr_ManCubeToLits( p, k, pCube, 0, 1 );
             // add activation literal
@@ -334,9 +457,7 @@ int Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPr
 
         // solve 
         clk = Abc_Clock();
-        Limit = sat_solver_set_runtime_limit( pSat, Pdr_ManTimeLimit(p) );
-        RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), fTryConf ? p->pPars->nConfGenLimit : nConfLimit, 0, 0, 0 );
-        sat_solver_set_runtime_limit( pSat, Limit );
+        RetValue = Pdr_ManSatSolve( p, pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), fTryConf ? p->pPars->nConfGenLimit : nConfLimit, Pdr_ManTimeLimit(p) );
         if ( RetValue == l_Undef )
         {
             if ( fTryConf && p->pPars->nConfGenLimit )
@@ -365,8 +486,10 @@ int Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPr
         if ( ppPred )
         {
             abctime clk = Abc_Clock();
-            if ( p->pPars->fNewXSim )
+            if ( p->pTxs3 )
                 *ppPred = Txs3_ManTernarySim( p->pTxs3, k, pCube );
+            else if ( p->pTxs4 )
+                *ppPred = Txs4_ManTernarySim( p->pTxs4, k, pCube );
             else
                 *ppPred = Pdr_ManTernarySim( p, k, pCube );
             p->tTsim += Abc_Clock() - clk;
@@ -232,7 +232,7 @@ Abc_Print( 1, " in frame %d.\n", k );
     Pdr_ManCollectValues( p->pMan, k, p->vCoObjs, p->vCoVals );
 
     // read solver
-    pSat = Pdr_ManFetchSolver( p->pMan, k );
+    pSat = (sat_solver *)Pdr_ManFetchSolver( p->pMan, k );
     LitAux = Abc_Var2Lit( Pdr_ManFreeVar(p->pMan, k), 0 );
     // add the clause (complemented cube) in terms of next state variables
     if ( pCube == NULL ) // the target is the property output
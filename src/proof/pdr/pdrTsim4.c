@@ -0,0 +1,459 @@
+/**CFile****************************************************************
+
+  FileName    [pdrTsim4.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Word-parallel ternary simulation for cube lifting.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: pdrTsim4.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "aig/gia/giaAig.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The ternary value of an object is represented by two words, which have
+// 1s in the bit-positions (lanes) where the value is 0 and 1, respectively.
+// Both words have 0s in the lanes where the value is X.  Lane i tries to
+// remove the first (i+1) candidate flops of the current batch, on top of
+// the flops already removed.  Since X-values only grow when more flops are
+// removed, the first lane where a cone output becomes X, shows how many
+// candidates can be removed, while the result is the same as when the
+// candidates are tried one at a time in the same order.  Each batch only
+// re-simulates the TFO of the flops whose values were changed since the
+// previous simulation, while the other cone nodes keep their values.
+
+struct Txs4_Man_t_
+{
+    Gia_Man_t * pGia;      // compact copy of the transition relation
+    Vec_Int_t * vPrio;     // priority of each flop
+    Vec_Int_t * vCiObjs;   // cone leaves (CI obj IDs in GIA)
+    Vec_Int_t * vCoObjs;   // cone roots (CO obj IDs in GIA)
+    Vec_Int_t * vCiAigs;   // cone leaves (CI obj IDs in AIG)
+    Vec_Int_t * vCoAigs;   // cone roots (CO obj IDs in AIG)
+    Vec_Int_t * vCiVals;   // cone leaf values (0/1 CI values)
+    Vec_Int_t * vCoVals;   // cone root values (0/1 CO values)
+    Vec_Int_t * vNodes;    // cone nodes (node obj IDs in GIA)
+    Vec_Int_t * vDirty;    // cone leaves changed since the last simulation
+    Vec_Int_t * vTfo;      // cone nodes in the TFO of the changed leaves
+    Vec_Int_t * vCands;    // flops to be removed in the order of trying them
+    Vec_Int_t * vRemoved;  // removed flops (1 for each removed flop)
+    Vec_Int_t * vPiLits;   // resulting array of PI literals
+    Vec_Int_t * vFfLits;   // resulting array of flop literals
+    Vec_Wrd_t * vSims;     // simulation info (two words for each object)
+    Pdr_Man_t * pMan;      // calling manager
+    int         nBatches;  // the number of simulated batches
+};
+
+static inline word * Txs4_ObjSim( Txs4_Man_t * p, int iObj ) { return Vec_WrdEntryP( p->vSims, 2 * iObj ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Start and stop the ternary simulation engine.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Txs4_Man_t * Txs4_ManStart( Pdr_Man_t * pMan, Aig_Man_t * pAig, Vec_Int_t * vPrio )
+{
+    Txs4_Man_t * p;
+    assert( Vec_IntSize(vPrio) == Aig_ManRegNum(pAig) );
+    p = ABC_CALLOC( Txs4_Man_t, 1 );
+    p->pGia     = Gia_ManFromAigSimple( pAig );
+    p->vPrio    = vPrio;
+    p->vCiObjs  = Vec_IntAlloc( 100 );
+    p->vCoObjs  = Vec_IntAlloc( 100 );
+    p->vCiAigs  = Vec_IntAlloc( 100 );
+    p->vCoAigs  = Vec_IntAlloc( 100 );
+    p->vCiVals  = Vec_IntAlloc( 100 );
+    p->vCoVals  = Vec_IntAlloc( 100 );
+    p->vNodes   = Vec_IntAlloc( 100 );
+    p->vDirty   = Vec_IntAlloc( 100 );
+    p->vTfo     = Vec_IntAlloc( 100 );
+    p->vCands   = Vec_IntAlloc( 100 );
+    p->vRemoved = Vec_IntStart( Aig_ManRegNum(pAig) );
+    p->vPiLits  = Vec_IntAlloc( 100 );
+    p->vFfLits  = Vec_IntAlloc( 100 );
+    p->vSims    = Vec_WrdStart( 2 * Gia_ManObjNum(p->pGia) );
+    p->pMan     = pMan;
+    Gia_ManStaticFanoutStart( p->pGia );
+    return p;
+}
+void Txs4_ManStop( Txs4_Man_t * p )
+{
+    Gia_ManStaticFanoutStop( p->pGia );
+    Gia_ManStop( p->pGia );
+    Vec_IntFree( p->vCiObjs );
+    Vec_IntFree( p->vCoObjs );
+    Vec_IntFree( p->vCiAigs );
+    Vec_IntFree( p->vCoAigs );
+    Vec_IntFree( p->vCiVals );
+    Vec_IntFree( p->vCoVals );
+    Vec_IntFree( p->vNodes );
+    Vec_IntFree( p->vDirty );
+    Vec_IntFree( p->vTfo );
+    Vec_IntFree( p->vCands );
+    Vec_IntFree( p->vRemoved );
+    Vec_IntFree( p->vPiLits );
+    Vec_IntFree( p->vFfLits );
+    Vec_WrdFree( p->vSims );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the TFI cone and collects CIs and nodes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Txs4_ManCollectCone_rec( Txs4_Man_t * p, Gia_Obj_t * pObj )
+{
+    if ( Gia_ObjIsTravIdCurrent(p->pGia, pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent(p->pGia, pObj);
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        Vec_IntPush( p->vCiObjs, Gia_ObjId(p->pGia, pObj) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Txs4_ManCollectCone_rec( p, Gia_ObjFanin0(pObj) );
+    Txs4_ManCollectCone_rec( p, Gia_ObjFanin1(pObj) );
+    Vec_IntPush( p->vNodes, Gia_ObjId(p->pGia, pObj) );
+}
+void Txs4_ManCollectCone( Txs4_Man_t * p )
+{
+    Aig_Man_t * pAig = p->pMan->pAig;
+    Gia_Obj_t * pObj; int i;
+    Vec_IntClear( p->vCiObjs );
+    Vec_IntClear( p->vNodes );
+    Gia_ManIncrementTravId( p->pGia );
+    Gia_ObjSetTravIdCurrent( p->pGia, Gia_ManConst0(p->pGia) );
+    Gia_ManForEachObjVec( p->vCoObjs, p->pGia, pObj, i )
+        Txs4_ManCollectCone_rec( p, Gia_ObjFanin0(pObj) );
+    // map the cone leaves and roots into the AIG, whose object IDs may differ
+    Vec_IntClear( p->vCiAigs );
+    Gia_ManForEachObjVec( p->vCiObjs, p->pGia, pObj, i )
+        Vec_IntPush( p->vCiAigs, Aig_ObjId(Aig_ManCi(pAig, Gia_ObjCioId(pObj))) );
+    Vec_IntClear( p->vCoAigs );
+    Gia_ManForEachObjVec( p->vCoObjs, p->pGia, pObj, i )
+        Vec_IntPush( p->vCoAigs, Aig_ObjId(Aig_ManCo(pAig, Gia_ObjCioId(pObj))) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the cone nodes in the TFO of the changed leaves.]
+
+  Description [Relies on the cone being marked with the current trav ID.
+  The resulting nodes are sorted, which makes their order topological.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Txs4_ManCollectTfo_rec( Txs4_Man_t * p, Gia_Obj_t * pObj )
+{
+    Gia_Obj_t * pFanout; int i;
+    Gia_ObjForEachFanoutStatic( p->pGia, pObj, pFanout, i )
+    {
+        if ( !Gia_ObjIsAnd(pFanout) || pFanout->fMark0 || !Gia_ObjIsTravIdCurrent(p->pGia, pFanout) )
+            continue;
+        pFanout->fMark0 = 1;
+        Vec_IntPush( p->vTfo, Gia_ObjId(p->pGia, pFanout) );
+        Txs4_ManCollectTfo_rec( p, pFanout );
+    }
+}
+void Txs4_ManCollectTfo( Txs4_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    Vec_IntClear( p->vTfo );
+    Gia_ManForEachObjVec( p->vDirty, p->pGia, pObj, i )
+        Txs4_ManCollectTfo_rec( p, pObj );
+    Gia_ManForEachObjVec( p->vTfo, p->pGia, pObj, i )
+        pObj->fMark0 = 0;
+    Vec_IntSort( p->vTfo, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the nodes and checks the values of cone roots.]
+
+  Description [Returns the mask of lanes in which all roots of the cone
+  have the same binary values as in the satisfying assignment.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Txs4_ManSimulate( Txs4_Man_t * p, Vec_Int_t * vNodes )
+{
+    Gia_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1, Res = ~(word)0;
+    int i, Value;
+    Gia_ManForEachObjVec( vNodes, p->pGia, pObj, i )
+    {
+        pSim  = Txs4_ObjSim( p, Gia_ObjId(p->pGia, pObj) );
+        pSim0 = Txs4_ObjSim( p, Gia_ObjFaninId0p(p->pGia, pObj) );
+        pSim1 = Txs4_ObjSim( p, Gia_ObjFaninId1p(p->pGia, pObj) );
+        pSim[0] = pSim0[ Gia_ObjFaninC0(pObj)] | pSim1[ Gia_ObjFaninC1(pObj)];
+        pSim[1] = pSim0[!Gia_ObjFaninC0(pObj)] & pSim1[!Gia_ObjFaninC1(pObj)];
+    }
+    Gia_ManForEachObjVec( p->vCoObjs, p->pGia, pObj, i )
+    {
+        Value = Vec_IntEntry( p->vCoVals, i );
+        pSim0 = Txs4_ObjSim( p, Gia_ObjFaninId0p(p->pGia, pObj) );
+        Res  &= pSim0[Value ^ Gia_ObjFaninC0(pObj)];
+    }
+    return Res;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one batch of candidate flops.]
+
+  Description [The previous batch and the current batch are marked as
+  changed, because the cone nodes in the TFO of the previous batch still
+  have the values it was simulated with.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Txs4_ManSimulateBatch( Txs4_Man_t * p, int iBeg, int nCands )
+{
+    int k;
+    for ( k = 0; k < nCands; k++ )
+        Vec_IntPush( p->vDirty, Vec_IntEntry(p->vCands, iBeg + k) );
+    Txs4_ManCollectTfo( p );
+    Vec_IntClear( p->vDirty );
+    for ( k = 0; k < nCands; k++ )
+        Vec_IntPush( p->vDirty, Vec_IntEntry(p->vCands, iBeg + k) );
+    p->nBatches++;
+    return Txs4_ManSimulate( p, p->vTfo );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the candidate flops in batches.]
+
+  Description [The candidate flops are given by their CI obj IDs in GIA.
+  The values of the CIs are stored in their Value fields.  The filtering
+  tries each candidate alone and drops those that cannot be removed even
+  alone.  Since X-values only grow when more flops are removed, these
+  candidates would not be removed later either.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Txs4_ManSetCi( Txs4_Man_t * p, int iObj, int Value, word Mask )
+{
+    word * pSim = Txs4_ObjSim( p, iObj );
+    pSim[0] = Value ? 0 : Mask;
+    pSim[1] = Value ? Mask : 0;
+}
+void Txs4_ManFilterFlops( Txs4_Man_t * p )
+{
+    int k, iBeg, nCands, iObj, j = 0;
+    word Res;
+    for ( iBeg = 0; iBeg < Vec_IntSize(p->vCands); iBeg += 64 )
+    {
+        nCands = Abc_MinInt( 64, Vec_IntSize(p->vCands) - iBeg );
+        // candidate k is X only in lane k
+        for ( k = 0; k < nCands; k++ )
+        {
+            iObj = Vec_IntEntry( p->vCands, iBeg + k );
+            Txs4_ObjSim(p, iObj)[0] &= ~((word)1 << k);
+            Txs4_ObjSim(p, iObj)[1] &= ~((word)1 << k);
+        }
+        Res = Txs4_ManSimulateBatch( p, iBeg, nCands );
+        for ( k = 0; k < nCands; k++ )
+        {
+            iObj = Vec_IntEntry( p->vCands, iBeg + k );
+            Txs4_ManSetCi( p, iObj, Gia_ManObj(p->pGia, iObj)->Value, ~(word)0 );
+            if ( (Res >> k) & 1 )
+                Vec_IntWriteEntry( p->vCands, j++, iObj );
+        }
+    }
+    Vec_IntShrink( p->vCands, j );
+}
+void Txs4_ManRemoveFlops( Txs4_Man_t * p )
+{
+    int k, iBeg, nCands, iObj, iFirst;
+    word Res, Lanes;
+    for ( iBeg = 0; iBeg < Vec_IntSize(p->vCands); )
+    {
+        nCands = Abc_MinInt( 64, Vec_IntSize(p->vCands) - iBeg );
+        Lanes  = nCands == 64 ? ~(word)0 : (((word)1 << nCands) - 1);
+        // candidate k is X in the lanes starting from k
+        for ( k = 0; k < nCands; k++ )
+        {
+            iObj = Vec_IntEntry( p->vCands, iBeg + k );
+            Txs4_ObjSim(p, iObj)[0] &= ~(~(word)0 << k);
+            Txs4_ObjSim(p, iObj)[1] &= ~(~(word)0 << k);
+        }
+        Res = Txs4_ManSimulateBatch( p, iBeg, nCands ) | ~Lanes;
+        iFirst = (~Res) ? Abc_Tt6FirstBit( ~Res ) : nCands;
+        // the candidates before the first failing lane are removed
+        for ( k = 0; k < iFirst; k++ )
+        {
+            iObj = Vec_IntEntry( p->vCands, iBeg + k );
+            Txs4_ObjSim(p, iObj)[0] = Txs4_ObjSim(p, iObj)[1] = 0;
+            Vec_IntWriteEntry( p->vRemoved, Gia_ObjCioId(Gia_ManObj(p->pGia, iObj)) - Gia_ManPiNum(p->pGia), 1 );
+        }
+        // the candidates starting from the failing one get their values back
+        for ( k = iFirst; k < nCands; k++ )
+        {
+            iObj = Vec_IntEntry( p->vCands, iBeg + k );
+            Txs4_ManSetCi( p, iObj, Gia_ManObj(p->pGia, iObj)->Value, ~(word)0 );
+        }
+        iBeg += Abc_MinInt( iFirst + 1, nCands );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Shrinks values using word-parallel ternary simulation.]
+
+  Description [Produces the same result as Pdr_ManTernarySim(), while
+  evaluating up to 64 candidate flops at a time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Set_t * Txs4_ManTernarySim( Txs4_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Man_t * pMan = p->pMan;
+    Gia_Obj_t * pObj;
+    Pdr_Set_t * pRes;
+    word Res;
+    int i, iFlop, nPis = Gia_ManPiNum(p->pGia);
+    // collect CO objects
+    Vec_IntClear( p->vCoObjs );
+    if ( pCube == NULL ) // the target is the property output
+        Vec_IntPush( p->vCoObjs, Gia_ObjId(p->pGia, Gia_ManCo(p->pGia, pMan->iOutCur)) );
+    else // the target is the cube
+    {
+        for ( i = 0; i < pCube->nLits; i++ )
+        {
+            if ( pCube->Lits[i] == -1 )
+                continue;
+            pObj = Gia_ManCo( p->pGia, Gia_ManPoNum(p->pGia) + Abc_Lit2Var(pCube->Lits[i]) );
+            Vec_IntPush( p->vCoObjs, Gia_ObjId(p->pGia, pObj) );
+        }
+    }
+    // collect CI objects and their values
+    Txs4_ManCollectCone( p );
+    Pdr_ManCollectValues( pMan, k, p->vCiAigs, p->vCiVals );
+    Pdr_ManCollectValues( pMan, k, p->vCoAigs, p->vCoVals );
+    // set the CI values
+    Txs4_ManSetCi( p, 0, 0, ~(word)0 );
+    Gia_ManForEachObjVec( p->vCiObjs, p->pGia, pObj, i )
+    {
+        pObj->Value = Vec_IntEntry( p->vCiVals, i );
+        Txs4_ManSetCi( p, Gia_ObjId(p->pGia, pObj), pObj->Value, ~(word)0 );
+    }
+    Vec_IntClear( p->vDirty );
+    Res = Txs4_ManSimulate( p, p->vNodes );
+    assert( Res == ~(word)0 );
+    // order the flops in the same way as Pdr_ManTernarySim()
+    Vec_IntClear( p->vCands );
+    if ( pMan->pPars->fFlopPrio )
+    {
+        Vec_IntClear( p->vFfLits );
+        Gia_ManForEachObjVec( p->vCiObjs, p->pGia, pObj, i )
+            if ( Gia_ObjIsRo(p->pGia, pObj) )
+                Vec_IntPush( p->vFfLits, Gia_ObjCioId(pObj) - nPis );
+        Vec_IntSelectSortCost( Vec_IntArray(p->vFfLits), Vec_IntSize(p->vFfLits), p->vPrio );
+        Vec_IntForEachEntry( p->vFfLits, iFlop, i )
+            Vec_IntPush( p->vCands, Gia_ObjId(p->pGia, Gia_ManCi(p->pGia, nPis + iFlop)) );
+    }
+    else
+    {
+        Gia_ManForEachObjVec( p->vCiObjs, p->pGia, pObj, i )
+            if ( Gia_ObjIsRo(p->pGia, pObj) && !Vec_IntEntry(p->vPrio, Gia_ObjCioId(pObj) - nPis) )
+                Vec_IntPush( p->vCands, Gia_ObjId(p->pGia, pObj) );
+        Gia_ManForEachObjVec( p->vCiObjs, p->pGia, pObj, i )
+            if ( Gia_ObjIsRo(p->pGia, pObj) &&  Vec_IntEntry(p->vPrio, Gia_ObjCioId(pObj) - nPis) )
+                Vec_IntPush( p->vCands, Gia_ObjId(p->pGia, pObj) );
+    }
+    Txs4_ManFilterFlops( p );
+    Txs4_ManRemoveFlops( p );
+    // derive the set of resulting registers
+    Vec_IntClear( p->vPiLits );
+    Vec_IntClear( p->vFfLits );
+    Gia_ManForEachObjVec( p->vCiObjs, p->pGia, pObj, i )
+    {
+        if ( Gia_ObjIsPi(p->pGia, pObj) )
+        {
+            Vec_IntPush( p->vPiLits, Abc_Var2Lit(Gia_ObjCioId(pObj), Vec_IntEntry(p->vCiVals, i) == 0) );
+            continue;
+        }
+        iFlop = Gia_ObjCioId(pObj) - nPis;
+        if ( Vec_IntEntry(p->vRemoved, iFlop) )
+        {
+            Vec_IntWriteEntry( p->vRemoved, iFlop, 0 );
+            continue;
+        }
+        Vec_IntPush( p->vFfLits, Abc_Var2Lit(iFlop, Vec_IntEntry(p->vCiVals, i) == 0) );
+    }
+    if ( Vec_IntSize(p->vFfLits) == 0 )
+        Vec_IntPush( p->vFfLits, 0 );
+    // move abstracted literals from flops to inputs
+    if ( pMan->pPars->fUseAbs && pMan->vAbsFlops )
+    {
+        int iLit, j = 0;
+        Vec_IntForEachEntry( p->vFfLits, iLit, i )
+        {
+            if ( Vec_IntEntry(pMan->vAbsFlops, Abc_Lit2Var(iLit)) ) // used flop
+                Vec_IntWriteEntry( p->vFfLits, j++, iLit );
+            else
+                Vec_IntPush( p->vPiLits, 2*nPis + iLit );
+        }
+        Vec_IntShrink( p->vFfLits, j );
+    }
+    pRes = Pdr_SetCreate( p->vFfLits, p->vPiLits );
+    return pRes;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -593,7 +593,7 @@ int Ssw_ClassesPrepareRehash( Ssw_Cla_t * p, Vec_Ptr_t * vCands, int fConstCorr
   SeeAlso     []
 
 ***********************************************************************/
-Ssw_Cla_t * Ssw_ClassesPrepare( Aig_Man_t * pAig, int nFramesK, int fLatchCorr, int fConstCorr, int fOutputCorr, int nMaxLevs, int fVerbose )
+Ssw_Cla_t * Ssw_ClassesPrepare( Aig_Man_t * pAig, int nFramesK, int fLatchCorr, int fConstCorr, int fOutputCorr, int nMaxLevs, int nSimProcs, int fVerbose )
 {
 //    int nFrames =  4;
 //    int nWords  =  1;
@@ -619,7 +619,7 @@ Ssw_Cla_t * Ssw_ClassesPrepare( Aig_Man_t * pAig, int nFramesK, int fLatchCorr,
 
     // perform sequential simulation
 clk = Abc_Clock();
-    pSml = Ssw_SmlSimulateSeq( pAig, 0, nFrames, nWords );
+    pSml = Ssw_SmlSimulateSeqMt( pAig, 0, nFrames, nWords, nSimProcs );
 if ( fVerbose )
 {
     Abc_Print( 1, "Allocated %.2f MB to store simulation information.\n",
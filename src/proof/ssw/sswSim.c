@@ -27,7 +27,14 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SSW_SIM_PROC_MAX   64           // the max number of threads
+#define SSW_SIM_WORK_MIN   (1 << 13)    // steps with fewer words are simulated by the main thread
+
 // simulation manager
+// (the manager remains based on the AIG and 32-bit words rather than on the GIA,
+// because the equivalence classes, the islands, and the counter-example code
+// index the simulation info of the AIG objects in 32-bit words; the kernels
+// below process the same info in 64-bit words when the frame size is even)
 struct Ssw_Sml_t_
 {
     Aig_Man_t *      pAig;              // the original AIG manager
@@ -36,19 +43,93 @@ struct Ssw_Sml_t_
     int              nWordsFrame;       // the number of words in each timeframe
     int              nWordsTotal;       // the total number of words at a node
     int              nWordsPref;        // the number of word in the prefix
+    int              fWords64;          // the info can be processed in 64-bit words
+    int              nProcs;            // the number of threads used for simulation
     int              fNonConstOut;      // have seen a non-const-0 output during simulation
     int              nSimRounds;        // statistics
     abctime          timeSim;           // statistics
+    Vec_Int_t *      vNodes;            // the flat fanin data of the nodes
+    Vec_Int_t *      vLevels;           // the first node of each level in vNodes (if levelized)
+    Vec_Int_t *      vCos;              // the flat fanin data of the COs
+    Vec_Int_t *      vLiLos;            // the pairs of register inputs/outputs
     unsigned         pData[0];          // simulation data for the nodes
 };
 
 static inline unsigned * Ssw_ObjSim( Ssw_Sml_t * p, int Id )  { return p->pData + p->nWordsTotal * Id; }
 static inline unsigned   Ssw_ObjRandomSim()                   { return Aig_ManRandom(0);               }
 
+// one step of simulation of one timeframe shared by the threads
+typedef struct Ssw_SmlMt_t_ Ssw_SmlMt_t;
+struct Ssw_SmlMt_t_
+{
+    Ssw_Sml_t *      p;                 // the simulation manager
+    int              nThreads;          // the number of threads
+    int              Type;              // the type of the step (0 = nodes; 1 = COs; 2 = transfer)
+    int              iFrame;            // the timeframe
+    int              iStart;            // the first entry
+    int              iStop;             // the last entry plus one
+};
+
+// the data of one thread
+typedef struct Ssw_SmlMtTh_t_ Ssw_SmlMtTh_t;
+struct Ssw_SmlMtTh_t_
+{
+    Ssw_SmlMt_t *    pMt;               // the shared data
+    int              iThread;           // the thread number
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Simulation kernels.]
+
+  Description [If the number of words in a timeframe is even, the info
+  is processed in 64-bit words. The loops have no branches, so that the
+  compiler can vectorize them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Ssw_SmlSimAnd( Ssw_Sml_t * p, unsigned * pSims, unsigned * pSims0, unsigned * pSims1, int fCompl, int fCompl0, int fCompl1 )
+{
+    int i;
+    if ( p->fWords64 )
+    {
+        word * pSimsW = (word *)pSims, * pSimsW0 = (word *)pSims0, * pSimsW1 = (word *)pSims1;
+        word Diff = fCompl ? ~(word)0 : 0, Diff0 = fCompl0 ? ~(word)0 : 0, Diff1 = fCompl1 ? ~(word)0 : 0;
+        for ( i = 0; i < p->nWordsFrame / 2; i++ )
+            pSimsW[i] = ((pSimsW0[i] ^ Diff0) & (pSimsW1[i] ^ Diff1)) ^ Diff;
+    }
+    else
+    {
+        unsigned Diff = fCompl ? ~(unsigned)0 : 0, Diff0 = fCompl0 ? ~(unsigned)0 : 0, Diff1 = fCompl1 ? ~(unsigned)0 : 0;
+        for ( i = 0; i < p->nWordsFrame; i++ )
+            pSims[i] = ((pSims0[i] ^ Diff0) & (pSims1[i] ^ Diff1)) ^ Diff;
+    }
+}
+static inline void Ssw_SmlSimCopy( Ssw_Sml_t * p, unsigned * pSims, unsigned * pSims0, int fCompl0 )
+{
+    int i;
+    if ( p->fWords64 )
+    {
+        word * pSimsW = (word *)pSims, * pSimsW0 = (word *)pSims0;
+        word Diff0 = fCompl0 ? ~(word)0 : 0;
+        for ( i = 0; i < p->nWordsFrame / 2; i++ )
+            pSimsW[i] = pSimsW0[i] ^ Diff0;
+    }
+    else
+    {
+        unsigned Diff0 = fCompl0 ? ~(unsigned)0 : 0;
+        for ( i = 0; i < p->nWordsFrame; i++ )
+            pSims[i] = pSims0[i] ^ Diff0;
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes hash value of the node using its simulation info.]
@@ -83,6 +164,13 @@ unsigned Ssw_SmlObjHashWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
 //    assert( p->nWordsTotal <= 128 );
     uHash = 0;
     pSims = Ssw_ObjSim(p, pObj->Id);
+    if ( p->fWords64 )
+    {
+        word * pSimsW = (word *)pSims, uHashW = 0;
+        for ( i = p->nWordsPref / 2; i < p->nWordsTotal / 2; i++ )
+            uHashW ^= pSimsW[i] * s_SPrimes[i & 0x7F];
+        return (unsigned)(uHashW ^ (uHashW >> 32));
+    }
     for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
         uHash ^= pSims[i] * s_SPrimes[i & 0x7F];
     return uHash;
@@ -104,6 +192,14 @@ int Ssw_SmlObjIsConstWord( Ssw_Sml_t * p, Aig_Obj_t * pObj )
     unsigned * pSims;
     int i;
     pSims = Ssw_ObjSim(p, pObj->Id);
+    if ( p->fWords64 )
+    {
+        word * pSimsW = (word *)pSims;
+        for ( i = p->nWordsPref / 2; i < p->nWordsTotal / 2; i++ )
+            if ( pSimsW[i] )
+                return 0;
+        return 1;
+    }
     for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
         if ( pSims[i] )
             return 0;
@@ -127,6 +223,14 @@ int Ssw_SmlObjsAreEqualWord( Ssw_Sml_t * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1
     int i;
     pSims0 = Ssw_ObjSim(p, pObj0->Id);
     pSims1 = Ssw_ObjSim(p, pObj1->Id);
+    if ( p->fWords64 )
+    {
+        word * pSimsW0 = (word *)pSims0, * pSimsW1 = (word *)pSims1;
+        for ( i = p->nWordsPref / 2; i < p->nWordsTotal / 2; i++ )
+            if ( pSimsW0[i] != pSimsW1[i] )
+                return 0;
+        return 1;
+    }
     for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
         if ( pSims0[i] != pSims1[i] )
             return 0;
@@ -296,6 +400,14 @@ int Ssw_SmlNodeIsZero( Ssw_Sml_t * p, Aig_Obj_t * pObj )
     unsigned * pSims;
     int i;
     pSims = Ssw_ObjSim(p, pObj->Id);
+    if ( p->fWords64 )
+    {
+        word * pSimsW = (word *)pSims;
+        for ( i = p->nWordsPref / 2; i < p->nWordsTotal / 2; i++ )
+            if ( pSimsW[i] )
+                return 0;
+        return 1;
+    }
     for ( i = p->nWordsPref; i < p->nWordsTotal; i++ )
         if ( pSims[i] )
             return 0;
@@ -706,7 +818,6 @@ void Ssw_SmlAssignDist1Plus( Ssw_Sml_t * p, unsigned * pPat )
 void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
 {
     unsigned * pSims, * pSims0, * pSims1;
-    int fCompl, fCompl0, fCompl1, i;
     assert( iFrame < p->nFrames );
     assert( !Aig_IsComplement(pObj) );
     assert( Aig_ObjIsNode(pObj) );
@@ -715,47 +826,8 @@ void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
     pSims  = Ssw_ObjSim(p, pObj->Id) + p->nWordsFrame * iFrame;
     pSims0 = Ssw_ObjSim(p, Aig_ObjFanin0(pObj)->Id) + p->nWordsFrame * iFrame;
     pSims1 = Ssw_ObjSim(p, Aig_ObjFanin1(pObj)->Id) + p->nWordsFrame * iFrame;
-    // get complemented attributes of the children using their random info
-    fCompl  = pObj->fPhase;
-    fCompl0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj));
-    fCompl1 = Aig_ObjPhaseReal(Aig_ObjChild1(pObj));
-    // simulate
-    if ( fCompl0 && fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] | pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = ~(pSims0[i] | pSims1[i]);
-    }
-    else if ( fCompl0 && !fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] | ~pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (~pSims0[i] & pSims1[i]);
-    }
-    else if ( !fCompl0 && fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (~pSims0[i] | pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] & ~pSims1[i]);
-    }
-    else // if ( !fCompl0 && !fCompl1 )
-    {
-        if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = ~(pSims0[i] & pSims1[i]);
-        else
-            for ( i = 0; i < p->nWordsFrame; i++ )
-                pSims[i] = (pSims0[i] & pSims1[i]);
-    }
+    // use complemented attributes of the children using their random info
+    Ssw_SmlSimAnd( p, pSims, pSims0, pSims1, pObj->fPhase, Aig_ObjPhaseReal(Aig_ObjChild0(pObj)), Aig_ObjPhaseReal(Aig_ObjChild1(pObj)) );
 }
 
 /**Function*************************************************************
@@ -803,7 +875,6 @@ int Ssw_SmlNodesCompareInFrame( Ssw_Sml_t * p, Aig_Obj_t * pObj0, Aig_Obj_t * pO
 void Ssw_SmlNodeCopyFanin( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
 {
     unsigned * pSims, * pSims0;
-    int fCompl, fCompl0, i;
     assert( iFrame < p->nFrames );
     assert( !Aig_IsComplement(pObj) );
     assert( Aig_ObjIsCo(pObj) );
@@ -811,16 +882,8 @@ void Ssw_SmlNodeCopyFanin( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
     // get hold of the simulation information
     pSims  = Ssw_ObjSim(p, pObj->Id) + p->nWordsFrame * iFrame;
     pSims0 = Ssw_ObjSim(p, Aig_ObjFanin0(pObj)->Id) + p->nWordsFrame * iFrame;
-    // get complemented attributes of the children using their random info
-    fCompl  = pObj->fPhase;
-    fCompl0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj));
-    // copy information as it is
-    if ( fCompl0 )
-        for ( i = 0; i < p->nWordsFrame; i++ )
-            pSims[i] = ~pSims0[i];
-    else
-        for ( i = 0; i < p->nWordsFrame; i++ )
-            pSims[i] = pSims0[i];
+    // copy information using the complemented attribute of the child
+    Ssw_SmlSimCopy( p, pSims, pSims0, Aig_ObjPhaseReal(Aig_ObjChild0(pObj)) );
 }
 
 /**Function*************************************************************
@@ -837,7 +900,6 @@ void Ssw_SmlNodeCopyFanin( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
 void Ssw_SmlNodeTransferNext( Ssw_Sml_t * p, Aig_Obj_t * pOut, Aig_Obj_t * pIn, int iFrame )
 {
     unsigned * pSims0, * pSims1;
-    int i;
     assert( iFrame < p->nFrames );
     assert( !Aig_IsComplement(pOut) );
     assert( !Aig_IsComplement(pIn) );
@@ -848,8 +910,7 @@ void Ssw_SmlNodeTransferNext( Ssw_Sml_t * p, Aig_Obj_t * pOut, Aig_Obj_t * pIn,
     pSims0 = Ssw_ObjSim(p, pOut->Id) + p->nWordsFrame * iFrame;
     pSims1 = Ssw_ObjSim(p, pIn->Id) + p->nWordsFrame * (iFrame+1);
     // copy information as it is
-    for ( i = 0; i < p->nWordsFrame; i++ )
-        pSims1[i] = pSims0[i];
+    Ssw_SmlSimCopy( p, pSims1, pSims0, 0 );
 }
 
 /**Function*************************************************************
@@ -866,7 +927,6 @@ void Ssw_SmlNodeTransferNext( Ssw_Sml_t * p, Aig_Obj_t * pOut, Aig_Obj_t * pIn,
 void Ssw_SmlNodeTransferFirst( Ssw_Sml_t * p, Aig_Obj_t * pOut, Aig_Obj_t * pIn )
 {
     unsigned * pSims0, * pSims1;
-    int i;
     assert( !Aig_IsComplement(pOut) );
     assert( !Aig_IsComplement(pIn) );
     assert( Aig_ObjIsCo(pOut) );
@@ -876,8 +936,7 @@ void Ssw_SmlNodeTransferFirst( Ssw_Sml_t * p, Aig_Obj_t * pOut, Aig_Obj_t * pIn
     pSims0 = Ssw_ObjSim(p, pOut->Id) + p->nWordsFrame * (p->nFrames-1);
     pSims1 = Ssw_ObjSim(p, pIn->Id);
     // copy information as it is
-    for ( i = 0; i < p->nWordsFrame; i++ )
-        pSims1[i] = pSims0[i];
+    Ssw_SmlSimCopy( p, pSims1, pSims0, 0 );
 }
 
 
@@ -991,11 +1050,189 @@ int Ssw_SmlCheckNonConstOutputs( Ssw_Sml_t * p )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the flat representation of the AIG.]
+
+  Description [For each node, stores the node ID, the fanin IDs, and the
+  complemented attributes, which take the phases into account. If the
+  simulation is multi-threaded, the nodes are ordered by level, so that
+  the nodes of one level could be simulated concurrently. Otherwise, the
+  nodes are ordered by ID, which gives a better memory locality.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SmlPrepareFlat( Ssw_Sml_t * p, int fLevelize )
+{
+    Vec_Int_t * vObjLevels = NULL, * vCursor = NULL;
+    Aig_Obj_t * pObj, * pObjLi, * pObjLo;
+    int i, k, Level, nLevels = 0;
+    Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vLevels );
+    Vec_IntFreeP( &p->vCos );
+    Vec_IntFreeP( &p->vLiLos );
+    if ( fLevelize )
+    {
+        // compute levels and the first node of each level
+        vObjLevels = Vec_IntStart( Aig_ManObjNumMax(p->pAig) );
+        Aig_ManForEachNode( p->pAig, pObj, i )
+        {
+            Level = 1 + Abc_MaxInt( Vec_IntEntry(vObjLevels, Aig_ObjFaninId0(pObj)), Vec_IntEntry(vObjLevels, Aig_ObjFaninId1(pObj)) );
+            Vec_IntWriteEntry( vObjLevels, i, Level );
+            nLevels = Abc_MaxInt( nLevels, Level );
+        }
+        p->vLevels = Vec_IntStart( nLevels + 2 );
+        Aig_ManForEachNode( p->pAig, pObj, i )
+            Vec_IntAddToEntry( p->vLevels, Vec_IntEntry(vObjLevels, i) + 1, 1 );
+        for ( k = 1; k < Vec_IntSize(p->vLevels); k++ )
+            Vec_IntAddToEntry( p->vLevels, k, Vec_IntEntry(p->vLevels, k-1) );
+        vCursor = Vec_IntDup( p->vLevels );
+    }
+    p->vNodes = Vec_IntStart( 4 * Aig_ManNodeNum(p->pAig) );
+    k = 0;
+    Aig_ManForEachNode( p->pAig, pObj, i )
+    {
+        int * pEntry = Vec_IntEntryP( p->vNodes, 4 * (fLevelize ? Vec_IntAddToEntry(vCursor, Vec_IntEntry(vObjLevels, i), 1) - 1 : k++) );
+        pEntry[0] = i;
+        pEntry[1] = Aig_ObjFaninId0(pObj);
+        pEntry[2] = Aig_ObjFaninId1(pObj);
+        pEntry[3] = pObj->fPhase | (Aig_ObjPhaseReal(Aig_ObjChild0(pObj)) << 1) | (Aig_ObjPhaseReal(Aig_ObjChild1(pObj)) << 2);
+    }
+    p->vCos = Vec_IntAlloc( 3 * Aig_ManCoNum(p->pAig) );
+    Aig_ManForEachCo( p->pAig, pObj, i )
+    {
+        Vec_IntPush( p->vCos, pObj->Id );
+        Vec_IntPush( p->vCos, Aig_ObjFaninId0(pObj) );
+        Vec_IntPush( p->vCos, Aig_ObjPhaseReal(Aig_ObjChild0(pObj)) );
+    }
+    p->vLiLos = Vec_IntAlloc( 2 * Aig_ManRegNum(p->pAig) );
+    Saig_ManForEachLiLo( p->pAig, pObjLi, pObjLo, i )
+    {
+        Vec_IntPush( p->vLiLos, pObjLi->Id );
+        Vec_IntPush( p->vLiLos, pObjLo->Id );
+    }
+    Vec_IntFreeP( &vObjLevels );
+    Vec_IntFreeP( &vCursor );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the range of entries of one step.]
+
+  Description [The step simulates the nodes (Type = 0), copies the info
+  into the COs (Type = 1), or transfers the info from the register inputs
+  into the register outputs of the next timeframe (Type = 2).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SmlSimulateRange( Ssw_Sml_t * p, int Type, int iFrame, int iStart, int iStop )
+{
+    int i, * pEntry, Offset = p->nWordsFrame * iFrame;
+    if ( Type == 0 )
+    {
+        for ( i = iStart; i < iStop; i++ )
+        {
+            pEntry = Vec_IntEntryP( p->vNodes, 4 * i );
+            Ssw_SmlSimAnd( p, Ssw_ObjSim(p, pEntry[0]) + Offset, Ssw_ObjSim(p, pEntry[1]) + Offset, Ssw_ObjSim(p, pEntry[2]) + Offset,
+                pEntry[3] & 1, (pEntry[3] >> 1) & 1, pEntry[3] >> 2 );
+        }
+    }
+    else if ( Type == 1 )
+    {
+        for ( i = iStart; i < iStop; i++ )
+        {
+            pEntry = Vec_IntEntryP( p->vCos, 3 * i );
+            Ssw_SmlSimCopy( p, Ssw_ObjSim(p, pEntry[0]) + Offset, Ssw_ObjSim(p, pEntry[1]) + Offset, pEntry[2] );
+        }
+    }
+    else
+    {
+        for ( i = iStart; i < iStop; i++ )
+        {
+            pEntry = Vec_IntEntryP( p->vLiLos, 2 * i );
+            Ssw_SmlSimCopy( p, Ssw_ObjSim(p, pEntry[1]) + Offset + p->nWordsFrame, Ssw_ObjSim(p, pEntry[0]) + Offset, 0 );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the share of the current step assigned to the thread.]
+
+  Description [The entries of the step are divided into contiguous ranges.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SmlSimulateSlice( Ssw_SmlMtTh_t * pTh, int nThreads )
+{
+    Ssw_SmlMt_t * pMt = pTh->pMt;
+    int nEntries = pMt->iStop - pMt->iStart;
+    int iStart = pMt->iStart + (int)((word)nEntries * pTh->iThread / nThreads);
+    int iStop  = pMt->iStart + (int)((word)nEntries * (pTh->iThread + 1) / nThreads);
+    Ssw_SmlSimulateRange( pMt->p, pMt->Type, pMt->iFrame, iStart, iStop );
+}
+
+int Ssw_SmlSimulateTask( void * pArg )
+{
+    Ssw_SmlMtTh_t * pTh = (Ssw_SmlMtTh_t *)pArg;
+    Ssw_SmlSimulateSlice( pTh, pTh->pMt->nThreads );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one step of simulation.]
+
+  Description [Small steps are performed by the main thread. Otherwise,
+  the other shares are submitted to the thread pool, while the main thread
+  simulates the first share.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SmlSimulateStep( Ssw_SmlMtTh_t * pThData, int Type, int iFrame, int iStart, int iStop )
+{
+    Ssw_SmlMt_t * pMt = pThData->pMt;
+    pMt->Type   = Type;
+    pMt->iFrame = iFrame;
+    pMt->iStart = iStart;
+    pMt->iStop  = iStop;
+    if ( pMt->nThreads > 1 && (iStop - iStart) * pMt->p->nWordsFrame >= SSW_SIM_WORK_MIN )
+    {
+        Util_Task_t * pTasks[SSW_SIM_PROC_MAX];
+        int i;
+        for ( i = 1; i < pMt->nThreads; i++ )
+            pTasks[i] = Util_TaskSubmit( Ssw_SmlSimulateTask, (void *)(pThData + i), 0 );
+        Ssw_SmlSimulateSlice( pThData, pMt->nThreads );
+        for ( i = 1; i < pMt->nThreads; i++ )
+        {
+            Util_TaskWait( pTasks[i] );
+            Util_TaskFree( pTasks[i] );
+        }
+        return;
+    }
+    Ssw_SmlSimulateSlice( pThData, 1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Simulates AIG manager.]
 
-  Description [Assumes that the PI simulation info is attached.]
+  Description [Assumes that the PI simulation info is attached. Uses the
+  flat representation of the AIG. If several threads are used, the nodes
+  of each level are simulated concurrently. The result does not depend on
+  the number of threads.]
 
   SideEffects []
 
@@ -1004,27 +1241,39 @@ int Ssw_SmlCheckNonConstOutputs( Ssw_Sml_t * p )
 ***********************************************************************/
 void Ssw_SmlSimulateOne( Ssw_Sml_t * p )
 {
-    Aig_Obj_t * pObj, * pObjLi, * pObjLo;
-    int f, i;
+    Ssw_SmlMt_t Mt, * pMt = &Mt;
+    Ssw_SmlMtTh_t ThData[SSW_SIM_PROC_MAX];
+    int f, i, nThreads = Abc_MinInt( Abc_MaxInt(p->nProcs, 1), SSW_SIM_PROC_MAX );
     abctime clk;
 clk = Abc_Clock();
+    if ( p->vNodes == NULL || 4 * Aig_ManNodeNum(p->pAig) != Vec_IntSize(p->vNodes) || (nThreads > 1) != (p->vLevels != NULL) )
+        Ssw_SmlPrepareFlat( p, nThreads > 1 );
+    memset( pMt, 0, sizeof(Ssw_SmlMt_t) );
+    pMt->p        = p;
+    pMt->nThreads = nThreads;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pMt     = pMt;
+        ThData[i].iThread = i;
+    }
+    // the pool threads are started once and reused by all calls
+    if ( nThreads > 1 )
+        Util_PoolReserve( nThreads - 1 );
     for ( f = 0; f < p->nFrames; f++ )
     {
         // simulate the nodes
-        Aig_ManForEachNode( p->pAig, pObj, i )
-            Ssw_SmlNodeSimulate( p, pObj, f );
-        // copy simulation info into outputs
-        Saig_ManForEachPo( p->pAig, pObj, i )
-            Ssw_SmlNodeCopyFanin( p, pObj, f );
-        // copy simulation info into outputs
-        Saig_ManForEachLi( p->pAig, pObj, i )
-            Ssw_SmlNodeCopyFanin( p, pObj, f );
+        if ( p->vLevels )
+            for ( i = 1; i + 1 < Vec_IntSize(p->vLevels); i++ )
+                Ssw_SmlSimulateStep( ThData, 0, f, Vec_IntEntry(p->vLevels, i), Vec_IntEntry(p->vLevels, i+1) );
+        else
+            Ssw_SmlSimulateStep( ThData, 0, f, 0, Vec_IntSize(p->vNodes) / 4 );
+        // copy simulation info into the outputs
+        Ssw_SmlSimulateStep( ThData, 1, f, 0, Vec_IntSize(p->vCos) / 3 );
         // quit if this is the last timeframe
         if ( f == p->nFrames - 1 )
             break;
         // copy simulation info into the inputs
-        Saig_ManForEachLiLo( p->pAig, pObjLi, pObjLo, i )
-            Ssw_SmlNodeTransferNext( p, pObjLi, pObjLo, f );
+        Ssw_SmlSimulateStep( ThData, 2, f, 0, Vec_IntSize(p->vLiLos) / 2 );
     }
 p->timeSim += Abc_Clock() - clk;
 p->nSimRounds++;
@@ -1156,9 +1405,27 @@ Ssw_Sml_t * Ssw_SmlStart( Aig_Man_t * pAig, int nPref, int nFrames, int nWordsFr
     p->nWordsFrame = nWordsFrame;
     p->nWordsTotal = (nPref + nFrames) * nWordsFrame;
     p->nWordsPref  = nPref * nWordsFrame;
+    p->fWords64    = (nWordsFrame % 2 == 0) && ((ABC_PTRUINT_T)p->pData % sizeof(word) == 0);
+    p->nProcs      = 1;
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Sets the number of threads used for simulation.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SmlSetThreads( Ssw_Sml_t * p, int nProcs )
+{
+    p->nProcs = Abc_MaxInt( nProcs, 1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Allocates simulation manager.]
@@ -1210,6 +1477,10 @@ Vec_Ptr_t * Ssw_SmlSimDataPointers( Ssw_Sml_t * p )
 ***********************************************************************/
 void Ssw_SmlStop( Ssw_Sml_t * p )
 {
+    Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vLevels );
+    Vec_IntFreeP( &p->vCos );
+    Vec_IntFreeP( &p->vLiLos );
     ABC_FREE( p );
 }
 
@@ -1246,9 +1517,14 @@ Ssw_Sml_t * Ssw_SmlSimulateComb( Aig_Man_t * pAig, int nWords )
 
 ***********************************************************************/
 Ssw_Sml_t * Ssw_SmlSimulateSeq( Aig_Man_t * pAig, int nPref, int nFrames, int nWords )
+{
+    return Ssw_SmlSimulateSeqMt( pAig, nPref, nFrames, nWords, 1 );
+}
+Ssw_Sml_t * Ssw_SmlSimulateSeqMt( Aig_Man_t * pAig, int nPref, int nFrames, int nWords, int nProcs )
 {
     Ssw_Sml_t * p;
     p = Ssw_SmlStart( pAig, nPref, nFrames, nWords );
+    Ssw_SmlSetThreads( p, nProcs );
     Ssw_SmlInitialize( p, 1 );
     Ssw_SmlSimulateOne( p );
     p->fNonConstOut = Ssw_SmlCheckNonConstOutputs( p );
@@ -29,6 +29,17 @@
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 static inline void Bmc3_CadicalSetRuntimeLimit( cadical_solver * pSat4, abctime nSeconds )
@@ -1370,6 +1381,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nPisAbstract   =     0;    // the number of PIs to abstract
     p->fSolveAll      =     0;    // stops on the first SAT instance
     p->fDropSatOuts   =     0;    // replace sat outputs by constant 0
+    p->nProcs         =     1;    // the number of threads solving groups of outputs
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
@@ -1484,6 +1496,49 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the next timeframe to the unrolling.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcAddFrame( Gia_ManBmc_t * p, int f )
+{
+    Aig_Obj_t * pObj;
+    unsigned * pInfo;
+    int i;
+    Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
+    Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
+/*
+    // cannot remove mapping of frame values for any timeframes
+    // because with constant propagation they may be needed arbitrarily far
+    if ( f > 2*Vec_VecSize(p->vSects) )
+    {
+        int iFrameOld = f - 2*Vec_VecSize( p->vSects );
+        void * pMemory = Vec_IntReleaseArray( Vec_PtrEntry(p->vId2Var, iFrameOld) );
+        ABC_FREE( pMemory );
+    } 
+*/
+    // prepare some nodes
+    Saig_ManBmcSetLiteral( p, Aig_ManConst1(p->pAig), f, 1 );
+    Saig_ManBmcSimInfoSet( pInfo, Aig_ManConst1(p->pAig), SAIG_TER_ONE );
+    Saig_ManForEachPi( p->pAig, pObj, i )
+        Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_UND );
+    if ( f == 0 )
+    {
+        Saig_ManForEachLo( p->pAig, pObj, i )
+        {
+            Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
+            Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
+        }
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1501,13 +1556,14 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     Aig_Obj_t * pObj;
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
-    unsigned * pInfo;
     int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
     int i, f, k, Lit, status;
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
+    if ( pPars->nProcs > 1 )
+        return Saig_ManBmcScalablePar( pAig, pPars );
     if ( pPars->pLogFileName )
         pLogFile = fopen( pPars->pLogFileName, "wb" );
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
@@ -1595,31 +1651,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         if ( (RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 && !nJumpFrame )
             pPars->iFrame = f-1;
         // map nodes of this section
-        Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
-        Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
-/*
-        // cannot remove mapping of frame values for any timeframes
-        // because with constant propagation they may be needed arbitrarily far
-        if ( f > 2*Vec_VecSize(p->vSects) )
-        {
-            int iFrameOld = f - 2*Vec_VecSize( p->vSects );
-            void * pMemory = Vec_IntReleaseArray( Vec_PtrEntry(p->vId2Var, iFrameOld) );
-            ABC_FREE( pMemory );
-        } 
-*/
-        // prepare some nodes
-        Saig_ManBmcSetLiteral( p, Aig_ManConst1(pAig), f, 1 );
-        Saig_ManBmcSimInfoSet( pInfo, Aig_ManConst1(pAig), SAIG_TER_ONE );
-        Saig_ManForEachPi( pAig, pObj, i )
-            Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_UND );
-        if ( f == 0 )
-        {
-            Saig_ManForEachLo( p->pAig, pObj, i )
-            {
-                Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
-                Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
-            }
-        }
+        Saig_ManBmcAddFrame( p, f );
         if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
             continue;
         // create CNF upfront
@@ -1671,7 +1703,7 @@ clkOther += Abc_Clock() - clk2;
                     Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
                 goto finish;
             }
-            if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+            if ( (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) || Util_TaskStop() )
             {
                 if ( !pPars->fSilent )
                     Abc_Print( 1, "Bmc3 got callbacks.\n" );
@@ -1948,6 +1980,589 @@ finish:
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the sequential cone of the output.]
+
+  Description [Similar to Saig_ManBmcSections(), the cone is extended
+  through the register outputs to the register inputs until no new logic
+  is added.  Collects the IDs of the internal nodes and register outputs,
+  that is, the logic unrolled when solving the output.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcSeqCone_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Int_t * vCone, Vec_Ptr_t * vRoots )
+{
+    if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(p, pObj);
+    if ( Aig_ObjIsNode(pObj) )
+    {
+        Saig_ManBmcSeqCone_rec( p, Aig_ObjFanin0(pObj), vCone, vRoots );
+        Saig_ManBmcSeqCone_rec( p, Aig_ObjFanin1(pObj), vCone, vRoots );
+    }
+    else if ( Saig_ObjIsLo(p, pObj) )
+        Vec_PtrPush( vRoots, Saig_ObjLoToLi(p, pObj) );
+    else
+        return;
+    Vec_IntPush( vCone, Aig_ObjId(pObj) );
+}
+void Saig_ManBmcSeqCone( Aig_Man_t * p, Aig_Obj_t * pObjPo, Vec_Int_t * vCone, Vec_Ptr_t * vRoots )
+{
+    int i;
+    Vec_IntClear( vCone );
+    Vec_PtrClear( vRoots );
+    Aig_ManIncrementTravId( p );
+    Aig_ObjSetTravIdCurrent( p, Aig_ManConst1(p) );
+    Vec_PtrPush( vRoots, pObjPo );
+    for ( i = 0; i < Vec_PtrSize(vRoots); i++ )
+        Saig_ManBmcSeqCone_rec( p, Aig_ObjFanin0((Aig_Obj_t *)Vec_PtrEntry(vRoots, i)), vCone, vRoots );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the outputs into groups for the workers.]
+
+  Description [Each output is added to the group that already contains
+  the largest part of its sequential cone, so that the outputs sharing
+  logic are unrolled and solved by the same worker.  The cost of a group
+  is the total size of the cones of its outputs (the solving effort) 
+  plus the number of different objects in them (the unrolling effort).
+  An output goes to another group if the best one would exceed its fair
+  share of the total cost, and to the cheapest group if it shares no
+  logic with any of them.  Empty groups are removed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Saig_ManBmcPartitionOutputs( Aig_Man_t * p, int nParts )
+{
+    Vec_Wec_t * vGroups;
+    Vec_Wrd_t * vMasks  = Vec_WrdStart( Aig_ManObjNumMax(p) );
+    Vec_Int_t * vCone   = Vec_IntAlloc( 1000 );
+    Vec_Ptr_t * vRoots  = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vSizes  = Vec_IntAlloc( Saig_ManPoNum(p) );
+    double Costs[64] = {0}, Total = 0, Limit, Add;
+    int Overlaps[64];
+    Aig_Obj_t * pObj;
+    int i, k, g, iObj, iBest;
+    assert( nParts >= 1 && nParts <= 64 );
+    nParts = Abc_MinInt( nParts, Saig_ManPoNum(p) );
+    // estimate the total cost
+    Saig_ManForEachPo( p, pObj, i )
+    {
+        Saig_ManBmcSeqCone( p, pObj, vCone, vRoots );
+        Vec_IntPush( vSizes, Vec_IntSize(vCone) + 1 );
+        Total += Vec_IntSize(vCone) + 1;
+        Vec_IntForEachEntry( vCone, iObj, k )
+            if ( !Vec_WrdEntry(vMasks, iObj) )
+                Vec_WrdWriteEntry( vMasks, iObj, 1 ), Total++;
+    }
+    Limit = Total / nParts;
+    Vec_WrdFill( vMasks, Aig_ManObjNumMax(p), 0 );
+    // assign the outputs
+    vGroups = Vec_WecStart( nParts );
+    Saig_ManForEachPo( p, pObj, i )
+    {
+        Saig_ManBmcSeqCone( p, pObj, vCone, vRoots );
+        for ( g = 0; g < nParts; g++ )
+            Overlaps[g] = 0;
+        Vec_IntForEachEntry( vCone, iObj, k )
+        {
+            word Mask = Vec_WrdEntry( vMasks, iObj );
+            for ( g = 0; Mask && g < nParts; g++ )
+                Overlaps[g] += (int)((Mask >> g) & 1);
+        }
+        // the group with the largest overlap among those within the limit
+        iBest = -1;
+        for ( g = 0; g < nParts; g++ )
+        {
+            Add = Vec_IntEntry(vSizes, i) + Vec_IntSize(vCone) - Overlaps[g];
+            if ( Overlaps[g] == 0 || Costs[g] + Add > Limit )
+                continue;
+            if ( iBest == -1 || Overlaps[g] > Overlaps[iBest] || (Overlaps[g] == Overlaps[iBest] && Costs[g] < Costs[iBest]) )
+                iBest = g;
+        }
+        // otherwise, the cheapest group
+        if ( iBest == -1 )
+            for ( g = 0; g < nParts; g++ )
+                if ( iBest == -1 || Costs[g] < Costs[iBest] )
+                    iBest = g;
+        Costs[iBest] += Vec_IntEntry(vSizes, i) + Vec_IntSize(vCone) - Overlaps[iBest];
+        Vec_IntForEachEntry( vCone, iObj, k )
+            *Vec_WrdEntryP( vMasks, iObj ) |= (word)1 << iBest;
+        Vec_WecPush( vGroups, iBest, i );
+    }
+    Vec_WecRemoveEmpty( vGroups );
+    Vec_WrdFree( vMasks );
+    Vec_IntFree( vCone );
+    Vec_PtrFree( vRoots );
+    Vec_IntFree( vSizes );
+    return vGroups;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking engine with concurrent workers.]
+
+  Description [The outputs are partitioned into groups, one for each 
+  worker.  Each worker unrolls its own copy of the AIG and solves its 
+  outputs frame by frame, in the same way as Saig_ManBmcScalable().
+  All workers stop as soon as a counter-example is found (unless all 
+  outputs are solved), or when the runtime limit is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    int RetValue, nProcs = pPars->nProcs;
+    pPars->nProcs = 1;
+    RetValue = Saig_ManBmcScalable( pAig, pPars );
+    pPars->nProcs = nProcs;
+    return RetValue;
+}
+
+#else // pthreads are used
+
+#define BMC3_PAR_THR_MAX 64
+
+// the data shared by the workers
+typedef struct Bmc3_ParShare_t_ Bmc3_ParShare_t;
+struct Bmc3_ParShare_t_
+{
+    pthread_mutex_t   Mutex;          // protects the data below
+    Saig_ParBmc_t *   pPars;          // parameters of the caller
+    Abc_Cex_t *       pCex;           // the first counter-example
+    abctime           nTimeToStopNG;  // the runtime limit
+    abctime           timeLastSolved; // the time when the last output was solved
+    int               nOutDigits;     // the number of digits in the output number
+    volatile int      fStop;          // the workers should stop
+    Util_Task_t *     pToken;         // cancels the workers
+};
+
+// the data of one worker
+typedef struct Bmc3_ParThData_t_ Bmc3_ParThData_t;
+struct Bmc3_ParThData_t_
+{
+    Bmc3_ParShare_t * pShare;         // shared data
+    Saig_ParBmc_t     Pars;           // parameters of this worker
+    Aig_Man_t *       pAig;           // the copy of the AIG
+    Gia_ManBmc_t *    pMan;           // the BMC manager of this worker
+    Vec_Int_t *       vOuts;          // the outputs solved by this worker
+    int               iFrame;         // the last completed frame
+    int               fExplored;      // all reachable states are visited
+    int               fFinished;      // all outputs are solved or timed out
+    int               fTimeout;       // the runtime limit is reached
+    double            nConfs;         // the number of conflicts
+    abctime           clkTotal;       // the runtime of this worker
+};
+
+// the workers run under the token of the run, which is cancelled by Saig_ManBmcParStopAll();
+// the callback of the caller is found in the parameters of the worker run by this thread
+static int Saig_ManBmcParCallBackToStop( int RunId )
+{
+    Bmc3_ParThData_t * pThData = (Bmc3_ParThData_t *)Util_TaskArg();
+    if ( Util_TaskStop() )
+        return 1;
+    return pThData && pThData->Pars.pFuncStop && pThData->Pars.pFuncStop( pThData->Pars.RunId );
+}
+static void Saig_ManBmcParStopAll( Bmc3_ParShare_t * pShare )
+{
+    if ( pShare->fStop )
+        return;
+    pShare->fStop = 1;
+    Util_TaskCancel( pShare->pToken );
+}
+static abctime Saig_ManBmcParTimeToStop( Bmc3_ParShare_t * pShare )
+{
+    abctime nTimeToStop = pShare->nTimeToStopNG, nTimeToStopGap;
+    int status;
+    if ( pShare->pPars->nTimeOutGap == 0 )
+        return nTimeToStop;
+    status = pthread_mutex_lock( &pShare->Mutex );  assert( status == 0 );
+    nTimeToStopGap = pShare->timeLastSolved + pShare->pPars->nTimeOutGap * CLOCKS_PER_SEC;
+    status = pthread_mutex_unlock( &pShare->Mutex );  assert( status == 0 );
+    return nTimeToStop ? Abc_MinWord( nTimeToStop, nTimeToStopGap ) : nTimeToStopGap;
+}
+static void Saig_ManBmcParSetRuntimeLimit( Gia_ManBmc_t * p, abctime nTimeToStop )
+{
+    if ( p->pSat2 )
+        satoko_set_runtime_limit( p->pSat2, nTimeToStop );
+    else if ( p->pSat3 )
+        bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
+    else if ( p->pSat4 )
+        Bmc3_CadicalSetRuntimeLimit( p->pSat4, nTimeToStop );
+    else
+        sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
+}
+static int Saig_ManBmcParLitValue( Gia_ManBmc_t * p, int Lit )
+{
+    int Value;
+    if ( p->pSat2 )
+        Value = satoko_read_cex_varvalue( p->pSat2, lit_var(Lit) );
+    else if ( p->pSat3 )
+        Value = bmcg_sat_solver_read_cex_varvalue( p->pSat3, lit_var(Lit) );
+    else if ( p->pSat4 )
+        Value = cadical_solver_get_var_value( p->pSat4, lit_var(Lit) );
+    else
+        Value = sat_solver_var_value( p->pSat, lit_var(Lit) );
+    return Value ^ Abc_LitIsCompl(Lit);
+}
+static void Saig_ManBmcParAddUnit( Gia_ManBmc_t * p, int Lit )
+{
+    int k, status;
+    if ( p->pSat2 )
+        status = satoko_add_clause( p->pSat2, &Lit, 1 );
+    else if ( p->pSat3 )
+        status = bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
+    else if ( p->pSat4 )
+        status = cadical_solver_addclause( p->pSat4, &Lit, &Lit + 1 );
+    else
+        status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+    assert( status );
+    if ( p->pSat == NULL )
+        return;
+    // add learned units
+    for ( k = 0; k < veci_size(&p->pSat->unit_lits); k++ )
+    {
+        Lit = veci_begin(&p->pSat->unit_lits)[k];
+        status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+        assert( status );
+    }
+    veci_resize(&p->pSat->unit_lits, 0);
+    sat_solver_compress( p->pSat );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the output asserted when solving all outputs.]
+
+  Description [Takes the ownership of the counter-example.  Returns 1 
+  if the caller requested to stop.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcParRecordFail( Bmc3_ParThData_t * pThData, Gia_ManBmc_t * p, Abc_Cex_t * pCex, int iOut, int f )
+{
+    Bmc3_ParShare_t * pShare = pThData->pShare;
+    Saig_ParBmc_t * pPars = pShare->pPars;
+    int nPos = Saig_ManPoNum(pThData->pAig), fQuit = 0, status;
+    Vec_PtrWriteEntry( p->vCexes, iOut, pPars->fStoreCex ? pCex : (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+    status = pthread_mutex_lock( &pShare->Mutex );  assert( status == 0 );
+    pPars->nFailOuts++;
+    if ( !pPars->fNotVerbose )
+        Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
+            pShare->nOutDigits, iOut, f, pShare->nOutDigits, pPars->nFailOuts, pShare->nOutDigits, nPos );
+    pShare->timeLastSolved = Abc_Clock();
+    if ( pPars->pFuncOnFail && pPars->pFuncOnFail(iOut, pPars->fStoreCex ? pCex : NULL) )
+    {
+        if ( !pShare->fStop )
+            Abc_Print( 1, "Quitting due to callback on fail.\n" );
+        Saig_ManBmcParStopAll( pShare );
+        fQuit = 1;
+    }
+    status = pthread_mutex_unlock( &pShare->Mutex );  assert( status == 0 );
+    if ( !pPars->fStoreCex )
+        Abc_CexFree( pCex );
+    return fQuit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of one group.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcParWorker( void * pArg )
+{
+    Bmc3_ParThData_t * pThData = (Bmc3_ParThData_t *)pArg;
+    Bmc3_ParShare_t * pShare = pThData->pShare;
+    Saig_ParBmc_t * pPars = &pThData->Pars;
+    Aig_Man_t * pAig = pThData->pAig;
+    Gia_ManBmc_t * p = pThData->pMan;
+    Abc_Cex_t * pCex, * pCexDup;
+    abctime nTimeToStop, clkOne = 0, clkTotal = Abc_Clock();
+    int f, i, k, iOut, iOut2, Lit, status, nSolved = 0;
+    if ( p->pSat )
+    {
+        p->pSat->nLearntStart = pPars->nLearnedStart;
+        p->pSat->nLearntDelta = pPars->nLearnedDelta;
+        p->pSat->nLearntRatio = pPars->nLearnedPerce;
+        p->pSat->nLearntMax   = p->pSat->nLearntStart;
+        p->pSat->fNoRestarts  = pPars->fNoRestarts;
+        p->pSat->pFuncStop    = Saig_ManBmcParCallBackToStop;
+    }
+    else if ( p->pSat2 )
+    {
+        satoko_set_stop_func( p->pSat2, Saig_ManBmcParCallBackToStop );
+    }
+    for ( f = 0; f < pPars->nFramesMax; f++ )
+    {
+        // stop BMC after exploring all reachable states
+        if ( Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
+        {
+            pThData->fExplored = 1;
+            break;
+        }
+        // stop BMC if all outputs of this group are solved
+        if ( nSolved == Vec_IntSize(pThData->vOuts) )
+        {
+            pThData->fFinished = 1;
+            break;
+        }
+        Saig_ManBmcAddFrame( p, f );
+        if ( pPars->nStart && f < pPars->nStart )
+            continue;
+        Vec_IntForEachEntry( pThData->vOuts, iOut, i )
+        {
+            if ( Saig_ManBmcParCallBackToStop(0) )
+                goto finish;
+            nTimeToStop = Saig_ManBmcParTimeToStop( pShare );
+            if ( nTimeToStop && Abc_Clock() > nTimeToStop )
+            {
+                pThData->fTimeout = 1;
+                goto finish;
+            }
+            // skip solved outputs and outputs whose time has run out
+            if ( Vec_PtrEntry(p->vCexes, iOut) || (p->pTime4Outs && p->pTime4Outs[iOut] == 0) )
+                continue;
+            Lit = Saig_ManBmcCreateCnf( p, Aig_ManCo(pAig, iOut), f );
+            if ( p->pSat ) sat_solver_compress( p->pSat );
+            if ( p->pTime4Outs )
+            {
+                clkOne = Abc_Clock();
+                Saig_ManBmcParSetRuntimeLimit( p, p->pTime4Outs[iOut] + Abc_Clock() );
+            }
+            else
+                Saig_ManBmcParSetRuntimeLimit( p, nTimeToStop );
+            status = Saig_ManCallSolver( p, Lit );
+            if ( p->pTime4Outs )
+            {
+                abctime timeSince = Abc_Clock() - clkOne;
+                p->pTime4Outs[iOut] = (p->pTime4Outs[iOut] > timeSince) ? p->pTime4Outs[iOut] - timeSince : 0;
+                if ( p->pTime4Outs[iOut] == 0 && status != l_True )
+                    pPars->nDropOuts++, nSolved++;
+            }
+            if ( status == l_False )
+            {
+                if ( Lit != 0 )
+                    Saig_ManBmcParAddUnit( p, lit_neg(Lit) );
+            }
+            else if ( status == l_True )
+            {
+                pCex = Saig_ManGenerateCex( p, f, iOut );
+                if ( !pPars->fSolveAll )
+                {
+                    status = pthread_mutex_lock( &pShare->Mutex );  assert( status == 0 );
+                    if ( pShare->pCex == NULL )
+                        pShare->pCex = pCex, pCex = NULL;
+                    Saig_ManBmcParStopAll( pShare );
+                    status = pthread_mutex_unlock( &pShare->Mutex );  assert( status == 0 );
+                    Abc_CexFreeP( &pCex );
+                    goto finish;
+                }
+                nSolved++;
+                // check if other outputs of this group failed under the same counter-example
+                Vec_IntForEachEntry( pThData->vOuts, iOut2, k )
+                {
+                    if ( iOut2 == iOut || Vec_PtrEntry(p->vCexes, iOut2) || (p->pTime4Outs && p->pTime4Outs[iOut2] == 0) )
+                        continue;
+                    Lit = Saig_ManBmcCreateCnf( p, Aig_ManCo(pAig, iOut2), f );
+                    if ( Lit == 0 || (Lit > 1 && !Saig_ManBmcParLitValue(p, Lit)) )
+                        continue;
+                    pCexDup = Abc_CexDup( pCex, Saig_ManRegNum(pAig) );
+                    pCexDup->iPo = iOut2;
+                    nSolved++;
+                    if ( Saig_ManBmcParRecordFail( pThData, p, pCexDup, iOut2, f ) )
+                    {
+                        Abc_CexFree( pCex );
+                        goto finish;
+                    }
+                }
+                if ( Saig_ManBmcParRecordFail( pThData, p, pCex, iOut, f ) )
+                    goto finish;
+            }
+            else if ( p->pTime4Outs == NULL )
+            {
+                pThData->fTimeout = (nTimeToStop && Abc_Clock() > nTimeToStop);
+                goto finish;
+            }
+        }
+        pThData->iFrame = f;
+    }
+finish:
+    if ( p->pSat )
+        pThData->nConfs = (double)p->pSat->stats.conflicts;
+    else if ( p->pSat2 )
+        pThData->nConfs = (double)satoko_conflictnum(p->pSat2);
+    else if ( p->pSat3 )
+        pThData->nConfs = (double)bmcg_sat_solver_conflictnum(p->pSat3);
+    else
+        pThData->nConfs = (double)cadical_solver_nconflicts(p->pSat4);
+    pThData->clkTotal = Abc_Clock() - clkTotal;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Bmc3_ParThData_t ThData[BMC3_PAR_THR_MAX];
+    Util_Task_t * pTasks[BMC3_PAR_THR_MAX], * pTaskCur;
+    Bmc3_ParShare_t Share, * pShare = &Share;
+    Vec_Wec_t * vGroups;
+    Vec_Int_t * vOuts;
+    abctime clkTotal = Abc_Clock();
+    int i, k, iOut, status, nProcs, RetValue = -1;
+    int nExplored = 0, nFinished = 0, fTimeout = 0, iFrameMin = ABC_INFINITY, iFrameMax = -1;
+    // the features relying on the sequential order of solving are not supported
+    if ( pPars->nProcs < 2 || Saig_ManPoNum(pAig) < 2 || pPars->nFramesJump || pPars->fUseBridge || pPars->pLogFileName || pPars->pFuncProgress )
+    {
+        int nProcs = pPars->nProcs;
+        pPars->nProcs = 1;
+        RetValue = Saig_ManBmcScalable( pAig, pPars );
+        pPars->nProcs = nProcs;
+        return RetValue;
+    }
+    if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
+        pPars->nTimeOut = pPars->nTimeOutOne * Saig_ManPoNum(pAig) / 1000 + 1;
+    if ( pPars->nTimeOutOne && !pPars->fSolveAll )
+        pPars->nTimeOutOne = 0;
+    memset( pShare, 0, sizeof(Bmc3_ParShare_t) );
+    status = pthread_mutex_init( &pShare->Mutex, NULL );  assert( status == 0 );
+    pShare->pPars          = pPars;
+    pShare->nTimeToStopNG  = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    pShare->timeLastSolved = pPars->timeLastSolved = Abc_Clock();
+    pShare->nOutDigits     = Abc_Base10Log( Saig_ManPoNum(pAig) );
+    // partition the outputs
+    vGroups = Saig_ManBmcPartitionOutputs( pAig, Abc_MinInt(pPars->nProcs, BMC3_PAR_THR_MAX) );
+    nProcs  = Vec_WecSize( vGroups );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Running \"bmc3\" with %d workers. PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d.\n",
+            nProcs, Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig), Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig) );
+        Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d.\n", 
+            pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll );
+    } 
+    pPars->nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    // start the workers under the token of this run
+    pShare->pToken = Util_TaskToken( 0 );
+    pTaskCur = Util_TaskSetCurrent( pShare->pToken );
+    Vec_WecForEachLevel( vGroups, vOuts, i )
+    {
+        memset( ThData + i, 0, sizeof(Bmc3_ParThData_t) );
+        ThData[i].pShare   = pShare;
+        ThData[i].Pars     = *pPars;
+        ThData[i].Pars.fVerbose = 0;
+        ThData[i].pAig     = Aig_ManDupSimple( pAig );
+        ThData[i].pMan     = Saig_Bmc3ManStart( ThData[i].pAig, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose, pPars->fUseCadical );
+        ThData[i].pMan->pPars  = &ThData[i].Pars;
+        ThData[i].pMan->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+        ThData[i].vOuts    = vOuts;
+        ThData[i].iFrame   = -1;
+        pTasks[i] = Util_TaskSpawn( Saig_ManBmcParWorker, (void *)(ThData + i), 0 );
+    }
+    Util_TaskSetCurrent( pTaskCur );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Util_TaskWait( pTasks[i] );
+        Util_TaskFree( pTasks[i] );
+    }
+    Util_TaskFree( pShare->pToken );
+    // collect the results
+    if ( pPars->fSolveAll )
+    {
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Vec_Ptr_t * vCexes = ThData[i].pMan->vCexes;
+        if ( pPars->fSolveAll )
+            Vec_IntForEachEntry( ThData[i].vOuts, iOut, k )
+                Vec_PtrWriteEntry( pAig->vSeqModelVec, iOut, Vec_PtrEntry(vCexes, iOut) );
+        pPars->nDropOuts += ThData[i].Pars.nDropOuts;
+        nExplored += ThData[i].fExplored;
+        nFinished += ThData[i].fFinished;
+        fTimeout  |= ThData[i].fTimeout;
+        if ( !ThData[i].fFinished )
+            iFrameMin = Abc_MinInt( iFrameMin, ThData[i].iFrame );
+        iFrameMax = Abc_MaxInt( iFrameMax, ThData[i].iFrame );
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Worker %2d : Outputs =%6d. Frames =%5d. Conf =%9.0f. Time =%8.2f sec\n", 
+                i, Vec_IntSize(ThData[i].vOuts), ThData[i].iFrame + 1, ThData[i].nConfs, 1.0*ThData[i].clkTotal/CLOCKS_PER_SEC );
+        Vec_PtrFree( vCexes );
+        ThData[i].pMan->vCexes = NULL;
+        Saig_Bmc3ManStop( ThData[i].pMan );
+        Aig_ManStop( ThData[i].pAig );
+    }
+    if ( pShare->pCex )
+    {
+        RetValue = 0;
+        ABC_FREE( pAig->pSeqModel );
+        pAig->pSeqModel = pShare->pCex;
+        if ( pPars->nStart == 0 )
+            pPars->iFrame = pShare->pCex->iFrame - 1;
+    }
+    else 
+    {
+        if ( nExplored + nFinished == nProcs && !pShare->fStop )
+        {
+            if ( nExplored )
+                Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            else
+                Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
+            RetValue = pPars->nFailOuts ? 0 : 1;
+        }
+        else
+        {
+            if ( fTimeout && !pPars->fSilent )
+                Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+            RetValue = pPars->nFailOuts ? 0 : -1;
+        }
+        if ( pPars->nStart == 0 )
+            pPars->iFrame = nFinished == nProcs ? iFrameMax : iFrameMin;
+        // after completing all frames, the last frame is not counted if some outputs failed
+        if ( pPars->iFrame == pPars->nFramesMax - 1 && pPars->nFailOuts )
+            pPars->iFrame--;
+    }
+    if ( pPars->fVerbose )
+        Abc_PrintTime( 1, "Total time", Abc_Clock() - clkTotal );
+    Vec_WecFree( vGroups );
+    status = pthread_mutex_destroy( &pShare->Mutex );  assert( status == 0 );
+    fflush( stdout );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
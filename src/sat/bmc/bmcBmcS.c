@@ -46,18 +46,6 @@
 
 
 
-#ifdef ABC_USE_PTHREADS
-
-#if defined(_WIN32) && !defined(__MINGW32__)
-    #include "../lib/pthread.h"
-#else
-    #include <pthread.h>
-    #include <unistd.h>
-#endif
-
-#endif
-
-
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -666,6 +654,8 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
+                if ( Util_TaskStop() )
+                    break;
                 status = bmc_sat_solver_solve( p->pSats[0], &iLit, 1 );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
@@ -735,74 +725,40 @@ typedef struct Par_ThData_t_
     bmc_sat_solver *  pSat;
     int         iLit;
     int         iThread;
-    int         fWorking;
     int         status;
 } Par_ThData_t;
 
-void * Bmcs_ManWorkerThread( void * pArg )
+int Bmcs_ManWorkerTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->pSat == NULL )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-
-        pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
-
-        //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
-
-        pThData->fWorking = 0;
-    }
-    assert( 0 );
-    return NULL;
+    pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
+    //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
+    return 1;
 }
 
-int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, Par_ThData_t * ThData, int nProcs, int * pSolver )
+int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, Par_ThData_t * ThData, int nProcs, int * pSolver )
 {
-    int i, status = -1;
-    // set new problem
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].iLit = iLit;
-        assert( ThData[i].fWorking == 0 );
-    }
-    // start solvers on a new problem
+    Util_Task_t * pTasks[PAR_THR_MAX];
+    int i, status;
+    // race the solvers on the new problem; solvers block in SAT, so they run as long tasks
     for ( i = 0; i < nProcs; i++ )
-        ThData[i].fWorking = 1;
-    // check if any of the solvers finished
-    while ( i == nProcs )
-    {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( ThData[i].fWorking )
-                continue;
-            // set stop request
-            p->fStopNow = 1;
-            // remember status
-            status = ThData[i].status;
-            //printf( "Solver %d returned status %d.\n", i, status );
-            *pSolver = i;
-            break;
-        }
-    }
-    // wait till threads finish
-    while ( i < nProcs )
     {
-        for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].fWorking )
-                break;
+        ThData[i].iLit   = iLit;
+        ThData[i].status = -1;
+        pTasks[i] = Util_TaskSpawn( Bmcs_ManWorkerTask, (void *)(ThData + i), 0 );
     }
+    // take the first solver that finishes and stop the others
+    i = Util_TaskWaitAny( pTasks, nProcs );
+    assert( i >= 0 && i < nProcs );
+    p->fStopNow = 1;
+    status = ThData[i].status;
+    //printf( "Solver %d returned status %d.\n", i, status );
+    *pSolver = i;
     for ( i = 0; i < nProcs; i++ )
     {
+        Util_TaskWait( pTasks[i] );
+        Util_TaskFree( pTasks[i] );
         ThData[i].iLit = -1;
-        assert( ThData[i].fWorking == 0 );
     }
     // reset stop request
     p->fStopNow = 0;
@@ -812,20 +768,17 @@ int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, P
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     abctime clkStart = Abc_Clock();
-    pthread_t WorkerThread[PAR_THR_MAX];
     Par_ThData_t ThData[PAR_THR_MAX];
     Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
     int f, k = 0, i = Gia_ManPoNum(pGia), status, RetValue = -1, nClauses = 0, Solver = 0;
     Abc_CexFreeP( &pGia->pCexSeq );
-    // start threads
+    // prepare solver data
     for ( i = 0; i < pPars->nProcs; i++ )
     {
         ThData[i].pSat     = p->pSats[i];
         ThData[i].iLit     = -1;
         ThData[i].iThread  =  i;
-        ThData[i].fWorking =  0;
         ThData[i].status   = -1;
-        status = pthread_create( WorkerThread + i, NULL, Bmcs_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
     // solve properties in each timeframe
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
@@ -857,7 +810,9 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
-                status = Bmcs_ManPerform_Solve( p, iLit, WorkerThread, ThData, pPars->nProcs, &Solver );
+                if ( Util_TaskStop() )
+                    break;
+                status = Bmcs_ManPerform_Solve( p, iLit, ThData, pPars->nProcs, &Solver );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
                 {
@@ -892,13 +847,6 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         if ( k < pPars->nFramesAdd )
             break;
     }
-    // stop threads
-    for ( i = 0; i < pPars->nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        ThData[i].pSat = NULL;
-        ThData[i].fWorking = 1;
-    }
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
@@ -1050,7 +1050,7 @@ static lbool solver2_search(sat_solver2* s, ABC_INT64_T nof_conflicts)
             // NO CONFLICT
             int next;
 
-            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) || ((s->stats.conflicts & 63) == 0 && Util_TaskStop())){
                 // Reached bound on number of conflicts:
                 s->progress_estimate = solver2_progress(s);
                 solver2_canceluntil(s,s->root_level);
@@ -1971,6 +1971,8 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
             break;
         if ( s->nInsLimit  && s->stats.propagations > s->nInsLimit )
             break;
+        if ( Util_TaskStop() )
+            break;
     }
     if (s->verbosity >= 1)
         Abc_Print(1,"==============================================================================\n");
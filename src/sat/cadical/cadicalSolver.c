@@ -31,6 +31,22 @@ ABC_NAMESPACE_IMPL_START
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [default termination callback]
+
+  Description [stops the solver when the current task is cancelled.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int cadical_solver_terminate(void* state) {
+  (void)state;
+  return Util_TaskStop();
+}
+
 /**Function*************************************************************
 
   Synopsis    [allocate solver]
@@ -45,6 +61,7 @@ ABC_NAMESPACE_IMPL_START
 cadical_solver* cadical_solver_new(void) {
   cadical_solver* s = (cadical_solver*)malloc(sizeof(cadical_solver));
   s->p = (void*)ccadical_init();
+  ccadical_set_terminate((CCaDiCaL*)s->p, NULL, cadical_solver_terminate);
   s->nVars = 0;
   s->vAssumptions = NULL;
   s->vCore = NULL;
@@ -1275,7 +1275,7 @@ lbool Solver::search(int nof_conflicts)
 
         }else{
             // Our dynamic restart, see the SAT09 competition compagnion paper 
-            if ( (conflictsRestarts && lbdQueue.isvalid() && lbdQueue.getavg()*K > sumLBD/conflictsRestarts) || (pstop && *pstop) ) {
+            if ( (conflictsRestarts && lbdQueue.isvalid() && lbdQueue.getavg()*K > sumLBD/conflictsRestarts) || (pstop && *pstop) || ((conflicts & 63) == 0 && Util_TaskStop()) ) {
                 lbdQueue.fastclear();
                 progress_estimate = progressEstimate();
                 int bt = 0;
@@ -1436,6 +1436,7 @@ printf("c ==================================[ Search Statistics (every %6d confl
       status = search(0); // the parameter is useless in glucose, kept to allow modifications
         if (!withinBudget() || terminate_search_early || (pstop && *pstop)) break;
         if (nRuntimeLimit && Abc_Clock() > nRuntimeLimit)                   break;
+        if (Util_TaskStop())                                                break;
         curr_restarts++;
     }
 
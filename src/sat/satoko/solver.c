@@ -645,7 +645,8 @@ char solver_search(solver_t *s)
             unsigned next_lit;
 
             if (solver_rst(s) || solver_check_limits(s) == 0 || solver_stop(s) || 
-                (s->nRuntimeLimit && (s->stats.n_conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)) {
+                (s->nRuntimeLimit && (s->stats.n_conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) ||
+                ((s->stats.n_conflicts & 63) == 0 && Util_TaskStop())) {
                 b_queue_clean(s->bq_lbd);
                 solver_cancel_until(s, 0);
                 return SATOKO_UNDEC;
@@ -336,6 +336,8 @@ int satoko_solve(solver_t *s)
             break;
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
+        if (Util_TaskStop())
+            break;
     }
     if (s->opts.verbose)
         print_stats(s);
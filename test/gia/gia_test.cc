@@ -1,6 +1,27 @@
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "aig/gia/giaCutMerge.h"
+#include "sat/cnf/cnf.h"
+#include "proof/cec/cec.h"
+#include "proof/ssw/ssw.h"
+#include "sat/bmc/bmc.h"
+#include "proof/pdr/pdr.h"
+#include "proof/pdr/pdrInt.h"
+#include "base/main/main.h"
+#include "base/main/mainInt.h"
+#include "opt/sfm/sfm.h"
+#include "opt/dar/dar.h"
+#include "map/if/if.h"
+#include "map/scl/sclSize.h"
+#include "base/cmd/cmd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -51,4 +72,1021 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+// the pseudo-random generator used by the tests
+static unsigned NextRandom(unsigned* seed) {
+  *seed = *seed * 1103515245 + 12345;
+  return *seed;
+}
+
+// builds layers of random nodes, each using two nodes of the previous layer;
+// the nodes are ANDs or, if use_xors is set, a mix of ANDs and XORs; the last
+// layer drives the outputs, of which the last num_flops are flop inputs, and
+// the nodes it does not use are dropped
+static Gia_Man_t* BuildRandomLayers(unsigned seed, int num_inputs, int width, int depth,
+                                    int num_flops = 0, bool use_xors = false) {
+  Gia_Man_t* aig_manager = Gia_ManStart(num_inputs + (use_xors ? 3 : 1) * width * depth + width + 1);
+  std::vector<int> layer;
+  for (int i = 0; i < num_inputs; i++)
+    layer.push_back(Gia_ManAppendCi(aig_manager));
+  Gia_ManHashAlloc(aig_manager);
+  for (int l = 0; l < depth; l++) {
+    std::vector<int> next;
+    for (int i = 0; i < width; i++) {
+      unsigned random = NextRandom(&seed);
+      int lit0 = Abc_LitNotCond(layer[(random >> 8) % layer.size()], (random >> 4) & 1);
+      int lit1 = Abc_LitNotCond(layer[(random >> 20) % layer.size()], (random >> 5) & 1);
+      next.push_back(use_xors && ((random >> 6) & 1) ? Gia_ManHashXor(aig_manager, lit0, lit1)
+                                                     : Gia_ManHashAnd(aig_manager, lit0, lit1));
+    }
+    layer = next;
+  }
+  for (int lit : layer)
+    Gia_ManAppendCo(aig_manager, lit);
+  Gia_ManHashStop(aig_manager);
+  Gia_Man_t* result = Gia_ManCleanup(aig_manager);
+  Gia_ManSetRegNum(result, num_flops);
+  Gia_ManStop(aig_manager);
+  return result;
+}
+
+static int AreEquivalent(Gia_Man_t* first, Gia_Man_t* second) {
+  Cec_ParCec_t pars;
+  Cec_ManCecSetDefaultParams(&pars);
+  pars.fSilent = 1;
+  Gia_Man_t* miter = Gia_ManMiter(first, second, 0, 0, 0, 0, 0);
+  int result = Cec_ManVerify(miter, &pars);
+  Gia_ManStop(miter);
+  return result;
+}
+
+TEST(GiaTest, CanRehashConcurrently) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int input3 = Gia_ManAppendCi(aig_manager);
+
+  int and1 = Gia_ManAppendAnd(aig_manager, input1, input2);
+  int and2 = Gia_ManAppendAnd(aig_manager, input1, input2); // duplicate
+  int and3 = Gia_ManAppendAnd(aig_manager, and1, input3);
+  int and4 = Gia_ManAppendAnd(aig_manager, and2, input3); // duplicate
+  Gia_ManAppendCo(aig_manager, and3);
+  Gia_ManAppendCo(aig_manager, and4);
+
+  Gia_Man_t* serial = Gia_ManRehash(aig_manager, 0);
+  Gia_Man_t* concurrent = Gia_ManRehashMt(aig_manager, 4, /*fVerbose*/0);
+
+  EXPECT_EQ(Gia_ManAndNum(concurrent), 2);
+  EXPECT_EQ(Gia_ManAndNum(concurrent), Gia_ManAndNum(serial));
+  EXPECT_EQ(Gia_ObjFaninLit0p(concurrent, Gia_ManCo(concurrent, 0)),
+            Gia_ObjFaninLit0p(concurrent, Gia_ManCo(concurrent, 1)));
+  Gia_ManStop(concurrent);
+  Gia_ManStop(serial);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanRehashDeepAigConcurrently) {
+  // two copies of a long chain with the outputs taken at several depths
+  int nDepth = 50000;
+  Gia_Man_t* aig_manager = Gia_ManStart(4 * nDepth + 100);
+  int inputs[4];
+  for (int i = 0; i < 4; i++)
+    inputs[i] = Gia_ManAppendCi(aig_manager);
+  int chains[2] = {inputs[0], inputs[0]};
+  for (int i = 0; i < nDepth; i++)
+    for (int c = 0; c < 2; c++)
+      chains[c] = Gia_ManAppendAnd(aig_manager, Abc_LitNot(chains[c]), inputs[1 + i % 3]);
+  for (int c = 0; c < 2; c++)
+    Gia_ManAppendCo(aig_manager, chains[c]);
+  Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, chains[0], inputs[3]));
+  Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, chains[1], inputs[3]));
+
+  Gia_Man_t* serial = Gia_ManRehash(aig_manager, 0);
+  Gia_Man_t* concurrent = Gia_ManRehashMt(aig_manager, 2, /*fVerbose*/0);
+  EXPECT_EQ(Gia_ManAndNum(concurrent), nDepth + 1);
+  EXPECT_EQ(Gia_ManAndNum(concurrent), Gia_ManAndNum(serial));
+  EXPECT_TRUE(Gia_ManIsNormalized(concurrent));
+  EXPECT_EQ(AreEquivalent(aig_manager, concurrent), 1);
+  Gia_ManStop(concurrent);
+  Gia_ManStop(serial);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanSimulateWithThreads) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int input3 = Gia_ManAppendCi(aig_manager);
+
+  int and1 = Gia_ManAppendAnd(aig_manager, input1, Abc_LitNot(input2));
+  int and2 = Gia_ManAppendAnd(aig_manager, and1, input3);
+  Gia_ManAppendCo(aig_manager, Abc_LitNot(and2));
+
+  int nWords = 37;
+  Abc_Random(1);
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(3 * nWords);
+  Vec_Wrd_t* serial = Gia_ManSimPatSimMt(aig_manager, stimulus, /*nThreads*/1);
+  Vec_Wrd_t* parallel = Gia_ManSimPatSimMt(aig_manager, stimulus, /*nThreads*/4);
+
+  EXPECT_EQ(Vec_WrdSize(serial), Gia_ManObjNum(aig_manager) * nWords);
+  EXPECT_TRUE(Vec_WrdEqual(serial, parallel));
+  int iCo = Gia_ObjId(aig_manager, Gia_ManCo(aig_manager, 0));
+  for (int w = 0; w < nWords; w++) {
+    word a = Vec_WrdEntry(stimulus, 0 * nWords + w);
+    word b = Vec_WrdEntry(stimulus, 1 * nWords + w);
+    word c = Vec_WrdEntry(stimulus, 2 * nWords + w);
+    EXPECT_EQ(Vec_WrdEntry(serial, iCo * nWords + w), ~(a & ~b & c));
+  }
+  Vec_WrdFree(parallel);
+  Vec_WrdFree(serial);
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanSimulateBlocksInPlaceWithThreads) {
+  // enough objects and words to split the words into several blocks
+  Gia_Man_t* aig_manager = BuildRandomLayers(1, 32, 64, 32, 0, true);
+  int nWords = 300;
+  Abc_Random(1);
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * nWords);
+  Vec_Wrd_t* serial = Gia_ManSimPatSimMt(aig_manager, stimulus, /*nThreads*/1);
+  Vec_Wrd_t* parallel = Vec_WrdStart(Gia_ManObjNum(aig_manager) * nWords);
+  int i, Id;
+  Gia_ManForEachCiId(aig_manager, Id, i)
+    memcpy(Vec_WrdEntryP(parallel, Id * nWords), Vec_WrdEntryP(stimulus, i * nWords), sizeof(word) * nWords);
+  Gia_ManSimPatSimMtInt(aig_manager, Vec_WrdArray(parallel), nWords, /*nThreads*/4);
+  EXPECT_TRUE(Vec_WrdEqual(serial, parallel));
+  Vec_WrdFree(parallel);
+  Vec_WrdFree(serial);
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanGrowReservedObjectStorage) {
+  Gia_ManSetObjsMapMin(64);
+  Gia_Man_t* aig_manager =  Gia_ManStart(16);
+
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int last = Gia_ManAppendAnd(aig_manager, input1, input2);
+  Gia_Obj_t* objects = aig_manager->pObjs;
+  for (int i = 0; i < 10000; i++) {
+    last = Gia_ManAppendAnd(aig_manager, last, Abc_LitNot((i & 1) ? input2 : input1));
+    if (i == 100) objects = aig_manager->pObjs;
+  }
+  Gia_ManAppendCo(aig_manager, last);
+
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 10001);
+  // the objects are not moved after they are placed into the reserved space
+  if (aig_manager->fObjsMapped) {
+    EXPECT_EQ(objects, aig_manager->pObjs);
+  }
+  EXPECT_EQ(Gia_ObjFaninLit0p(aig_manager, Gia_ManCo(aig_manager, 0)), last);
+  Gia_ManStop(aig_manager);
+  Gia_ManSetObjsMapMin(1 << 22);
+}
+
+static std::string ReadTextFile(const std::string& file_name) {
+  std::string text;
+  FILE* file = fopen(file_name.c_str(), "rb");
+  if (file == nullptr)
+    return text;
+  char buffer[4096];
+  size_t size;
+  while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    text.append(buffer, size);
+  fclose(file);
+  return text;
+}
+
+// builds the 4-input function from the entry of the exact synthesis store;
+// returns 0 if there is no entry and -1 if the network is wrong
+static int BuildExactNode(unsigned truth, int* arrival_times) {
+  word truths[4] = {truth, 0, 0, 0};
+  Abc_Ntk_t* ntk = Abc_NtkAlloc(ABC_NTK_LOGIC, ABC_FUNC_SOP, 1);
+  ntk->pName = Extra_UtilStrsav("exact");
+  Abc_Obj_t* fanins[4];
+  for (int i = 0; i < 4; i++)
+    fanins[i] = Abc_NtkCreatePi(ntk);
+  Abc_Obj_t* node = Abc_ExactBuildNode(truths, 4, arrival_times, fanins, ntk);
+  int result = node != NULL;
+  if (node) {
+    Abc_ObjAddFanin(Abc_NtkCreatePo(ntk), node);
+    Abc_NtkAddDummyPiNames(ntk);
+    Abc_NtkAddDummyPoNames(ntk);
+    for (int m = 0; m < 16 && result == 1; m++) {
+      int model[4] = {m & 1, (m >> 1) & 1, (m >> 2) & 1, (m >> 3) & 1};
+      int* values = Abc_NtkVerifySimulatePattern(ntk, model);
+      if (values[0] != (int)((truth >> m) & 1))
+        result = -1;
+      ABC_FREE(values);
+    }
+  }
+  Abc_NtkDelete(ntk);
+  return result;
+}
+
+static int ExactDelay(unsigned truth, int* arrival_times) {
+  word truths[4] = {truth, 0, 0, 0};
+  char perm[4] = {0};
+  int cost = 0;
+  return Abc_ExactDelayCost(truths, 4, arrival_times, perm, &cost, 12);
+}
+
+TEST(GiaTest, CanShareExactSynthesisAcrossNpnClass) {
+  // the networks are checked using the flags of the frame
+  Abc_FrameGetGlobalFrame();
+  int arrival_times[4] = {6, 2, 8, 5};
+  // the function with the first two inputs swapped, the third input
+  // complemented and the output complemented
+  unsigned truth = 0xcafe, truth_npn = 0;
+  for (int m = 0; m < 16; m++) {
+    int m_orig = ((m & 1) << 1) | ((m >> 1) & 1) | ((m ^ 4) & 12);
+    if (!((truth >> m_orig) & 1))
+      truth_npn |= 1u << m;
+  }
+  int arrival_times_npn[4] = {2, 6, 8, 5};
+  Abc_ExactStart(10000, 1, 0, 0, NULL, NULL);
+  EXPECT_EQ(BuildExactNode(truth_npn, arrival_times_npn), 0);
+  int delay = ExactDelay(truth, arrival_times);
+  // the entry of the first function serves the other one
+  EXPECT_EQ(BuildExactNode(truth, arrival_times), 1);
+  EXPECT_EQ(BuildExactNode(truth_npn, arrival_times_npn), 1);
+  EXPECT_EQ(ExactDelay(truth_npn, arrival_times_npn), delay);
+  Abc_ExactStop(NULL);
+}
+
+TEST(GiaTest, CanReadExactSynthesisCacheFile) {
+  Abc_Frame_t* abc = Abc_FrameGetGlobalFrame();
+  int batch_mode = Abc_FrameIsBatchMode();
+  Abc_FrameSetBatchMode(1);
+  std::string cache_file = testing::TempDir() + "gia_test_exact.cache";
+  std::string start = "bms_start -C 10000 -F " + cache_file;
+  int arrival_times[4] = {6, 2, 8, 5};
+  remove(cache_file.c_str());
+  // the first run stores the network in the cache file
+  EXPECT_EQ(Cmd_CommandExecute(abc, start.c_str()), 0);
+  ExactDelay(0xcafe, arrival_times);
+  EXPECT_EQ(Cmd_CommandExecute(abc, "bms_stop"), 0);
+  // a torn record left by a process that did not finish writing it
+  std::string contents = ReadTextFile(cache_file);
+  ASSERT_GT(contents.size(), 116u);
+  FILE* file = fopen(cache_file.c_str(), "ab");
+  ASSERT_TRUE(file != NULL);
+  fwrite(contents.data() + 16, 1, 100, file);
+  fclose(file);
+  // the second run reads the network and appends another one
+  EXPECT_EQ(Cmd_CommandExecute(abc, start.c_str()), 0);
+  EXPECT_EQ(BuildExactNode(0xcafe, arrival_times), 1);
+  EXPECT_EQ(BuildExactNode(0x8ee8, arrival_times), 0);
+  ExactDelay(0x8ee8, arrival_times);
+  EXPECT_EQ(Cmd_CommandExecute(abc, "bms_stop"), 0);
+  // the third run skips the torn record and reads both networks
+  EXPECT_EQ(Cmd_CommandExecute(abc, start.c_str()), 0);
+  EXPECT_EQ(BuildExactNode(0xcafe, arrival_times), 1);
+  EXPECT_EQ(BuildExactNode(0x8ee8, arrival_times), 1);
+  testing::internal::CaptureStdout();
+  Abc_ExactStats();
+  std::string stats = testing::internal::GetCapturedStdout();
+  EXPECT_NE(stats.find(" - entries loaded         : 2\n"), std::string::npos);
+  EXPECT_NE(stats.find(" - corrupted records      : 1\n"), std::string::npos);
+  EXPECT_EQ(Cmd_CommandExecute(abc, "bms_stop"), 0);
+  remove(cache_file.c_str());
+  Abc_FrameSetBatchMode(batch_mode);
+}
+
+TEST(GiaTest, CanDeriveFastCnfWithThreads) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(20000);
+  Vec_Int_t* lits = Vec_IntAlloc(20000);
+  Gia_ManHashAlloc(aig_manager);
+  Abc_Random(1);
+  for (int i = 0; i < 40; i++)
+    Vec_IntPush(lits, Gia_ManAppendCi(aig_manager));
+  for (int i = 0; i < 12000; i++) {
+    int lit0 = Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - Abc_Random(0) % 200 % Vec_IntSize(lits));
+    int lit1 = Vec_IntEntry(lits, Abc_Random(0) % Vec_IntSize(lits));
+    int lit = (i % 3) ? Gia_ManHashAnd(aig_manager, Abc_LitNotCond(lit0, i & 1), Abc_LitNotCond(lit1, i & 2))
+                      : Gia_ManHashXor(aig_manager, lit0, lit1);
+    Vec_IntPush(lits, lit);
+  }
+  for (int i = 0; i < 8; i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(lits, Vec_IntSize(lits) - 1 - 50 * i));
+  Gia_ManHashStop(aig_manager);
+  Vec_IntFree(lits);
+
+  Aig_Man_t* aig = Gia_ManToAigSimple(aig_manager);
+  Cnf_Dat_t* reference = Cnf_DeriveFast(aig, Aig_ManCoNum(aig));
+  Cnf_Dat_t* serial = (Cnf_Dat_t*)Gia_ManCnfFast(aig_manager, Gia_ManCoNum(aig_manager), 0, /*nProcs*/1, 0);
+  Cnf_Dat_t* parallel = (Cnf_Dat_t*)Gia_ManCnfFast(aig_manager, Gia_ManCoNum(aig_manager), 0, /*nProcs*/4, 0);
+
+  for (Cnf_Dat_t* cnf : {serial, parallel}) {
+    EXPECT_EQ(cnf->nVars, reference->nVars);
+    ASSERT_EQ(cnf->nClauses, reference->nClauses);
+    ASSERT_EQ(cnf->nLiterals, reference->nLiterals);
+    // the constant is positive in the AIG and negative in the GIA
+    EXPECT_EQ(cnf->pClauses[0][cnf->nLiterals - 1], Abc_LitNot(reference->pClauses[0][reference->nLiterals - 1]));
+    for (int i = 0; i < cnf->nClauses; i++)
+      EXPECT_EQ(cnf->pClauses[i] - cnf->pClauses[0], reference->pClauses[i] - reference->pClauses[0]);
+    for (int i = 0; i < cnf->nLiterals - 1; i++)
+      EXPECT_EQ(cnf->pClauses[0][i], reference->pClauses[0][i]);
+  }
+  Cnf_DataFree(parallel);
+  Cnf_DataFree(serial);
+  Cnf_DataFree(reference);
+  Aig_ManStop(aig);
+  Gia_ManStop(aig_manager);
+}
+
+static Gia_Man_t* BuildChainMiter(int fBuggy) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  int inputs[16];
+  Gia_ManHashAlloc(aig_manager);
+  for (int i = 0; i < 16; i++)
+    inputs[i] = Gia_ManAppendCi(aig_manager);
+  for (int o = 0; o < 8; o++) {
+    // the same conjunction of six literals collected in opposite orders
+    int spec = 1, impl = 1;
+    for (int k = 0; k < 6; k++)
+      spec = Gia_ManHashAnd(aig_manager, spec, Abc_LitNotCond(inputs[(o + 3 * k) % 16], k & 1));
+    for (int k = 5; k >= 0; k--)
+      impl = Gia_ManHashAnd(aig_manager, impl, Abc_LitNotCond(inputs[(o + 3 * k) % 16], k & 1));
+    if (fBuggy && o == 5)
+      impl = Gia_ManHashOr(aig_manager, impl, inputs[15]);
+    Gia_ManAppendCo(aig_manager, Gia_ManHashXor(aig_manager, spec, inputs[o]));
+    Gia_ManAppendCo(aig_manager, Gia_ManHashXor(aig_manager, impl, inputs[o]));
+  }
+  Gia_ManHashStop(aig_manager);
+  return aig_manager;
+}
+
+TEST(GiaTest, CanReuseStoredCecProofs) {
+  std::string proof_file = testing::TempDir() + "gia_test_cec_proofs.bin";
+  remove(proof_file.c_str());
+  int first_hits = 0;
+  for (int run = 0; run < 3; run++) {
+    Cec_ParCec_t pars;
+    Cec_ManCecSetDefaultParams(&pars);
+    pars.fSilent = 1;
+    pars.pProofFile = (char*)proof_file.c_str();
+    Gia_Man_t* miter = BuildChainMiter(run == 2);
+    EXPECT_EQ(Cec_ManVerify(miter, &pars), run == 2 ? 0 : 1);
+    Gia_ManStop(miter);
+    // the second run reuses the proofs written by the first run
+    if (run == 0) {
+      first_hits = pars.nProofHits;
+    } else if (run == 1) {
+      EXPECT_GT(pars.nProofHits, first_hits);
+    }
+    FILE* file = fopen(proof_file.c_str(), "rb");
+    ASSERT_TRUE(file != nullptr);
+    fclose(file);
+  }
+  remove(proof_file.c_str());
+}
+
+TEST(GiaTest, CanMergeFlopsAcrossScorrShards) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int flop1 = Gia_ManAppendCi(aig_manager);
+  int flop2 = Gia_ManAppendCi(aig_manager);
+  int next = Gia_ManAppendAnd(aig_manager, input1, input2);
+  Gia_ManAppendCo(aig_manager, flop1);
+  Gia_ManAppendCo(aig_manager, flop2);
+  Gia_ManAppendCo(aig_manager, next);
+  Gia_ManAppendCo(aig_manager, next);
+  Gia_ManSetRegNum(aig_manager, 2);
+
+  // one flop per shard, so the flops can only be merged by reconciliation
+  Cec_ParCor_t pars;
+  Cec_ManCorSetDefaultParams(&pars);
+  pars.nPartSize = 1;
+  pars.nProcs = 2;
+  Gia_Man_t* reduced = Cec_ManLSCorrespondencePart(aig_manager, &pars);
+  EXPECT_EQ(Gia_ManRegNum(reduced), 1);
+  EXPECT_EQ(Gia_ManPoNum(reduced), 2);
+  Gia_ManStop(reduced);
+
+  // the unproved classes of a cancelled run are not used
+  Util_Task_t* token = Util_TaskToken(0);
+  Util_TaskCancel(token);
+  Util_Task_t* previous = Util_TaskSetCurrent(token);
+  reduced = Cec_ManLSCorrespondencePart(aig_manager, &pars);
+  Util_TaskSetCurrent(previous);
+  Util_TaskFree(token);
+  EXPECT_EQ(Gia_ManRegNum(reduced), 2);
+  Gia_ManStop(reduced);
+  Gia_ManStop(aig_manager);
+}
+
+ABC_NAMESPACE_HEADER_START
+extern Ssw_Sml_t* Ssw_SmlSimulateSeqMt(Aig_Man_t* pAig, int nPref, int nFrames, int nWords, int nProcs);
+ABC_NAMESPACE_HEADER_END
+
+TEST(GiaTest, CanSimulateSequentiallyWithThreads) {
+  // layers of 64 nodes, so that each level is large enough to be shared
+  Gia_Man_t* aig_manager = BuildRandomLayers(1, 32, 64, 6, 16);
+  Aig_Man_t* aig = Gia_ManToAigSimple(aig_manager);
+
+  Aig_ManRandom(1);
+  Ssw_Sml_t* serial = Ssw_SmlSimulateSeqMt(aig, 2, 8, 256, /*nProcs*/1);
+  Aig_ManRandom(1);
+  Ssw_Sml_t* parallel = Ssw_SmlSimulateSeqMt(aig, 2, 8, 256, /*nProcs*/4);
+  int nWords = Ssw_SmlNumWordsTotal(serial);
+  ASSERT_EQ(nWords, Ssw_SmlNumWordsTotal(parallel));
+  Aig_Obj_t* pObj;
+  int i, nDiffs = 0;
+  Aig_ManForEachObj(aig, pObj, i)
+    nDiffs += memcmp(Ssw_SmlSimInfo(serial, pObj), Ssw_SmlSimInfo(parallel, pObj), sizeof(unsigned) * nWords) != 0;
+  EXPECT_EQ(nDiffs, 0);
+  Ssw_SmlStop(parallel);
+  Ssw_SmlStop(serial);
+  Aig_ManStop(aig);
+  Gia_ManStop(aig_manager);
+}
+
+static int CounterEquals(Gia_Man_t* aig_manager, int* bits, int value) {
+  int result = 1;
+  for (int i = 0; i < 4; i++)
+    result = Gia_ManHashAnd(aig_manager, result, Abc_LitNotCond(bits[i], !((value >> i) & 1)));
+  return result;
+}
+
+// two independent counters: A counts when the input is 1, B counts up to 5
+static Gia_Man_t* BuildTwoCounters() {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  int enable = Gia_ManAppendCi(aig_manager);
+  int a[4], b[4], a_next[4], b_next[4];
+  for (int i = 0; i < 4; i++)
+    a[i] = Gia_ManAppendCi(aig_manager);
+  for (int i = 0; i < 4; i++)
+    b[i] = Gia_ManAppendCi(aig_manager);
+  Gia_ManHashAlloc(aig_manager);
+  int carry_a = enable, carry_b = 1;
+  int b_full = CounterEquals(aig_manager, b, 5);
+  for (int i = 0; i < 4; i++) {
+    a_next[i] = Gia_ManHashXor(aig_manager, a[i], carry_a);
+    carry_a = Gia_ManHashAnd(aig_manager, a[i], carry_a);
+    b_next[i] = Gia_ManHashMux(aig_manager, b_full, b[i], Gia_ManHashXor(aig_manager, b[i], carry_b));
+    carry_b = Gia_ManHashAnd(aig_manager, b[i], carry_b);
+  }
+  for (int k = 2; k < 10; k++)
+    Gia_ManAppendCo(aig_manager, CounterEquals(aig_manager, a, k));
+  int b_values[4] = {1, 4, 9, 12};
+  for (int k = 0; k < 4; k++)
+    Gia_ManAppendCo(aig_manager, CounterEquals(aig_manager, b, b_values[k]));
+  for (int i = 0; i < 4; i++)
+    Gia_ManAppendCo(aig_manager, a_next[i]);
+  for (int i = 0; i < 4; i++)
+    Gia_ManAppendCo(aig_manager, b_next[i]);
+  Gia_ManHashStop(aig_manager);
+  Gia_ManSetRegNum(aig_manager, 8);
+  return aig_manager;
+}
+
+// returns the frame where each output fails or -1
+static std::vector<int> RunBmc3(Gia_Man_t* gia, int num_procs) {
+  Aig_Man_t* aig = Gia_ManToAig(gia, 0);
+  Saig_ParBmc_t pars;
+  Saig_ParBmcSetDefaultParams(&pars);
+  pars.nFramesMax = 12;
+  pars.fSolveAll = 1;
+  pars.fStoreCex = 1;
+  pars.fNotVerbose = 1;
+  pars.fSilent = 1;
+  pars.nProcs = num_procs;
+  Saig_ManBmcScalable(aig, &pars);
+  std::vector<int> frames;
+  for (int i = 0; i < Saig_ManPoNum(aig); i++) {
+    Abc_Cex_t* cex = aig->vSeqModelVec ? (Abc_Cex_t*)Vec_PtrEntry(aig->vSeqModelVec, i) : NULL;
+    frames.push_back(cex ? cex->iFrame : -1);
+  }
+  Aig_ManStop(aig);
+  return frames;
+}
+
+TEST(GiaTest, CanSolveOutputGroupsOfBmc3InParallel) {
+  Gia_Man_t* aig_manager = BuildTwoCounters();
+  std::vector<int> serial = RunBmc3(aig_manager, 1);
+  std::vector<int> parallel = RunBmc3(aig_manager, 4);
+  std::vector<int> expected = {2, 3, 4, 5, 6, 7, 8, 9, 1, 4, -1, -1};
+  EXPECT_EQ(serial, expected);
+  EXPECT_EQ(parallel, expected);
+  Gia_ManStop(aig_manager);
+}
+
+static int StopImmediately(int) { return 1; }
+
+// returns the PDR status of the output and the frame of the counter-example
+static int RunPdr(Gia_Man_t* gia, int output, int num_threads, int (*stop)(int), int* frame,
+                  int solver_type = PDR_SAT_BSAT, int new_xsim = 0) {
+  Gia_Man_t* cone = Gia_ManDupCones(gia, &output, 1, 0);
+  Aig_Man_t* aig = Gia_ManToAig(cone, 0);
+  Pdr_Par_t pars;
+  Pdr_ManSetDefaultParams(&pars);
+  pars.nThreads = num_threads;
+  pars.pFuncStop = stop;
+  pars.nSolverType = solver_type;
+  pars.fNewXSim = new_xsim;
+  pars.fSilent = 1;
+  int status = Pdr_ManSolve(aig, &pars);
+  *frame = aig->pSeqModel ? aig->pSeqModel->iFrame : -1;
+  Aig_ManStop(aig);
+  Gia_ManStop(cone);
+  return status;
+}
+
+TEST(GiaTest, CanSolvePdrWithConcurrentWorkers) {
+  // the proved invariant is saved in the framework
+  Abc_FrameGetGlobalFrame();
+  Gia_Man_t* aig_manager = BuildTwoCounters();
+  for (int num_threads = 1; num_threads <= 4; num_threads += 3) {
+    int frame;
+    // counter A reaches 9 in frame 9, while counter B never reaches 9
+    EXPECT_EQ(RunPdr(aig_manager, 7, num_threads, NULL, &frame), 0);
+    EXPECT_EQ(frame, 9);
+    EXPECT_EQ(RunPdr(aig_manager, 10, num_threads, NULL, &frame), 1);
+    // the callback of the caller stops all workers
+    EXPECT_EQ(RunPdr(aig_manager, 10, num_threads, StopImmediately, &frame), -1);
+  }
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanSolvePdrWithOtherSatSolvers) {
+  Abc_FrameGetGlobalFrame();
+  Gia_Man_t* aig_manager = BuildTwoCounters();
+  for (int solver_type = PDR_SAT_SATOKO; solver_type <= PDR_SAT_CADICAL; solver_type++) {
+    int frame;
+    EXPECT_EQ(RunPdr(aig_manager, 7, 1, NULL, &frame, solver_type), 0);
+    EXPECT_EQ(frame, 9);
+    EXPECT_EQ(RunPdr(aig_manager, 10, 1, NULL, &frame, solver_type), 1);
+    // the updated X-valued simulation is bsat-only and is skipped by the workers
+    EXPECT_EQ(RunPdr(aig_manager, 7, 2, NULL, &frame, solver_type, 1), 0);
+    EXPECT_EQ(frame, 9);
+    EXPECT_EQ(RunPdr(aig_manager, 10, 2, NULL, &frame, solver_type, 1), 1);
+  }
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanLiftCubesWithWordParallelTernarySimulation) {
+  // random sequential logic with 150 flops, so that the cones have many flops
+  Gia_Man_t* aig_manager = BuildRandomLayers(1, 158, 151, 7, 150);
+  Aig_Man_t* aig = Gia_ManToAig(aig_manager, 0);
+  for (int flop_prio = 0; flop_prio < 2; flop_prio++) {
+    Pdr_Par_t pars;
+    Pdr_ManSetDefaultParams(&pars);
+    pars.fWordXSim = 1;
+    pars.fFlopPrio = flop_prio;
+    pars.fSilent = 1;
+    Pdr_Man_t* pdr = Pdr_ManStart(aig, &pars, NULL);
+    Pdr_ManCreateSolver(pdr, 0);
+    Pdr_ManCreateSolver(pdr, 1);
+    Vec_Int_t* lits = Vec_IntAlloc(16);
+    Vec_Int_t* pi_lits = Vec_IntAlloc(0);
+    unsigned seed = 2;
+    int num_sat = 0, num_lifted = 0;
+    for (int sample = 0; sample < 200; sample++) {
+      // the first sample is the property, the other ones are random cubes
+      Pdr_Set_t* cube = NULL;
+      if (sample > 0) {
+        Vec_IntClear(lits);
+        for (int i = 0; i < 1 + sample % 6; i++) {
+          unsigned random = NextRandom(&seed);
+          int lit = Abc_Var2Lit((random >> 8) % Aig_ManRegNum(aig), (random >> 4) & 1);
+          if (Vec_IntFind(lits, lit) == -1 && Vec_IntFind(lits, Abc_LitNot(lit)) == -1)
+            Vec_IntPush(lits, lit);
+        }
+        cube = Pdr_SetCreate(lits, pi_lits);
+      }
+      Pdr_Set_t* pred = NULL;
+      if (Pdr_ManCheckCube(pdr, 1, cube, &pred, 0, 0, 0) == 0) {
+        Pdr_Set_t* pred_old = Pdr_ManTernarySim(pdr, 1, cube);
+        ASSERT_EQ(pred->nLits, pred_old->nLits);
+        ASSERT_EQ(pred->nTotal, pred_old->nTotal);
+        EXPECT_EQ(std::vector<int>(pred->Lits, pred->Lits + pred->nTotal),
+                  std::vector<int>(pred_old->Lits, pred_old->Lits + pred_old->nTotal));
+        num_sat++;
+        num_lifted += pred->nLits < Aig_ManRegNum(aig);
+        Pdr_SetDeref(pred_old);
+        Pdr_SetDeref(pred);
+      }
+      if (cube)
+        Pdr_SetDeref(cube);
+    }
+    EXPECT_GT(num_sat, 100);
+    EXPECT_GT(num_lifted, 0);
+    Vec_IntFree(lits);
+    Vec_IntFree(pi_lits);
+    Pdr_ManStop(pdr);
+  }
+  Aig_ManStop(aig);
+  Gia_ManStop(aig_manager);
+}
+
+// writes a library with buffers, inverters, NAND2 and NOR2 gates in three sizes
+static void WriteSizingLibrary(const char* file_name) {
+  const char* index = "index_1(\"0.01, 0.05, 0.2, 0.8\");\n        index_2(\"0.001, 0.005, 0.02, 0.08\");\n";
+  const double slews[4] = {0.01, 0.05, 0.2, 0.8}, loads[4] = {0.001, 0.005, 0.02, 0.08};
+  const char* tables[4] = {"cell_rise", "cell_fall", "rise_transition", "fall_transition"};
+  const char* names[4] = {"BUF", "INV", "NAND2", "NOR2"};
+  const char* functions[4] = {"A", "!A", "!(A*B)", "!(A+B)"};
+  FILE* file = fopen(file_name, "w");
+  fprintf(file, "library(sizing) {\n  time_unit : \"1ns\";\n  capacitive_load_unit (1,pf);\n");
+  fprintf(file, "  lu_table_template(tmpl) {\n    variable_1 : input_net_transition;\n");
+  fprintf(file, "    variable_2 : total_output_net_capacitance;\n    %s  }\n", index);
+  for (int g = 0; g < 4; g++) {
+    for (int size = 1; size <= 4; size *= 2) {
+      fprintf(file, "  cell(%sX%d) {\n    area : %d;\n", names[g], size, (g ? g : 2) * size);
+      for (int pin = 0; pin < 1 + (g > 1); pin++)
+        fprintf(file, "    pin(%c) { direction : input; capacitance : %.4f; }\n", 'A' + pin, 0.002 * size);
+      fprintf(file, "    pin(Y) {\n      direction : output;\n      function : \"%s\";\n", functions[g]);
+      for (int pin = 0; pin < 1 + (g > 1); pin++) {
+        fprintf(file, "      timing() {\n        related_pin : \"%c\";\n        timing_sense : %s;\n", 'A' + pin,
+                g ? "negative_unate" : "positive_unate");
+        for (int t = 0; t < 4; t++) {
+          fprintf(file, "        %s(tmpl) {\n        %s        values(", tables[t], index);
+          for (int i = 0; i < 4; i++) {
+            fprintf(file, "%s\"", i ? ", " : "");
+            for (int j = 0; j < 4; j++)
+              fprintf(file, "%s%.4f", j ? ", " : "", 0.02 * (g + 1) + 0.3 * slews[i] + (t + 4.0) * loads[j] / size);
+            fprintf(file, "\"");
+          }
+          fprintf(file, ");\n        }\n");
+        }
+        fprintf(file, "      }\n");
+      }
+      fprintf(file, "    }\n  }\n");
+    }
+  }
+  fprintf(file, "}\n");
+  fclose(file);
+}
+
+// maps wide random logic, whose levels have enough nodes to be split into chunks
+static Abc_Ntk_t* MapWideLogic(Abc_Frame_t* abc) {
+  std::string lib_file = testing::TempDir() + "gia_test_sizing.lib";
+  WriteSizingLibrary(lib_file.c_str());
+  EXPECT_EQ(Cmd_CommandExecute(abc, ("read_lib " + lib_file).c_str()), 0);
+  // the nodes not used in the last layer are dropped
+  Abc_FrameUpdateGia(abc, BuildRandomLayers(3, 64, 4000, 6));
+  EXPECT_EQ(Cmd_CommandExecute(abc, "&put; map; topo"), 0);
+  return Abc_FrameReadNtk(abc);
+}
+
+static void UpsizeWithThreads(Abc_Ntk_t* ntk, int num_threads, float* area, float* delay) {
+  SC_SizePars pars;
+  memset(&pars, 0, sizeof(SC_SizePars));
+  pars.nIters = 20;
+  pars.nIterNoChange = 50;
+  pars.Window = 1;
+  pars.Ratio = 10;
+  pars.Notches = 1000;
+  pars.nProcs = num_threads;
+  pars.fUseDept = 1;
+  // the upsizer always prints its progress
+  testing::internal::CaptureStdout();
+  Abc_SclUpsizePerform((SC_Lib*)Abc_FrameReadLibScl(), ntk, &pars, NULL);
+  testing::internal::GetCapturedStdout();
+  SC_Man* sizer = Abc_SclManStart((SC_Lib*)Abc_FrameReadLibScl(), ntk, 0, 1, 0, 0);
+  *area = sizer->SumArea0;
+  *delay = sizer->MaxDelay0;
+  Abc_SclManFree(sizer);
+}
+
+TEST(GiaTest, CanRecomputeSizingTimingWithThreads) {
+  Abc_Frame_t* abc = Abc_FrameGetGlobalFrame();
+  int batch_mode = Abc_FrameIsBatchMode();
+  // the commands are not saved in the history file
+  Abc_FrameSetBatchMode(1);
+  Abc_Ntk_t* ntk = MapWideLogic(abc);
+  ASSERT_TRUE(ntk != NULL);
+  SC_Lib* lib = (SC_Lib*)Abc_FrameReadLibScl();
+  // the arrival times and slews are the same with 1 and 4 threads
+  SC_Man* sizer = Abc_SclManStart(lib, ntk, 0, 1, 0, 0);
+  int num_objs = Abc_NtkObjNumMax(ntk);
+  std::vector<SC_Pair> times(sizer->pTimes, sizer->pTimes + num_objs);
+  std::vector<SC_Pair> slews(sizer->pSlews, sizer->pSlews + num_objs);
+  float area, delay;
+  sizer->nProcs = 4;
+  Abc_SclTimeNtkRecompute(sizer, &area, &delay, 0, 0);
+  EXPECT_EQ(area, sizer->SumArea0);
+  EXPECT_EQ(delay, sizer->MaxDelay0);
+  EXPECT_EQ(memcmp(times.data(), sizer->pTimes, sizeof(SC_Pair) * num_objs), 0);
+  EXPECT_EQ(memcmp(slews.data(), sizer->pSlews, sizeof(SC_Pair) * num_objs), 0);
+  Abc_SclManFree(sizer);
+  // upsizing selects the same gates
+  Abc_Ntk_t* ntk_serial = Abc_NtkDup(ntk);
+  Abc_Ntk_t* ntk_parallel = Abc_NtkDup(ntk);
+  float area_serial, delay_serial, area_parallel, delay_parallel;
+  UpsizeWithThreads(ntk_serial, 1, &area_serial, &delay_serial);
+  UpsizeWithThreads(ntk_parallel, 4, &area_parallel, &delay_parallel);
+  EXPECT_GT(area_serial, area);
+  EXPECT_EQ(area_serial, area_parallel);
+  EXPECT_EQ(delay_serial, delay_parallel);
+  Abc_Obj_t* obj;
+  int i;
+  Abc_NtkForEachNode(ntk_serial, obj, i)
+    EXPECT_EQ(obj->pData, Abc_NtkObj(ntk_parallel, i)->pData);
+  Abc_NtkDelete(ntk_serial);
+  Abc_NtkDelete(ntk_parallel);
+  Abc_SclLibFree(lib);
+  abc->pLibScl = NULL;
+  Abc_FrameSetBatchMode(batch_mode);
+}
+
+static std::vector<int> MapWithThreads(Abc_Frame_t* abc, Gia_Man_t* aig_manager, int num_threads) {
+  Abc_FrameUpdateGia(abc, Gia_ManDup(aig_manager));
+  std::string command = "&if -K 6 -P " + std::to_string(num_threads);
+  EXPECT_EQ(Cmd_CommandExecute(abc, command.c_str()), 0);
+  Vec_Int_t* mapping = Abc_FrameReadGia(abc)->vMapping;
+  EXPECT_TRUE(mapping != NULL);
+  return mapping ? std::vector<int>(Vec_IntArray(mapping), Vec_IntArray(mapping) + Vec_IntSize(mapping))
+                 : std::vector<int>();
+}
+
+TEST(GiaTest, CanMapLevelsWithThreads) {
+  Abc_Frame_t* abc = Abc_FrameGetGlobalFrame();
+  int batch_mode = Abc_FrameIsBatchMode();
+  // the commands are not saved in the history file
+  Abc_FrameSetBatchMode(1);
+  // the levels are wide enough to be split among the threads
+  Gia_Man_t* aig_manager = BuildRandomLayers(5, 64, 2000, 6);
+  std::vector<int> serial = MapWithThreads(abc, aig_manager, 1);
+  std::vector<int> parallel = MapWithThreads(abc, aig_manager, 4);
+  EXPECT_FALSE(serial.empty());
+  EXPECT_EQ(serial, parallel);
+  Gia_ManStop(aig_manager);
+  Abc_FrameSetBatchMode(batch_mode);
+}
+
+static int SumRangeTask(void* arg) {
+  int* range = (int*)arg;
+  if (range[1] - range[0] <= 4) {
+    int sum = 0;
+    for (int i = range[0]; i < range[1]; i++)
+      sum += i;
+    return sum;
+  }
+  // split the range and wait for the halves from inside the task
+  int mid = (range[0] + range[1]) / 2;
+  int left[2] = {range[0], mid}, right[2] = {mid, range[1]};
+  Util_Task_t* task = Util_TaskSubmit(SumRangeTask, left, 0);
+  int sum = SumRangeTask(right);
+  sum += Util_TaskWait(task);
+  Util_TaskFree(task);
+  return sum;
+}
+
+static int WaitForStopTask(void* arg) {
+  (void)arg;
+  while (!Util_TaskStop())
+    ;
+  return 7;
+}
+
+TEST(GiaTest, CanRunNestedAndCancelledPoolTasks) {
+  Util_PoolReserve(3);
+  int range[2] = {0, 1000};
+  Util_Task_t* task = Util_TaskSubmit(SumRangeTask, range, 0);
+  EXPECT_EQ(Util_TaskWait(task), 999 * 1000 / 2);
+  Util_TaskFree(task);
+  Util_Task_t* looping = Util_TaskSpawn(WaitForStopTask, NULL, 0);
+  Util_TaskCancel(looping);
+  int result = Util_TaskWait(looping);
+  EXPECT_TRUE(result == 7 || result == -1);
+  EXPECT_TRUE(Util_TaskIsDone(looping));
+  Util_TaskFree(looping);
+}
+
+TEST(GiaTest, CancelsTasksThroughInheritedToken) {
+  EXPECT_EQ(Util_TaskStop(), 0);
+  Util_Task_t* token = Util_TaskToken(0);
+  Util_Task_t* previous = Util_TaskSetCurrent(token);
+  Util_Task_t* looping = Util_TaskSpawn(WaitForStopTask, NULL, 0);
+  EXPECT_EQ(Util_TaskStop(), 0);
+  Util_TaskCancel(token);
+  EXPECT_EQ(Util_TaskStop(), 1);
+  int result = Util_TaskWait(looping);
+  EXPECT_TRUE(result == 7 || result == -1);
+  Util_TaskFree(looping);
+  EXPECT_EQ(Util_TaskSetCurrent(previous), token);
+  Util_TaskFree(token);
+  EXPECT_EQ(Util_TaskStop(), 0);
+}
+
+static std::atomic<int> s_nRunning(0), s_nRunningMax(0), s_nFinished(0);
+
+static int SlowItemTask(void* arg) {
+  int running = ++s_nRunning;
+  int max = s_nRunningMax.load();
+  while (running > max && !s_nRunningMax.compare_exchange_weak(max, running))
+    ;
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  *(int*)arg = 1;
+  --s_nRunning;
+  ++s_nFinished;
+  return 1;
+}
+
+TEST(GiaTest, ProcessesAllItemsWithinThreadLimit) {
+  // the pool has more workers than the call may use
+  Util_PoolReserve(8);
+  int done[8] = {0};
+  Vec_Ptr_t* vData = Vec_PtrAlloc(8);
+  for (int i = 0; i < 8; i++)
+    Vec_PtrPush(vData, done + i);
+  // the items take longer than the timeout in total, but none is skipped
+  Util_ProcessThreads(SlowItemTask, vData, 3, 1, 0);
+  Vec_PtrFree(vData);
+  for (int i = 0; i < 8; i++)
+    EXPECT_EQ(done[i], 1);
+  EXPECT_EQ(s_nFinished.load(), 8);
+  EXPECT_LE(s_nRunningMax.load(), 2);
+}
+
+ABC_NAMESPACE_HEADER_START
+extern Gia_Man_t* Gia_ManPerformMfs(Gia_Man_t* p, Sfm_Par_t* pPars);
+ABC_NAMESPACE_HEADER_END
+
+static Gia_Man_t* PerformMfs(Gia_Man_t* mapped, int num_procs) {
+  Sfm_Par_t pars;
+  Sfm_ParSetDefault(&pars);
+  pars.nTfoLevMax = 5;
+  pars.nDepthMax = 100;
+  pars.nWinSizeMax = 2000;
+  pars.nProcs = num_procs;
+  return Gia_ManPerformMfs(mapped, &pars);
+}
+
+TEST(GiaTest, CanResubstituteWindowsInParallel) {
+  // a random redundant AIG whose nodes share fanins, so that the windows overlap
+  Gia_Man_t* aig_manager = BuildRandomLayers(1, 16, 16, 24);
+
+  Jf_Par_t map_pars;
+  Mf_ManSetDefaultPars(&map_pars);
+  map_pars.nLutSize = 4;
+  Gia_Man_t* mapped = Mf_ManPerformMapping(aig_manager, &map_pars);
+  Gia_Man_t* serial = PerformMfs(mapped, 1);
+  Gia_Man_t* parallel = PerformMfs(mapped, 4);
+  ASSERT_TRUE(serial != NULL && parallel != NULL);
+  EXPECT_LT(Gia_ManLutNum(serial), Gia_ManLutNum(mapped));
+  EXPECT_LT(Gia_ManLutNum(parallel), Gia_ManLutNum(mapped));
+  EXPECT_EQ(AreEquivalent(serial, parallel), 1);
+  EXPECT_EQ(AreEquivalent(aig_manager, parallel), 1);
+  Gia_ManStop(parallel);
+  Gia_ManStop(serial);
+  Gia_ManStop(mapped);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanRewriteRegionsInParallel) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  int inputs[10];
+  Gia_ManHashAlloc(aig_manager);
+  for (int i = 0; i < 10; i++)
+    inputs[i] = Gia_ManAppendCi(aig_manager);
+  for (int o = 0; o < 8; o++) {
+    // (x & y) & (x & z) uses three AND nodes where two are enough
+    int left = Gia_ManHashAnd(aig_manager, inputs[o], inputs[8]);
+    int right = Gia_ManHashAnd(aig_manager, inputs[o], inputs[9]);
+    Gia_ManAppendCo(aig_manager, Gia_ManHashAnd(aig_manager, left, right));
+  }
+  Gia_ManHashStop(aig_manager);
+
+  Dar_LibStart();
+  Gia_Man_t* rewritten = Gia_ManRewritePar(aig_manager, 4, 3, 0, 0);
+  Dar_LibStop();
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 24);
+  EXPECT_EQ(Gia_ManAndNum(rewritten), 16);
+  EXPECT_EQ(AreEquivalent(aig_manager, rewritten), 1);
+  Gia_ManStop(rewritten);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanMergeOrderedCuts) {
+  int cut0[3] = {2, 5, 9};
+  int cut1[3] = {3, 5, 11};
+  int cut2[2] = {3, 11};
+  int merged[6];
+  EXPECT_EQ(Gia_CutMrgOrder(cut0, 3, cut1, 3, merged, 6), 5);
+  int expected[5] = {2, 3, 5, 9, 11};
+  for (int i = 0; i < 5; i++)
+    EXPECT_EQ(merged[i], expected[i]);
+  EXPECT_EQ(Gia_CutMrgOrder(cut0, 3, cut1, 3, merged, 4), -1);
+  EXPECT_EQ(Gia_CutMrgOrder3(cut0, 3, cut1, 3, cut2, 2, merged, 5), 5);
+  EXPECT_EQ(Gia_CutMrgIsContained(cut1, 3, cut2, 2), 1);
+  EXPECT_EQ(Gia_CutMrgIsContained(cut0, 3, cut2, 2), 0);
+
+  word sign0 = Gia_CutMrgSign(cut0, 3);
+  word sign1 = Gia_CutMrgSign(cut1, 3);
+  EXPECT_EQ(Gia_CutMrgBitCount(sign0 | sign1), 5);
+  EXPECT_EQ(Gia_CutMrgFilter(sign0 | sign1, 6, 4), 1);
+  EXPECT_EQ(Gia_CutMrgFilter(sign0 | sign1, 6, 5), 0);
+}
+
+TEST(GiaTest, CanReuseStoredTruthTables) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  int inputs[8];
+  Gia_ManHashAlloc(aig_manager);
+  for (int i = 0; i < 8; i++)
+    inputs[i] = Gia_ManAppendCi(aig_manager);
+  for (int o = 0; o < 4; o++) {
+    int x = Gia_ManHashXor(aig_manager, inputs[o], inputs[o + 4]);
+    int m = Gia_ManHashMux(aig_manager, inputs[(o + 1) % 4], x, inputs[(o + 2) % 8]);
+    Gia_ManAppendCo(aig_manager, Gia_ManHashAnd(aig_manager, m, inputs[(o + 3) % 8]));
+  }
+  Gia_ManHashStop(aig_manager);
+
+  If_TtStore_t* store = If_TtStoreAlloc();
+  Jf_Par_t pars;
+  Mf_ManSetDefaultPars(&pars);
+  pars.nLutSize = 4;
+  pars.fCutMin = 1;
+  pars.vTtMem = If_TtStoreMem(store, pars.nLutSize);
+  EXPECT_EQ(pars.vTtMem, If_TtStoreMem(store, 6));
+  Gia_Man_t* mapped1 = Mf_ManPerformMapping(aig_manager, &pars);
+  int num_funcs = Vec_MemEntryNum(pars.vTtMem);
+  EXPECT_GT(num_funcs, 2);
+  // the second run finds all of its cut functions in the store
+  Gia_Man_t* mapped2 = Mf_ManPerformMapping(aig_manager, &pars);
+  EXPECT_EQ(Vec_MemEntryNum(pars.vTtMem), num_funcs);
+  EXPECT_EQ(Gia_ManLutNum(mapped1), Gia_ManLutNum(mapped2));
+  // the ISOPs are derived for the tables added without them
+  EXPECT_EQ(Vec_WecSize(If_TtStoreIsops(store, 6)), num_funcs);
+  Gia_ManStop(mapped1);
+  Gia_ManStop(mapped2);
+  If_TtStoreFree(store);
+  Gia_ManStop(aig_manager);
+}
+
+// checks that the brackets outside of the strings are balanced
+static bool IsBalancedJson(const std::string& text) {
+  std::vector<char> stack;
+  bool in_string = false;
+  for (size_t i = 0; i < text.size(); i++) {
+    char c = text[i];
+    if (in_string) {
+      if (c == '\\')
+        i++;
+      else if (c == '"')
+        in_string = false;
+    } else if (c == '"') {
+      in_string = true;
+    } else if (c == '{' || c == '[') {
+      stack.push_back(c == '{' ? '}' : ']');
+    } else if (c == '}' || c == ']') {
+      if (stack.empty() || stack.back() != c)
+        return false;
+      stack.pop_back();
+    }
+  }
+  return !in_string && stack.empty();
+}
+
+static int CountSubstrings(const std::string& text, const std::string& pattern) {
+  int count = 0;
+  for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+    count++;
+  return count;
+}
+
+TEST(GiaTest, CanExportCommandTrace) {
+  Abc_Frame_t* abc = Abc_FrameGetGlobalFrame();
+  int batch_mode = Abc_FrameIsBatchMode();
+  Abc_FrameSetBatchMode(1);
+  std::string first_file = testing::TempDir() + "gia_test_trace1.json";
+  std::string second_file = testing::TempDir() + "gia_test_trace2.json";
+  Gia_Man_t* aig_manager = BuildRandomLayers(7, 16, 100, 4);
+  Abc_FrameUpdateGia(abc, aig_manager);
+  EXPECT_EQ(Cmd_CommandExecute(abc, ("profile " + first_file).c_str()), 0);
+  EXPECT_EQ(Cmd_CommandExecute(abc, "&st; &b"), 0);
+  // the trace is restarted by a command nested in an alias
+  EXPECT_EQ(Cmd_CommandExecute(abc, ("alias gia_test_restart \"profile " + second_file + "; &st\"").c_str()), 0);
+  EXPECT_EQ(Cmd_CommandExecute(abc, "gia_test_restart"), 0);
+  EXPECT_EQ(Cmd_CommandExecute(abc, "&b"), 0);
+  EXPECT_EQ(Cmd_CommandExecute(abc, "profile"), 0);
+  EXPECT_EQ(Cmd_CommandExecute(abc, "unalias gia_test_restart"), 0);
+  Abc_FrameSetBatchMode(batch_mode);
+
+  std::string first = ReadTextFile(first_file);
+  std::string second = ReadTextFile(second_file);
+  remove(first_file.c_str());
+  remove(second_file.c_str());
+  for (const std::string& trace : {first, second}) {
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    EXPECT_TRUE(IsBalancedJson(trace));
+    EXPECT_EQ(CountSubstrings(trace, "\"ts\":-"), 0);
+  }
+  // the first trace has the commands completed before the restart
+  EXPECT_EQ(CountSubstrings(first, "\"ph\":\"X\""), 3);
+  EXPECT_EQ(CountSubstrings(first, "{\"name\":\"&st\",\"cat\":\"command\""), 1);
+  EXPECT_EQ(CountSubstrings(first, "{\"name\":\"&b\",\"cat\":\"command\""), 1);
+  // the second trace has the rest of the alias and the command after it,
+  // but not the alias and the command that were running when it started
+  EXPECT_EQ(CountSubstrings(second, "\"ph\":\"X\""), 2);
+  EXPECT_EQ(CountSubstrings(second, "{\"name\":\"&st\",\"cat\":\"nested\""), 1);
+  EXPECT_EQ(CountSubstrings(second, "{\"name\":\"&b\",\"cat\":\"command\""), 1);
+}
+
 ABC_NAMESPACE_IMPL_END